@@ -1,6 +1,6 @@
 // G8RTOS_IPC.h
 // Date Created: 2023-07-26
-// Date Updated: 2023-07-26
+// Date Updated: 2026-10-18
 // Interprocess communication code for G8RTOS
 
 #ifndef G8RTOS_IPC_H_
@@ -25,6 +25,14 @@
 /******************************Data Type Definitions********************************/
 
 /****************************Data Structure Definitions*****************************/
+
+// FIFO fill and losses since it was initialized
+typedef struct {
+    int32_t count;
+    uint32_t peak;
+    uint32_t lost;
+} fifoStats_t;
+
 /****************************Data Structure Definitions*****************************/
 
 /********************************Public Variables***********************************/
@@ -35,6 +43,7 @@
 int32_t G8RTOS_InitFIFO(uint32_t FIFO_index);
 int32_t G8RTOS_ReadFIFO(uint32_t FIFO_index);
 int32_t G8RTOS_WriteFIFO(uint32_t FIFO_index, uint32_t data);
+int32_t G8RTOS_GetFIFOStats(uint32_t FIFO_index, fifoStats_t* stats);
 
 /********************************Public Functions***********************************/
 
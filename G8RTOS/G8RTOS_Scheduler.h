@@ -1,6 +1,6 @@
 // G8RTOS_Scheduler.h
 // Date Created: 2023-07-26
-// Date Updated: 2023-07-26
+// Date Updated: 2026-10-18
 // Scheduler / initialization code for G8RTOS
 
 #ifndef G8RTOS_SCHEDULER_H_
@@ -19,7 +19,7 @@
 /* Status Register with the Thumb-bit Set */
 #define THUMBBIT            0x01000000
 
-#define MAX_THREADS         6
+#define MAX_THREADS         8
 #define MAX_PTHREADS        3
 #define STACKSIZE           256
 #define OSINT_PRIORITY      7
@@ -49,6 +49,7 @@ typedef enum
 /********************************Public Variables***********************************/
 
 extern tcb_t* CurrentlyRunningThread;
+extern uint32_t SystemTime;
 
 /********************************Public Variables***********************************/
 
@@ -68,11 +69,14 @@ sched_ErrCode_t G8RTOS_Add_APeriodicEvent(void (*AthreadToAdd)(void), uint8_t pr
 sched_ErrCode_t G8RTOS_Add_PeriodicEvent(void (*PthreadToAdd)(void), uint32_t period, uint32_t execution);
 sched_ErrCode_t G8RTOS_KillThread(threadID_t threadID);
 sched_ErrCode_t G8RTOS_KillSelf();
+sched_ErrCode_t G8RTOS_SetPriority(threadID_t threadID, uint8_t priority);
 
 void sleep(uint32_t durationMS);
+uint32_t G8RTOS_GetTimeUS(void);
 
 threadID_t G8RTOS_GetThreadID();
 uint32_t G8RTOS_GetNumberOfThreads(void);
+uint32_t G8RTOS_GetThreadStats(threadStats_t* stats, uint32_t max);
 
 /********************************Public Functions***********************************/
 
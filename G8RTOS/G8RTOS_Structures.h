@@ -43,6 +43,8 @@ typedef struct tcb_t {
     bool isAlive;
     char threadName[MAX_NAME_LENGTH];
     threadID_t ThreadID;
+    uint32_t runTimeUS;         // time between being switched in and out
+    uint32_t switches;          // times switched in
 } tcb_t;
 
 // Periodic Thread Control Block
@@ -55,6 +57,18 @@ typedef struct ptcb_t {
     uint32_t currentTime;
 } ptcb_t;
 
+// Copy of a live thread's scheduling counters. Interrupts are charged to the
+// thread they preempt.
+typedef struct {
+    const char* name;
+    threadID_t id;
+    uint8_t priority;
+    bool asleep;
+    bool blocked;
+    uint32_t runTimeUS;
+    uint32_t switches;
+} threadStats_t;
+
 /****************************Data Structure Definitions*****************************/
 
 /********************************Public Variables***********************************/
@@ -1,6 +1,6 @@
 // G8RTOS_IPC.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-18
 // Defines for FIFO functions for interprocess communication
 
 #include "../G8RTOS_IPC.h"
@@ -25,6 +25,7 @@ typedef struct G8RTOS_FIFO_t {
     uint32_t *head;
     uint32_t *tail;
     uint32_t lost_data;
+    uint32_t peak;
     semaphore_t currentSize;
     semaphore_t mutex;
 } G8RTOS_FIFO_t;
@@ -54,6 +55,7 @@ int32_t G8RTOS_InitFIFO(uint32_t FIFO_index) {
         FIFOs[FIFO_index].head = &(FIFOs[FIFO_index].buffer[0]);
         FIFOs[FIFO_index].tail = &(FIFOs[FIFO_index].buffer[0]);
         FIFOs[FIFO_index].lost_data = 0;
+        FIFOs[FIFO_index].peak = 0;
         G8RTOS_InitSemaphore(&FIFOs[FIFO_index].currentSize, 0);
         G8RTOS_InitSemaphore(&FIFOs[FIFO_index].mutex, 1);
 
@@ -121,6 +123,27 @@ int32_t G8RTOS_WriteFIFO(uint32_t FIFO_index, uint32_t data) {
 
     // Increase current size
     G8RTOS_SignalSemaphore(&(FIFOs[FIFO_index].currentSize));
+    if (FIFOs[FIFO_index].currentSize > (int32_t)FIFOs[FIFO_index].peak) {
+        FIFOs[FIFO_index].peak = FIFOs[FIFO_index].currentSize;
+    }
+
+    return 0;
+}
+
+// G8RTOS_GetFIFOStats
+// Gets the words waiting in a FIFO, the most that have waited and the
+// writes lost to a full FIFO.
+// Param "FIFO_index": Index of FIFO block
+// Param fifoStats_t* "stats": destination
+// Return: int32_t, -1 if the index is out of range, 0 if okay
+int32_t G8RTOS_GetFIFOStats(uint32_t FIFO_index, fifoStats_t* stats) {
+    if (FIFO_index >= MAX_NUMBER_OF_FIFOS) {
+        return -1;
+    }
+
+    stats->count = FIFOs[FIFO_index].currentSize;
+    stats->peak = FIFOs[FIFO_index].peak;
+    stats->lost = FIFOs[FIFO_index].lost_data;
 
     return 0;
 }
@@ -1,6 +1,6 @@
 // G8RTOS_Scheduler.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-18
 // Defines for scheduler functions
 
 #include "../G8RTOS_Scheduler.h"
@@ -41,6 +41,13 @@ static uint32_t NumberOfPThreads;
 
 static uint32_t threadCounter = 0;
 
+// SysTick reload value and SysTick counts per microsecond, for G8RTOS_GetTimeUS
+static uint32_t sysTickPeriod = 0;
+static uint32_t ticksPerUS = 1;
+
+// Time of the last context switch, for thread run time
+static uint32_t lastSwitchUS = 0;
+
 /********************************Private Variables**********************************/
 
 /*******************************Private Functions***********************************/
@@ -48,7 +55,9 @@ static uint32_t threadCounter = 0;
 // Occurs every 1 ms.
 static void InitSysTick(void)
 {
-    SysTickPeriodSet(SysCtlClockGet() / 1000);
+    sysTickPeriod = SysCtlClockGet() / 1000;
+    ticksPerUS = SysCtlClockGet() / 1000000;
+    SysTickPeriodSet(sysTickPeriod);
     SysTickIntRegister(SysTick_Handler);
     IntRegister(FAULT_PENDSV, PendSV_Handler);
     SysTickIntEnable();
@@ -124,6 +133,8 @@ int32_t G8RTOS_Launch() {
     InitSysTick();
 
     CurrentlyRunningThread = &threadControlBlocks[0];
+    CurrentlyRunningThread->switches++;
+    lastSwitchUS = G8RTOS_GetTimeUS();
     IntPrioritySet(FAULT_SYSTICK, 0xE0);
     IntPrioritySet(FAULT_PENDSV, 0xE0);
     G8RTOS_Start(); // call the assembly function
@@ -132,10 +143,16 @@ int32_t G8RTOS_Launch() {
 
 // G8RTOS_Scheduler
 // Chooses next thread in the TCB. This time uses priority scheduling.
+// Charges the outgoing thread for the time it ran.
 // Return: void
 void G8RTOS_Scheduler() {
     uint16_t next_thread_priority = UINT8_MAX + 1;
     tcb_t* next_thread = CurrentlyRunningThread->nextTCB;
+    tcb_t* previous_thread = CurrentlyRunningThread;
+    uint32_t nowUS = G8RTOS_GetTimeUS();
+
+    CurrentlyRunningThread->runTimeUS += nowUS - lastSwitchUS;
+    lastSwitchUS = nowUS;
 
     int i = 0;
     for (; i < NumberOfThreads; i++) {
@@ -147,6 +164,10 @@ void G8RTOS_Scheduler() {
         }
         next_thread = next_thread->nextTCB;
     }
+
+    if (CurrentlyRunningThread != previous_thread) {
+        CurrentlyRunningThread->switches++;
+    }
 }
 
 // G8RTOS_AddThread
@@ -199,6 +220,8 @@ sched_ErrCode_t G8RTOS_AddThread(void (*threadToAdd)(void), uint8_t priority, ch
         threadControlBlocks[i].sleepCount = 0;
         threadControlBlocks[i].priority = priority;
         threadControlBlocks[i].isAlive = 1;
+        threadControlBlocks[i].runTimeUS = 0;
+        threadControlBlocks[i].switches = 0;
 
         j = 0;
         while (name[j] != '\0' && j < MAX_NAME_LENGTH - 1) {
@@ -257,7 +280,7 @@ sched_ErrCode_t G8RTOS_Add_APeriodicEvent(void (*AthreadToAdd)(void), uint8_t pr
 // Return: sched_ErrCode_t
 sched_ErrCode_t G8RTOS_Add_PeriodicEvent(void (*PThreadToAdd)(void), uint32_t period, uint32_t execution) {
     // your code
-    if (NumberOfPThreads > MAX_PTHREADS) {
+    if (NumberOfPThreads >= MAX_PTHREADS) {
         return THREAD_LIMIT_REACHED;
     } else {
         if (NumberOfPThreads == 0) {
@@ -352,6 +375,59 @@ sched_ErrCode_t G8RTOS_KillSelf() {
     return NO_ERROR;
 }
 
+// G8RTOS_SetPriority
+// Changes the priority of a live thread. Takes effect at the next switch.
+// Param threadID_t "threadID": ID of the thread
+// Param uint8_t "priority": priority from [0, 255]
+// Return: sched_ErrCode_t
+sched_ErrCode_t G8RTOS_SetPriority(threadID_t threadID, uint8_t priority) {
+    int32_t state = StartCriticalSection();
+    uint32_t i = 0;
+
+    for (i = 0; i < MAX_THREADS; i++) {
+        if (threadControlBlocks[i].isAlive && threadControlBlocks[i].ThreadID == threadID) {
+            threadControlBlocks[i].priority = priority;
+            EndCriticalSection(state);
+            return NO_ERROR;
+        }
+    }
+
+    EndCriticalSection(state);
+    return THREAD_DOES_NOT_EXIST;
+}
+
+// G8RTOS_GetTimeUS
+// Gets system time in microseconds from SystemTime and the SysTick counter.
+// Wraps about every 71 minutes, compare timestamps by signed difference.
+// Return: uint32_t
+uint32_t G8RTOS_GetTimeUS(void) {
+    uint32_t start = 0;
+    uint32_t ms = 0;
+    uint32_t ticks = 0;
+
+    // SysTick isn't running before G8RTOS_Launch
+    if (sysTickPeriod == 0) {
+        return 0;
+    }
+
+    // Retry if a tick lands between the two reads
+    do {
+        start = SystemTime;
+        ms = start;
+        ticks = SysTickValueGet();
+
+        // The counter can reload before its handler runs, always so when
+        // called from PendSV or an ISR above SysTick. Count that tick, and
+        // re-read the counter in case the reload came after the first read.
+        if (HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PENDSTSET) {
+            ticks = SysTickValueGet();
+            ms++;
+        }
+    } while (start != SystemTime);
+
+    return (ms * 1000) + ((sysTickPeriod - 1 - ticks) / ticksPerUS);
+}
+
 // sleep
 // Puts current thread to sleep
 // Param uint32_t "durationMS": how many systicks to sleep for
@@ -374,4 +450,31 @@ threadID_t G8RTOS_GetThreadID(void) {
 uint32_t G8RTOS_GetNumberOfThreads(void) {
     return NumberOfThreads;         //Returns the number of threads
 }
+
+// G8RTOS_GetThreadStats
+// Copies the run time and switch counts of live threads, in TCB order.
+// Param threadStats_t* "stats": destination
+// Param uint32_t "max": entries in stats
+// Return: uint32_t, entries written
+uint32_t G8RTOS_GetThreadStats(threadStats_t* stats, uint32_t max) {
+    uint32_t count = 0;
+    uint32_t i = 0;
+    int32_t state = StartCriticalSection();
+
+    for (i = 0; i < MAX_THREADS && count < max; i++) {
+        if (threadControlBlocks[i].isAlive) {
+            stats[count].name = threadControlBlocks[i].threadName;
+            stats[count].id = threadControlBlocks[i].ThreadID;
+            stats[count].priority = threadControlBlocks[i].priority;
+            stats[count].asleep = threadControlBlocks[i].asleep;
+            stats[count].blocked = (threadControlBlocks[i].blocked != 0);
+            stats[count].runTimeUS = threadControlBlocks[i].runTimeUS;
+            stats[count].switches = threadControlBlocks[i].switches;
+            count++;
+        }
+    }
+
+    EndCriticalSection(state);
+    return count;
+}
 /********************************Public Functions***********************************/
@@ -0,0 +1,231 @@
+// tetris_adpcm.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for the IMA-ADPCM codec. The encoder tracks the decoder's
+// reconstruction, so both stay in step. Decoding a sample is a table load,
+// three conditional adds and two clamps, with the state kept in registers
+// for a whole call.
+
+/************************************Includes***************************************/
+
+#include "../tetris_adpcm.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define ADPCM_INDEX_MAX         88
+
+// Samples the encoder looks ahead when choosing a code. Each one costs 16
+// times the search, the encoder only runs on the host.
+#define ADPCM_LOOKAHEAD         3
+
+/*************************************Defines***************************************/
+
+/*******************************Private Variables***********************************/
+
+static const uint16_t stepTable[ADPCM_INDEX_MAX + 1] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t indexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// TetrisADPCM_Step
+// Applies one code to a predictor and step index.
+// Param int32_t* "predictor": last sample, updated
+// Param int32_t* "index": step table index, updated
+// Param uint8_t "code": 4 bit code, bit 3 is the sign
+// Return: void
+static inline void TetrisADPCM_Step(int32_t* predictor, int32_t* index, uint8_t code) {
+    int32_t step = stepTable[*index];
+    int32_t diff = step >> 3;
+
+    if (code & 4) {
+        diff += step;
+    }
+    if (code & 2) {
+        diff += step >> 1;
+    }
+    if (code & 1) {
+        diff += step >> 2;
+    }
+
+    *predictor += (code & 8) ? -diff : diff;
+    if (*predictor > INT16_MAX) {
+        *predictor = INT16_MAX;
+    } else if (*predictor < INT16_MIN) {
+        *predictor = INT16_MIN;
+    }
+
+    *index += indexTable[code];
+    if (*index < 0) {
+        *index = 0;
+    } else if (*index > ADPCM_INDEX_MAX) {
+        *index = ADPCM_INDEX_MAX;
+    }
+}
+
+// TetrisADPCM_Search
+// Finds the least squared error of coding the next samples from a state.
+// Param const int16_t* "samples": samples to code
+// Param uint32_t "count": samples left, searched up to ADPCM_LOOKAHEAD
+// Param int32_t "predictor": state before the first sample
+// Param int32_t "index": state before the first sample
+// Param uint8_t* "best": the first code of the best path
+// Return: int64_t, error of the best path
+static int64_t TetrisADPCM_Search(const int16_t* samples, uint32_t count, int32_t predictor,
+                                  int32_t index, uint8_t* best) {
+    int64_t bestError = INT64_MAX;
+    int64_t error = 0;
+    int32_t p = 0;
+    int32_t i = 0;
+    uint8_t next = 0;
+    uint8_t code = 0;
+
+    if (count == 0) {
+        return 0;
+    }
+
+    for (code = 0; code < 16; code++) {
+        p = predictor;
+        i = index;
+        TetrisADPCM_Step(&p, &i, code);
+        error = (int64_t)(samples[0] - p) * (samples[0] - p);
+        if (error >= bestError) {
+            continue;
+        }
+        if (count > 1) {
+            error += TetrisADPCM_Search(samples + 1, count - 1, p, i, &next);
+        }
+        if (error < bestError) {
+            bestError = error;
+            *best = code;
+        }
+    }
+
+    return bestError;
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisADPCM_Encode
+// Encodes samples into blocks. Each header holds the state the block
+// starts from. Codes are chosen by the error over the next few samples,
+// which follows square edges far better than quantizing each difference.
+// Param const int16_t* "samples": signed 16 bit input
+// Param uint32_t "count": samples
+// Param uint8_t* "data": output, ADPCM_BYTES(count) long
+// Return: uint32_t, bytes written
+uint32_t TetrisADPCM_Encode(const int16_t* samples, uint32_t count, uint8_t* data) {
+    uint8_t* out = data;
+    int32_t predictor = 0;
+    int32_t index = 0;
+    uint8_t code = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < count; i++) {
+        if ((i % ADPCM_BLOCK_SAMPLES) == 0) {
+            *out++ = (uint8_t)(predictor & 0xFF);
+            *out++ = (uint8_t)((predictor >> 8) & 0xFF);
+            *out++ = (uint8_t)index;
+            *out++ = 0;
+        }
+
+        TetrisADPCM_Search(&samples[i], (count - i < ADPCM_LOOKAHEAD) ? (count - i) : ADPCM_LOOKAHEAD,
+                           predictor, index, &code);
+        TetrisADPCM_Step(&predictor, &index, code);
+
+        if ((i % 2) == 0) {
+            *out = code;
+        } else {
+            *out++ |= (uint8_t)(code << 4);
+        }
+    }
+
+    // Odd count, the last byte has only its low nibble
+    if (count % 2) {
+        out++;
+    }
+
+    return (uint32_t)(out - data);
+}
+
+// TetrisADPCM_Start
+// Points a decoder at the start of an asset.
+// Param adpcmDecoder_t* "decoder": decode state
+// Param const uint8_t* "data": first block
+// Param uint32_t "count": samples in the asset
+// Return: void
+void TetrisADPCM_Start(adpcmDecoder_t* decoder, const uint8_t* data, uint32_t count) {
+    decoder->next = data;
+    decoder->left = count;
+    decoder->blockLeft = 0;
+    decoder->predictor = 0;
+    decoder->index = 0;
+    decoder->high = false;
+}
+
+// TetrisADPCM_Decode
+// Decodes the next samples of an asset, crossing blocks as needed.
+// Param adpcmDecoder_t* "decoder": decode state, advanced
+// Param int16_t* "samples": output
+// Param uint16_t "count": samples wanted
+// Return: uint16_t, samples decoded, fewer at the end of the asset
+uint16_t TetrisADPCM_Decode(adpcmDecoder_t* decoder, int16_t* samples, uint16_t count) {
+    const uint8_t* next = decoder->next;
+    int32_t predictor = decoder->predictor;
+    int32_t index = decoder->index;
+    uint16_t blockLeft = decoder->blockLeft;
+    bool high = decoder->high;
+    uint8_t code = 0;
+    uint16_t n = 0;
+
+    if (count > decoder->left) {
+        count = (uint16_t)decoder->left;
+    }
+
+    for (n = 0; n < count; n++) {
+        if (blockLeft == 0) {
+            predictor = (int16_t)(next[0] | (next[1] << 8));
+            index = (next[2] > ADPCM_INDEX_MAX) ? ADPCM_INDEX_MAX : next[2];
+            next += ADPCM_HEADER_BYTES;
+            blockLeft = ADPCM_BLOCK_SAMPLES;
+            high = false;
+        }
+
+        if (high) {
+            code = *next++ >> 4;
+        } else {
+            code = *next & 0x0F;
+        }
+        high = !high;
+
+        TetrisADPCM_Step(&predictor, &index, code);
+        samples[n] = (int16_t)predictor;
+        blockLeft--;
+    }
+
+    decoder->next = next;
+    decoder->left -= count;
+    decoder->blockLeft = blockLeft;
+    decoder->predictor = predictor;
+    decoder->index = (uint8_t)index;
+    decoder->high = high;
+    return count;
+}
+
+/********************************Public Functions***********************************/
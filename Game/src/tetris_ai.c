@@ -0,0 +1,419 @@
+// tetris_ai.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-19
+// Defines for the Tetris autoplayer. The board is searched as a bitboard,
+// one uint16_t per row with bit j set when column j is occupied, so a
+// collision test for a whole piece row is a single AND.
+
+/************************************Includes***************************************/
+
+#include "../tetris_ai.h"
+
+#include "../../G8RTOS/G8RTOS_Scheduler.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define AI_FULL_ROW         ((1 << BOARD_WIDTH) - 1)
+#define AI_SCORE_MIN        INT32_MIN
+
+/*************************************Defines***************************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// One orientation of a piece inside its 4x4 box
+typedef struct {
+    uint16_t rows[PIECE_SIZE];  // bit j set when box cell (i, j) is filled
+    int8_t left;
+    int8_t right;
+    int8_t top;
+    int8_t bottom;
+    bool duplicate;             // same cells as a lower rotation count
+} aiShape_t;
+
+// First-ply placement of the current piece
+typedef struct {
+    uint8_t rotations;
+    int8_t x;
+    int8_t y;
+    uint8_t lines;
+    int32_t score;
+    uint16_t after[BOARD_HEIGHT];
+} aiCandidate_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/*******************************Private Variables***********************************/
+
+static aiShape_t shapes[7][AI_ROTATIONS];
+
+static aiCandidate_t candidates[AI_MAX_PLACEMENTS];
+static uint8_t order[AI_MAX_PLACEMENTS];
+static uint16_t scratch[BOARD_HEIGHT];
+
+static tetrisAIStats_t aiStats;
+
+static bool aiInitialized = false;
+
+// Set bits in a nibble
+static const uint8_t nibbleBits[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// AI_PopCount
+// Counts set bits in a board row.
+// Return: uint8_t
+static uint8_t AI_PopCount(uint16_t row) {
+    return nibbleBits[row & 0xF] + nibbleBits[(row >> 4) & 0xF] +
+           nibbleBits[(row >> 8) & 0xF] + nibbleBits[(row >> 12) & 0xF];
+}
+
+// AI_Shift
+// Moves a box row mask to board column x.
+// Return: uint16_t
+static uint16_t AI_Shift(uint16_t mask, int8_t x) {
+    return (x >= 0) ? (mask << x) : (mask >> -x);
+}
+
+// AI_BuildShape
+// Converts a 4x4 piece matrix into a row-mask shape.
+// Return: void
+static void AI_BuildShape(uint8_t cells[PIECE_SIZE][PIECE_SIZE], aiShape_t* shape) {
+    int i, j;
+
+    shape->left = PIECE_SIZE;
+    shape->right = -1;
+    shape->top = PIECE_SIZE;
+    shape->bottom = -1;
+    shape->duplicate = false;
+
+    for (i = 0; i < PIECE_SIZE; i++) {
+        shape->rows[i] = 0;
+        for (j = 0; j < PIECE_SIZE; j++) {
+            if (cells[i][j]) {
+                shape->rows[i] |= (1 << j);
+                if (j < shape->left) shape->left = j;
+                if (j > shape->right) shape->right = j;
+                if (i < shape->top) shape->top = i;
+                if (i > shape->bottom) shape->bottom = i;
+            }
+        }
+    }
+}
+
+// AI_SameCells
+// Checks if two shapes cover the same cells once aligned to their corner.
+// Return: bool
+static bool AI_SameCells(aiShape_t* a, aiShape_t* b) {
+    int i;
+
+    if ((a->bottom - a->top) != (b->bottom - b->top)) {
+        return false;
+    }
+
+    for (i = 0; i <= a->bottom - a->top; i++) {
+        if ((a->rows[a->top + i] >> a->left) != (b->rows[b->top + i] >> b->left)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// AI_Fits
+// Checks if a shape fits on the board with its box at (x, y).
+// Return: bool
+static bool AI_Fits(uint16_t* rows, aiShape_t* shape, int8_t x, int8_t y) {
+    int i;
+
+    for (i = shape->top; i <= shape->bottom; i++) {
+        if (y + i >= BOARD_HEIGHT) {
+            return false;
+        }
+        if (rows[y + i] & AI_Shift(shape->rows[i], x)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// AI_Drop
+// Places a shape at column x as a hard drop would, then clears full lines.
+// Param uint16_t* "out": resulting board
+// Return: int, lines cleared or -1 if the shape does not fit at the top
+static int AI_Drop(uint16_t* rows, aiShape_t* shape, int8_t x, int8_t* landing, uint16_t* out) {
+    int8_t y = 0;
+    int i;
+    int lines = 0;
+    int dst;
+
+    if (!AI_Fits(rows, shape, x, 0)) {
+        return -1;
+    }
+    while (AI_Fits(rows, shape, x, y + 1)) {
+        y++;
+    }
+    *landing = y;
+
+    // Place the piece and compact full rows from the bottom up
+    dst = BOARD_HEIGHT - 1;
+    for (i = BOARD_HEIGHT - 1; i >= 0; i--) {
+        uint16_t row = rows[i];
+        if (i >= y + shape->top && i <= y + shape->bottom) {
+            row |= AI_Shift(shape->rows[i - y], x);
+        }
+        if (row == AI_FULL_ROW) {
+            lines++;
+        } else {
+            out[dst--] = row;
+        }
+    }
+    while (dst >= 0) {
+        out[dst--] = 0;
+    }
+
+    return lines;
+}
+
+// AI_Evaluate
+// Scores a board on aggregate height, holes and bumpiness.
+// Return: int32_t
+static int32_t AI_Evaluate(uint16_t* rows) {
+    uint8_t heights[BOARD_WIDTH] = {0};
+    uint16_t covered = 0;
+    int32_t holes = 0;
+    int32_t aggregate = 0;
+    int32_t bumpiness = 0;
+    int y, j;
+
+    for (y = 0; y < BOARD_HEIGHT; y++) {
+        uint16_t newColumns = rows[y] & ~covered;
+
+        holes += AI_PopCount(covered & ~rows[y] & AI_FULL_ROW);
+        for (j = 0; newColumns; j++, newColumns >>= 1) {
+            if (newColumns & 1) {
+                heights[j] = BOARD_HEIGHT - y;
+            }
+        }
+        covered |= rows[y];
+    }
+
+    for (j = 0; j < BOARD_WIDTH; j++) {
+        aggregate += heights[j];
+        if (j > 0) {
+            bumpiness += (heights[j] > heights[j - 1]) ? (heights[j] - heights[j - 1]) : (heights[j - 1] - heights[j]);
+        }
+    }
+
+    return AI_WEIGHT_HEIGHT * aggregate + AI_WEIGHT_HOLES * holes + AI_WEIGHT_BUMPINESS * bumpiness;
+}
+
+// AI_BestFollowUp
+// Finds the best score reachable by placing the given piece on a board.
+// Return: int32_t, AI_SCORE_MIN if the piece cannot be placed
+static int32_t AI_BestFollowUp(uint16_t* rows, uint8_t type, uint32_t* evaluations) {
+    int32_t best = AI_SCORE_MIN;
+    int8_t landing;
+    int8_t x;
+    int r, lines;
+
+    for (r = 0; r < AI_ROTATIONS; r++) {
+        aiShape_t* shape = &shapes[type][r];
+        if (shape->duplicate) {
+            continue;
+        }
+        for (x = -shape->left; x + shape->right < BOARD_WIDTH; x++) {
+            lines = AI_Drop(rows, shape, x, &landing, scratch);
+            if (lines < 0) {
+                continue;
+            }
+            (*evaluations)++;
+
+            int32_t score = AI_Evaluate(scratch) + AI_WEIGHT_LINES * lines;
+            if (score > best) {
+                best = score;
+            }
+        }
+    }
+
+    return best;
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisAI_Init
+// Builds row-mask tables for every piece orientation. Rotations follow
+// RotatePiece so a move can be replayed with clockwise rotate inputs.
+// Return: void
+void TetrisAI_Init(void) {
+    uint8_t cells[PIECE_SIZE][PIECE_SIZE];
+    uint8_t rotated[PIECE_SIZE][PIECE_SIZE];
+    int p, r, q, i, j;
+
+    for (p = 0; p < 7; p++) {
+        for (i = 0; i < PIECE_SIZE; i++) {
+            for (j = 0; j < PIECE_SIZE; j++) {
+                cells[i][j] = PIECES[p][i][j];
+            }
+        }
+
+        for (r = 0; r < AI_ROTATIONS; r++) {
+            AI_BuildShape(cells, &shapes[p][r]);
+            for (q = 0; q < r; q++) {
+                if (!shapes[p][q].duplicate && AI_SameCells(&shapes[p][q], &shapes[p][r])) {
+                    shapes[p][r].duplicate = true;
+                }
+            }
+
+            // Rotate clockwise for the next orientation
+            for (i = 0; i < PIECE_SIZE; i++) {
+                for (j = 0; j < PIECE_SIZE; j++) {
+                    rotated[j][PIECE_SIZE - 1 - i] = cells[i][j];
+                }
+            }
+            for (i = 0; i < PIECE_SIZE; i++) {
+                for (j = 0; j < PIECE_SIZE; j++) {
+                    cells[i][j] = rotated[i][j];
+                }
+            }
+        }
+    }
+
+    aiInitialized = true;
+}
+
+// TetrisAI_FindMove
+// Enumerates all rotation/column placements of the current piece, then
+// refines the most promising ones with every placement of the next piece
+// until the per-piece budget runs out.
+// Param uint8_t "board": game board, CELL_EMPTY for free cells
+// Param uint8_t "currentType": piece type [0..6] in spawn orientation
+// Param uint8_t "nextType": next piece type, 0xFF if unknown
+// Param tetrisMove_t* "move": chosen placement
+// Return: bool, false if the current piece cannot be placed
+bool TetrisAI_FindMove(uint8_t board[BOARD_HEIGHT][BOARD_WIDTH], uint8_t currentType, uint8_t nextType, tetrisMove_t* move) {
+    uint16_t rows[BOARD_HEIGHT];
+    uint32_t start = G8RTOS_GetTimeUS();
+    uint32_t evaluations = 0;
+    uint8_t count = 0;
+    int32_t best = AI_SCORE_MIN;
+    int bestIndex = -1;
+    int8_t x;
+    int r, i, j, lines;
+
+    if (!aiInitialized) {
+        TetrisAI_Init();
+    }
+
+    // Pack the board into row masks
+    for (i = 0; i < BOARD_HEIGHT; i++) {
+        rows[i] = 0;
+        for (j = 0; j < BOARD_WIDTH; j++) {
+            if (board[i][j] != CELL_EMPTY) {
+                rows[i] |= (1 << j);
+            }
+        }
+    }
+
+    // First ply: every placement of the current piece
+    for (r = 0; r < AI_ROTATIONS; r++) {
+        aiShape_t* shape = &shapes[currentType][r];
+        if (shape->duplicate) {
+            continue;
+        }
+        for (x = -shape->left; x + shape->right < BOARD_WIDTH; x++) {
+            aiCandidate_t* c = &candidates[count];
+            lines = AI_Drop(rows, shape, x, &c->y, c->after);
+            if (lines < 0) {
+                continue;
+            }
+            evaluations++;
+
+            c->rotations = r;
+            c->x = x;
+            c->lines = lines;
+            c->score = AI_Evaluate(c->after) + AI_WEIGHT_LINES * lines;
+
+            // Insertion sort, best first, so refinement starts with likely moves
+            i = count;
+            while (i > 0 && candidates[order[i - 1]].score < c->score) {
+                order[i] = order[i - 1];
+                i--;
+            }
+            order[i] = count;
+            count++;
+        }
+    }
+
+    if (count == 0) {
+        return false;
+    }
+
+    // Second ply: refine candidates in order until the budget runs out
+    if (nextType < 7) {
+        for (i = 0; i < count; i++) {
+            if ((evaluations + AI_MAX_PLACEMENTS > AI_EVAL_BUDGET) ||
+                (G8RTOS_GetTimeUS() - start >= AI_TIME_BUDGET_US)) {
+                aiStats.budgetHits++;
+                break;
+            }
+
+            aiCandidate_t* c = &candidates[order[i]];
+            int32_t followUp = AI_BestFollowUp(c->after, nextType, &evaluations);
+            if (followUp == AI_SCORE_MIN) {
+                continue;
+            }
+
+            int32_t score = followUp + AI_WEIGHT_LINES * c->lines;
+            if (score > best) {
+                best = score;
+                bestIndex = order[i];
+            }
+        }
+    }
+
+    // Fall back to the single-ply ranking if nothing was refined
+    if (bestIndex < 0) {
+        bestIndex = order[0];
+        best = candidates[bestIndex].score;
+    }
+
+    move->rotations = candidates[bestIndex].rotations;
+    move->x = candidates[bestIndex].x;
+    move->y = candidates[bestIndex].y;
+    move->score = best;
+
+    aiStats.searches++;
+    aiStats.lastEvaluations = evaluations;
+    aiStats.lastElapsedUS = G8RTOS_GetTimeUS() - start;
+    aiStats.totalEvaluations += evaluations;
+    aiStats.totalElapsedUS += aiStats.lastElapsedUS;
+
+    return true;
+}
+
+// TetrisAI_GetStats
+// Copies the search statistics.
+// Param tetrisAIStats_t* "stats": destination
+// Return: void
+void TetrisAI_GetStats(tetrisAIStats_t* stats) {
+    *stats = aiStats;
+}
+
+// TetrisAI_GetEvalsPerSecond
+// Gets the average placement evaluation rate over all searches. Searches
+// are timed in SysTick-derived microseconds, since most finish within a
+// few milliseconds and would round to 0 or 1 on SystemTime.
+// Return: uint32_t, placements evaluated per second
+uint32_t TetrisAI_GetEvalsPerSecond(void) {
+    if (aiStats.totalElapsedUS == 0) {
+        return 0;
+    }
+    return (uint32_t)(((uint64_t)aiStats.totalEvaluations * 1000000) / aiStats.totalElapsedUS);
+}
+
+/********************************Public Functions***********************************/
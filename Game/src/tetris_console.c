@@ -0,0 +1,530 @@
+// tetris_console.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-19
+// Defines for the command console. Characters are gathered into one line
+// buffer, which is split in place into arguments and matched against the
+// built in commands, then the caller's table. Tunables are fields of the
+// input, motion, mic and level configurations, read and written through
+// each module's get / set so the module sees a whole new configuration.
+
+/************************************Includes***************************************/
+
+#include "../tetris_console.h"
+#include "../tetris_input.h"
+#include "../tetris_motion.h"
+#include "../tetris_mic.h"
+#include "../tetris_level.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../G8RTOS/G8RTOS_CriticalSection.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define CONSOLE_TUNABLE(name, group, type, field, min, max) \
+    {name, group, sizeof(((type*)0)->field), offsetof(type, field), min, max}
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef enum {
+    CONSOLE_INPUT = 0,
+    CONSOLE_MOTION,
+    CONSOLE_MIC,
+    CONSOLE_LEVEL
+} consoleGroup_t;
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// One field of a module configuration
+typedef struct {
+    const char* name;
+    uint8_t group;
+    uint8_t size;               // 1, 2 or 4 bytes
+    uint16_t offset;
+    uint32_t min;
+    uint32_t max;
+} consoleTunable_t;
+
+typedef union {
+    inputConfig_t input;
+    motionConfig_t motion;
+    micConfig_t mic;
+    levelConfig_t level;
+} consoleConfig_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/*******************************Private Functions***********************************/
+
+static bool Console_Help(uint8_t argc, char** argv);
+static bool Console_Get(uint8_t argc, char** argv);
+static bool Console_Set(uint8_t argc, char** argv);
+static bool Console_Echo(uint8_t argc, char** argv);
+
+/*******************************Private Functions***********************************/
+
+/*******************************Private Variables***********************************/
+
+static const consoleCommand_t builtins[] = {
+    {"help", "list commands", Console_Help},
+    {"get", "[name | group], show tunables", Console_Get},
+    {"set", "name value, change a tunable", Console_Set},
+    {"echo", "[on | off], send typed characters back", Console_Echo}
+};
+
+static const consoleTunable_t tunables[] = {
+    CONSOLE_TUNABLE("input.das", CONSOLE_INPUT, inputConfig_t, dasMS, 0, 1000),
+    CONSOLE_TUNABLE("input.arr", CONSOLE_INPUT, inputConfig_t, arrMS, 0, 1000),
+    CONSOLE_TUNABLE("input.lock", CONSOLE_INPUT, inputConfig_t, lockDelayMS, 0, 5000),
+    CONSOLE_TUNABLE("input.resets", CONSOLE_INPUT, inputConfig_t, lockResets, 0, 255),
+    CONSOLE_TUNABLE("input.press", CONSOLE_INPUT, inputConfig_t, stickPress, 1, 2047),
+    CONSOLE_TUNABLE("input.release", CONSOLE_INPUT, inputConfig_t, stickRelease, 0, 2047),
+    CONSOLE_TUNABLE("input.debounce", CONSOLE_INPUT, inputConfig_t, debounceMS, 0, 100),
+
+    CONSOLE_TUNABLE("motion.enabled", CONSOLE_MOTION, motionConfig_t, enabled, 0, 1),
+    CONSOLE_TUNABLE("motion.odr", CONSOLE_MOTION, motionConfig_t, odr, BMI160_ACC_ODR_25HZ, BMI160_ACC_ODR_1600HZ),
+    CONSOLE_TUNABLE("motion.watermark", CONSOLE_MOTION, motionConfig_t, watermark, 1, MOTION_MAX_FRAMES),
+    CONSOLE_TUNABLE("motion.filter", CONSOLE_MOTION, motionConfig_t, filterShift, 0, 8),
+    CONSOLE_TUNABLE("motion.press", CONSOLE_MOTION, motionConfig_t, tiltPress, 1, 32767),
+    CONSOLE_TUNABLE("motion.release", CONSOLE_MOTION, motionConfig_t, tiltRelease, 0, 32767),
+    CONSOLE_TUNABLE("motion.repeat", CONSOLE_MOTION, motionConfig_t, repeatMS, 0, 2000),
+    CONSOLE_TUNABLE("motion.shake", CONSOLE_MOTION, motionConfig_t, shakeThreshold, 0, 65535),
+    CONSOLE_TUNABLE("motion.holdoff", CONSOLE_MOTION, motionConfig_t, shakeHoldoffMS, 0, 5000),
+
+    CONSOLE_TUNABLE("mic.enabled", CONSOLE_MIC, micConfig_t, enabled, 0, 1),
+    CONSOLE_TUNABLE("mic.peak", CONSOLE_MIC, micConfig_t, clapPeak, 0, 4095),
+    CONSOLE_TUNABLE("mic.crest", CONSOLE_MIC, micConfig_t, clapCrest, 0, 255),
+    CONSOLE_TUNABLE("mic.rise", CONSOLE_MIC, micConfig_t, clapRise, 0, 255),
+    CONSOLE_TUNABLE("mic.holdoff", CONSOLE_MIC, micConfig_t, clapHoldoffMS, 0, 5000),
+    CONSOLE_TUNABLE("mic.tone", CONSOLE_MIC, micConfig_t, toneHz, 0, 8000),
+    CONSOLE_TUNABLE("mic.share", CONSOLE_MIC, micConfig_t, toneShare, 0, 65535),
+    CONSOLE_TUNABLE("mic.rms", CONSOLE_MIC, micConfig_t, toneMinRMS, 0, 4095),
+
+    CONSOLE_TUNABLE("level.speed", CONSOLE_LEVEL, levelConfig_t, speedPercent, 10, 1000),
+    CONSOLE_TUNABLE("level.softdrop", CONSOLE_LEVEL, levelConfig_t, softDropFactor, 1, 100)
+};
+
+static const consoleCommand_t* table = 0;
+static uint8_t tableCount = 0;
+static consolePrint_t print = 0;
+
+static bool echo = CONSOLE_ECHO;
+static consoleStats_t stats;
+
+// Line being typed
+static char line[CONSOLE_LINE_LENGTH];
+static uint8_t length = 0;
+static bool overflow = false;
+static char lastChar = 0;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// Console_Find
+// Looks a command up by name.
+// Return: const consoleCommand_t*, 0 if there is none
+static const consoleCommand_t* Console_Find(const consoleCommand_t* commands, uint8_t count, const char* name) {
+    uint8_t i = 0;
+
+    for (i = 0; i < count; i++) {
+        if (!strcmp(commands[i].name, name)) {
+            return &commands[i];
+        }
+    }
+
+    return 0;
+}
+
+// Console_Load
+// Gets the configuration a tunable belongs to.
+// Return: void
+static void Console_Load(uint8_t group, consoleConfig_t* config) {
+    switch (group) {
+        case CONSOLE_INPUT:
+            TetrisInput_GetConfig(&config->input);
+            break;
+        case CONSOLE_MOTION:
+            TetrisMotion_GetConfig(&config->motion);
+            break;
+        case CONSOLE_LEVEL:
+            TetrisLevel_GetConfig(&config->level);
+            break;
+        default:
+            TetrisMic_GetConfig(&config->mic);
+            break;
+    }
+}
+
+// Console_Store
+// Sets a configuration. Interrupts read them, so they are off meanwhile.
+// Return: void
+static void Console_Store(uint8_t group, consoleConfig_t* config) {
+    int32_t state = StartCriticalSection();
+
+    switch (group) {
+        case CONSOLE_INPUT:
+            TetrisInput_SetConfig(&config->input);
+            break;
+        case CONSOLE_MOTION:
+            TetrisMotion_SetConfig(&config->motion);
+            break;
+        case CONSOLE_LEVEL:
+            TetrisLevel_SetConfig(&config->level);
+            break;
+        default:
+            TetrisMic_SetConfig(&config->mic);
+            break;
+    }
+
+    EndCriticalSection(state);
+}
+
+// Console_Check
+// Checks the fields of a changed configuration against each other. A
+// release threshold at or above its press would never let go.
+// Return: const char*, what is wrong, 0 if it can be stored
+static const char* Console_Check(uint8_t group, const consoleConfig_t* config) {
+    switch (group) {
+        case CONSOLE_INPUT:
+            if (config->input.stickRelease >= config->input.stickPress) {
+                return "input.release must be below input.press";
+            }
+            break;
+        case CONSOLE_MOTION:
+            if (config->motion.tiltRelease >= config->motion.tiltPress) {
+                return "motion.release must be below motion.press";
+            }
+            break;
+        default:
+            break;
+    }
+
+    return 0;
+}
+
+// Console_Read
+// Return: uint32_t, a tunable's value in a configuration
+static uint32_t Console_Read(const consoleTunable_t* tunable, const consoleConfig_t* config) {
+    const uint8_t* field = (const uint8_t*)config + tunable->offset;
+    uint16_t half = 0;
+    uint32_t word = 0;
+
+    switch (tunable->size) {
+        case 1:
+            return *field;
+        case 2:
+            memcpy(&half, field, sizeof(half));
+            return half;
+        default:
+            memcpy(&word, field, sizeof(word));
+            return word;
+    }
+}
+
+// Console_Write
+// Sets a tunable's value in a configuration.
+// Return: void
+static void Console_Write(const consoleTunable_t* tunable, consoleConfig_t* config, uint32_t value) {
+    uint8_t* field = (uint8_t*)config + tunable->offset;
+    uint16_t half = (uint16_t)value;
+
+    switch (tunable->size) {
+        case 1:
+            *field = (uint8_t)value;
+            break;
+        case 2:
+            memcpy(field, &half, sizeof(half));
+            break;
+        default:
+            memcpy(field, &value, sizeof(value));
+            break;
+    }
+}
+
+// Console_Show
+// Prints a tunable with its range.
+// Return: void
+static void Console_Show(const consoleTunable_t* tunable) {
+    consoleConfig_t config;
+
+    Console_Load(tunable->group, &config);
+    print("%s = %u (%u to %u)\n", tunable->name, Console_Read(tunable, &config), tunable->min, tunable->max);
+}
+
+// Console_Help
+// Lists the built in commands and the caller's.
+// Return: bool
+static bool Console_Help(uint8_t argc, char** argv) {
+    uint8_t i = 0;
+
+    for (i = 0; i < sizeof(builtins) / sizeof(builtins[0]); i++) {
+        print("%s: %s\n", builtins[i].name, builtins[i].usage);
+    }
+    for (i = 0; i < tableCount; i++) {
+        print("%s: %s\n", table[i].name, table[i].usage);
+    }
+
+    return true;
+}
+
+// Console_Get
+// Shows every tunable, one by name, or those of a group such as "mic".
+// Return: bool
+static bool Console_Get(uint8_t argc, char** argv) {
+    size_t prefix = (argc > 1) ? strlen(argv[1]) : 0;
+    bool found = false;
+    uint8_t i = 0;
+
+    for (i = 0; i < sizeof(tunables) / sizeof(tunables[0]); i++) {
+        if (argc < 2 || !strcmp(tunables[i].name, argv[1]) ||
+            (!strncmp(tunables[i].name, argv[1], prefix) && tunables[i].name[prefix] == '.')) {
+            Console_Show(&tunables[i]);
+            found = true;
+        }
+    }
+
+    if (!found) {
+        stats.errors++;
+        print("%s: no such tunable or group\n", argv[1]);
+    }
+    return true;
+}
+
+// Console_Set
+// Changes one tunable, checked against its range and the fields it
+// pairs with.
+// Return: bool, false if the arguments are malformed
+static bool Console_Set(uint8_t argc, char** argv) {
+    consoleConfig_t config;
+    const char* problem = 0;
+    uint32_t value = 0;
+    uint8_t i = 0;
+
+    if (argc != 3 || !TetrisConsole_ParseNumber(argv[2], &value)) {
+        return false;
+    }
+
+    for (i = 0; i < sizeof(tunables) / sizeof(tunables[0]); i++) {
+        if (!strcmp(tunables[i].name, argv[1])) {
+            break;
+        }
+    }
+
+    if (i == sizeof(tunables) / sizeof(tunables[0])) {
+        stats.errors++;
+        print("%s: no such tunable, try get\n", argv[1]);
+    } else if (value < tunables[i].min || value > tunables[i].max) {
+        stats.errors++;
+        print("%s: %u to %u\n", tunables[i].name, tunables[i].min, tunables[i].max);
+    } else {
+        Console_Load(tunables[i].group, &config);
+        Console_Write(&tunables[i], &config, value);
+        problem = Console_Check(tunables[i].group, &config);
+        if (problem) {
+            stats.errors++;
+            print("%s\n", problem);
+        } else {
+            Console_Store(tunables[i].group, &config);
+            Console_Show(&tunables[i]);
+        }
+    }
+
+    return true;
+}
+
+// Console_Echo
+// Return: bool
+static bool Console_Echo(uint8_t argc, char** argv) {
+    if (argc > 1 && !TetrisConsole_ParseSwitch(argv[1], &echo)) {
+        return false;
+    }
+
+    print("echo %s\n", echo ? "on" : "off");
+    return true;
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisConsole_Init
+// Sets the caller's commands and where output goes, and prints a prompt.
+// Param const consoleCommand_t* "commands": table, kept
+// Param uint8_t "count": entries in commands
+// Param consolePrint_t "output": prints console output
+// Return: void
+void TetrisConsole_Init(const consoleCommand_t* commands, uint8_t count, consolePrint_t output) {
+    table = commands;
+    tableCount = count;
+    print = output;
+
+    length = 0;
+    overflow = false;
+    memset(&stats, 0, sizeof(stats));
+
+    print("\n" CONSOLE_PROMPT);
+}
+
+// TetrisConsole_GetStats
+// Gets line counts since TetrisConsole_Init.
+// Param consoleStats_t* "current": destination
+// Return: void
+void TetrisConsole_GetStats(consoleStats_t* current) {
+    *current = stats;
+}
+
+// TetrisConsole_Input
+// Adds a received character to the line, running it at the end of the
+// line. Backspace edits, other control characters are ignored.
+// Param char "c": received character
+// Return: void
+void TetrisConsole_Input(char c) {
+    char previous = lastChar;
+
+    lastChar = c;
+
+    // A CR LF pair ends one line
+    if (c == '\r' || c == '\n') {
+        if (c == '\n' && previous == '\r') {
+            return;
+        }
+        if (echo) {
+            print("\n");
+        }
+
+        line[length] = '\0';
+        if (overflow) {
+            stats.overflows++;
+            print("line too long\n");
+        } else {
+            TetrisConsole_Execute(line);
+        }
+
+        length = 0;
+        overflow = false;
+        print(CONSOLE_PROMPT);
+        return;
+    }
+
+    if (c == '\b' || c == 0x7F) {
+        if (length > 0) {
+            length--;
+            if (echo) {
+                print("\b \b");
+            }
+        }
+        return;
+    }
+
+    if (c < ' ' || c > '~') {
+        return;
+    }
+
+    if (length < CONSOLE_LINE_LENGTH - 1) {
+        line[length++] = c;
+        if (echo) {
+            print("%c", c);
+        }
+    } else {
+        overflow = true;
+    }
+}
+
+// TetrisConsole_Execute
+// Splits a line at spaces and runs the command it names. The line is
+// changed in place.
+// Param char* "text": line without its end
+// Return: void
+void TetrisConsole_Execute(char* text) {
+    char* argv[CONSOLE_MAX_ARGS];
+    const consoleCommand_t* command = 0;
+    uint8_t argc = 0;
+
+    while (*text) {
+        while (*text == ' ' || *text == '\t') {
+            *text++ = '\0';
+        }
+        if (*text == '\0') {
+            break;
+        }
+        if (argc == CONSOLE_MAX_ARGS) {
+            stats.errors++;
+            print("too many arguments\n");
+            return;
+        }
+        argv[argc++] = text;
+        while (*text && *text != ' ' && *text != '\t') {
+            text++;
+        }
+    }
+
+    if (argc == 0) {
+        return;
+    }
+    stats.lines++;
+
+    command = Console_Find(builtins, sizeof(builtins) / sizeof(builtins[0]), argv[0]);
+    if (command == 0) {
+        command = Console_Find(table, tableCount, argv[0]);
+    }
+    if (command == 0) {
+        stats.errors++;
+        print("%s: unknown command, try help\n", argv[0]);
+        return;
+    }
+
+    if (!command->run(argc, argv)) {
+        stats.errors++;
+        print("usage: %s %s\n", command->name, command->usage);
+    }
+}
+
+// TetrisConsole_ParseNumber
+// Reads a whole decimal or 0x hexadecimal number.
+// Param const char* "text": argument
+// Param uint32_t* "value": result
+// Return: bool, false if it isn't a number
+bool TetrisConsole_ParseNumber(const char* text, uint32_t* value) {
+    char* end = 0;
+
+    if (*text < '0' || *text > '9') {
+        return false;
+    }
+
+    // A leading 0 alone doesn't make it octal
+    if (text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        *value = (uint32_t)strtoul(&text[2], &end, 16);
+        return text[2] != '\0' && *end == '\0';
+    }
+
+    *value = (uint32_t)strtoul(text, &end, 10);
+    return *end == '\0';
+}
+
+// TetrisConsole_ParseSwitch
+// Reads on / off or 1 / 0.
+// Param const char* "text": argument
+// Param bool* "on": result
+// Return: bool, false if it is neither
+bool TetrisConsole_ParseSwitch(const char* text, bool* on) {
+    if (!strcmp(text, "on") || !strcmp(text, "1")) {
+        *on = true;
+    } else if (!strcmp(text, "off") || !strcmp(text, "0")) {
+        *on = false;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,124 @@
+// tetris_frame.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for COBS frames with a CRC-16. The encoder stuffs as it copies,
+// the decoder unstuffs and checks in one pass, neither keeps state.
+
+/************************************Includes***************************************/
+
+#include "../tetris_frame.h"
+
+#include "driverlib/sw_crc.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// COBS block code of a run of 254 bytes with no zero after it
+#define FRAME_COBS_FULL         0xFF
+
+/*************************************Defines***************************************/
+
+/*******************************Private Functions***********************************/
+
+// Frame_Stuff
+// COBS encodes a buffer. Each block starts with the offset to the next
+// zero, which is dropped, so the output has no zero bytes.
+// Param const uint8_t* "data": input
+// Param uint16_t "length": input bytes
+// Param uint8_t* "out": output, length + length / 254 + 1 bytes
+// Return: uint16_t, bytes written
+static uint16_t Frame_Stuff(const uint8_t* data, uint16_t length, uint8_t* out) {
+    uint8_t* code = out;
+    uint8_t* next = out + 1;
+    uint8_t run = 1;
+    uint16_t i = 0;
+
+    for (i = 0; i < length; i++) {
+        if (data[i] == 0) {
+            *code = run;
+            code = next++;
+            run = 1;
+        } else {
+            *next++ = data[i];
+            if (++run == FRAME_COBS_FULL) {
+                *code = run;
+                code = next++;
+                run = 1;
+            }
+        }
+    }
+    *code = run;
+
+    return (uint16_t)(next - out);
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisFrame_Encode
+// Appends the CRC to the data and builds a frame: delimiter, COBS of the
+// data and CRC, delimiter.
+// Param uint8_t* "raw": data, with FRAME_CRC_BYTES spare bytes after it
+// Param uint16_t "length": data bytes
+// Param uint8_t* "out": FRAME_MAX_ENCODED(length + FRAME_CRC_BYTES) bytes
+// Return: uint16_t, frame bytes
+uint16_t TetrisFrame_Encode(uint8_t* raw, uint16_t length, uint8_t* out) {
+    uint16_t crc = Crc16(0, raw, length);
+    uint16_t n = length;
+
+    raw[n++] = (uint8_t)(crc & 0xFF);
+    raw[n++] = (uint8_t)(crc >> 8);
+
+    out[0] = FRAME_DELIMITER;
+    n = 1 + Frame_Stuff(raw, n, &out[1]);
+    out[n++] = FRAME_DELIMITER;
+
+    return n;
+}
+
+// TetrisFrame_Decode
+// Unstuffs the bytes between two delimiters and checks the CRC.
+// Param const uint8_t* "data": frame bytes without delimiters
+// Param uint16_t "length": bytes
+// Param uint8_t* "out": data and CRC
+// Param uint16_t "size": bytes that fit in out
+// Return: int16_t, data bytes without the CRC, -1 if damaged
+int16_t TetrisFrame_Decode(const uint8_t* data, uint16_t length, uint8_t* out, uint16_t size) {
+    uint16_t i = 0;
+    uint16_t n = 0;
+    uint8_t code = 0;
+    uint8_t j = 0;
+
+    while (i < length) {
+        code = data[i++];
+        if (code == 0) {
+            return -1;
+        }
+        for (j = 1; j < code; j++) {
+            if (i >= length || n >= size) {
+                return -1;
+            }
+            out[n++] = data[i++];
+        }
+        if (code != FRAME_COBS_FULL && i < length) {
+            if (n >= size) {
+                return -1;
+            }
+            out[n++] = 0;
+        }
+    }
+
+    if (n < FRAME_CRC_BYTES) {
+        return -1;
+    }
+    n -= FRAME_CRC_BYTES;
+    if (Crc16(0, out, n) != (uint16_t)(out[n] | (out[n + 1] << 8))) {
+        return -1;
+    }
+
+    return (int16_t)n;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,402 @@
+// tetris_input.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for the input timing engine. All functions take a timestamp in
+// milliseconds (SystemTime) so timing does not depend on how often or how
+// late a thread gets scheduled. The stick classifier is integer only so it
+// can run from a periodic event without touching the FPU.
+// Buttons are debounced by locking each one out for a short time after it
+// changes: the first edge is reported at once, bounces after it are not.
+
+/************************************Includes***************************************/
+
+#include "../tetris_input.h"
+
+#include "../../G8RTOS/G8RTOS_CriticalSection.h"
+
+/************************************Includes***************************************/
+
+/******************************Data Type Definitions********************************/
+
+// Debounce state of one button
+typedef enum {
+    BUTTON_UP = 0,
+    BUTTON_DOWN_LOCKED,         // press reported, changes ignored until unlock
+    BUTTON_DOWN,
+    BUTTON_UP_LOCKED            // release reported, changes ignored until unlock
+} buttonState_t;
+
+/******************************Data Type Definitions********************************/
+
+/*******************************Private Variables***********************************/
+
+static inputConfig_t config = {INPUT_DAS_MS, INPUT_ARR_MS, INPUT_LOCK_DELAY_MS, INPUT_LOCK_RESETS,
+                               INPUT_STICK_PRESS, INPUT_STICK_RELEASE, INPUT_DEBOUNCE_MS};
+
+// Auto-shift state
+static int8_t heldDirection = 0;
+static uint32_t nextRepeat = 0;
+
+// Classified stick axes, -1, 0 or 1 in the sign of the ADC offset
+static int8_t stickX = 0;
+static int8_t stickY = 0;
+
+// Button samples from interrupts, taken by TetrisInput_Buttons
+static volatile uint8_t sampledButtons = 0;
+static volatile bool sampleReady = false;
+static volatile uint32_t edgeTime = 0;
+static volatile bool edgePending = false;
+
+// Debounce state
+static buttonState_t buttonState[INPUT_BUTTONS];
+static uint32_t buttonUnlock[INPUT_BUTTONS];
+static uint8_t pressedButtons = 0;
+
+// Event latency, per source
+static uint32_t latency[INPUT_SOURCES][INPUT_LATENCY_BUCKETS];
+
+// Lock delay state
+static bool grounded = false;
+static bool landed = false;             // grounded at least once since the lowest row was reached
+static int32_t lowestRow = 0;
+static uint32_t lockDeadline = 0;
+static uint8_t resetsLeft = INPUT_LOCK_RESETS;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// Input_Reached
+// Checks if a timestamp has been reached, tolerant of SystemTime wrap.
+// Return: bool
+static bool Input_Reached(uint32_t now, uint32_t deadline) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+// Input_ClassifyAxis
+// Applies press / release hysteresis to one stick axis.
+// Param int8_t "state": current classification
+// Param int16_t "offset": filtered offset from center
+// Return: int8_t, new classification
+static int8_t Input_ClassifyAxis(int8_t state, int16_t offset) {
+    if (offset >= (int16_t)config.stickPress) {
+        return 1;
+    }
+    if (offset <= -(int16_t)config.stickPress) {
+        return -1;
+    }
+    if (state > 0 && offset > (int16_t)config.stickRelease) {
+        return 1;
+    }
+    if (state < 0 && offset < -(int16_t)config.stickRelease) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisInput_Init
+// Clears held direction and lock state.
+// Return: void
+void TetrisInput_Init(void) {
+    uint8_t i = 0;
+
+    heldDirection = 0;
+    stickX = 0;
+    stickY = 0;
+    for (i = 0; i < INPUT_BUTTONS; i++) {
+        buttonState[i] = BUTTON_UP;
+    }
+    pressedButtons = 0;
+    TetrisInput_ResetLatency();
+    TetrisInput_NewPiece();
+}
+
+// TetrisInput_SetConfig
+// Sets DAS, ARR, lock delay timing, stick thresholds and debounce time.
+// Param inputConfig_t* "newConfig": timing to use
+// Return: void
+void TetrisInput_SetConfig(inputConfig_t* newConfig) {
+    config = *newConfig;
+}
+
+// TetrisInput_GetConfig
+// Gets the timing in use.
+// Param inputConfig_t* "current": destination
+// Return: void
+void TetrisInput_GetConfig(inputConfig_t* current) {
+    *current = config;
+}
+
+// TetrisInput_Shift
+// Feeds the current horizontal direction and returns how many cells the
+// piece should shift now. A new direction shifts once immediately, then
+// repeats every ARR after DAS has elapsed. Repeats missed between calls are
+// caught up from the timestamps.
+// Param int8_t "direction": -1, 0 or 1 in board columns
+// Param uint32_t "now": current time in ms
+// Return: int8_t, signed number of cells to shift
+int8_t TetrisInput_Shift(int8_t direction, uint32_t now) {
+    int8_t steps = 0;
+
+    if (direction != heldDirection) {
+        heldDirection = direction;
+        nextRepeat = now + config.dasMS;
+        return direction;
+    }
+
+    if (direction == 0) {
+        return 0;
+    }
+
+    while (Input_Reached(now, nextRepeat) && steps < INPUT_MAX_SHIFT) {
+        steps++;
+        if (config.arrMS == 0) {
+            steps = INPUT_MAX_SHIFT;
+            nextRepeat = now;
+            break;
+        }
+        nextRepeat += config.arrMS;
+    }
+
+    return direction * steps;
+}
+
+// TetrisInput_Stick
+// Classifies a filtered stick position and produces events for changes:
+// a press when an axis passes the press threshold, a release when it
+// falls back under the release threshold, and horizontal repeats on the
+// DAS/ARR timing of TetrisInput_Shift. Nothing is produced while the
+// stick holds still.
+// Param int16_t "x": offset from center, positive moves left on this board
+// Param int16_t "y": offset from center, positive is up
+// Param uint32_t "now": current time in ms
+// Param uint32_t* "events": room for INPUT_MAX_EVENTS events
+// Return: uint8_t, number of events written
+uint8_t TetrisInput_Stick(int16_t x, int16_t y, uint32_t now, uint32_t* events) {
+    int8_t newX = Input_ClassifyAxis(stickX, x);
+    int8_t newY = Input_ClassifyAxis(stickY, y);
+    int8_t steps = TetrisInput_Shift(-newX, now);
+    uint8_t count = 0;
+
+    if (newX != stickX) {
+        if (stickX != 0) {
+            events[count++] = INPUT_EVENT(INPUT_SOURCE_JOYSTICK, INPUT_RELEASE,
+                                          (stickX > 0) ? INPUT_LEFT : INPUT_RIGHT, 0, now);
+        }
+        if (newX != 0) {
+            events[count++] = INPUT_EVENT(INPUT_SOURCE_JOYSTICK, INPUT_PRESS,
+                                          (newX > 0) ? INPUT_LEFT : INPUT_RIGHT, 1, now);
+        }
+        stickX = newX;
+    } else if (steps != 0) {
+        steps = (steps < 0) ? -steps : steps;
+        events[count++] = INPUT_EVENT(INPUT_SOURCE_JOYSTICK, INPUT_REPEAT,
+                                      (newX > 0) ? INPUT_LEFT : INPUT_RIGHT,
+                                      (steps > INPUT_EVENT_MAX_COUNT) ? INPUT_EVENT_MAX_COUNT : steps, now);
+    }
+
+    if (newY != stickY) {
+        if (stickY != 0) {
+            events[count++] = INPUT_EVENT(INPUT_SOURCE_JOYSTICK, INPUT_RELEASE,
+                                          (stickY > 0) ? INPUT_UP : INPUT_DOWN, 0, now);
+        }
+        if (newY != 0) {
+            events[count++] = INPUT_EVENT(INPUT_SOURCE_JOYSTICK, INPUT_PRESS,
+                                          (newY > 0) ? INPUT_UP : INPUT_DOWN, 1, now);
+        }
+        stickY = newY;
+    }
+
+    return count;
+}
+
+// TetrisInput_ButtonEdge
+// Timestamps a button interrupt. Events from the sample that follows
+// carry the time of the first edge.
+// Param uint32_t "now": current time in ms
+// Return: void
+void TetrisInput_ButtonEdge(uint32_t now) {
+    if (!edgePending) {
+        edgeTime = now;
+        edgePending = true;
+    }
+}
+
+// TetrisInput_ButtonSample
+// Stores a reading of the button port, for use from interrupts.
+// Param uint8_t "pressed": set bits are pressed buttons, SW1..SW4 masks
+// Return: void
+void TetrisInput_ButtonSample(uint8_t pressed) {
+    sampledButtons = pressed;
+    sampleReady = true;
+}
+
+// TetrisInput_Buttons
+// Runs the debounce state machines on the latest sample and produces a
+// press or release event for every button that changed.
+// Param uint32_t "now": current time in ms
+// Param uint32_t* "events": room for INPUT_MAX_EVENTS events
+// Return: uint8_t, number of events written
+uint8_t TetrisInput_Buttons(uint32_t now, uint32_t* events) {
+    uint32_t time = now;
+    uint8_t count = 0;
+    uint8_t i = 0;
+    bool down = false;
+    int32_t state = StartCriticalSection();
+
+    if (sampleReady) {
+        pressedButtons = sampledButtons;
+        if (edgePending) {
+            time = edgeTime;
+        }
+        sampleReady = false;
+        edgePending = false;
+    }
+    EndCriticalSection(state);
+
+    for (i = 0; i < INPUT_BUTTONS; i++) {
+        down = (pressedButtons & INPUT_BUTTON_MASK(i)) != 0;
+
+        // Lockouts end first so a change during one is seen right after it
+        if ((buttonState[i] == BUTTON_DOWN_LOCKED || buttonState[i] == BUTTON_UP_LOCKED) &&
+            Input_Reached(now, buttonUnlock[i])) {
+            buttonState[i] = (buttonState[i] == BUTTON_DOWN_LOCKED) ? BUTTON_DOWN : BUTTON_UP;
+        }
+
+        if (buttonState[i] == BUTTON_UP && down) {
+            buttonState[i] = BUTTON_DOWN_LOCKED;
+            buttonUnlock[i] = now + config.debounceMS;
+            events[count++] = INPUT_EVENT(INPUT_SOURCE_BUTTON, INPUT_PRESS, i, 1, time);
+        } else if (buttonState[i] == BUTTON_DOWN && !down) {
+            buttonState[i] = BUTTON_UP_LOCKED;
+            buttonUnlock[i] = now + config.debounceMS;
+            events[count++] = INPUT_EVENT(INPUT_SOURCE_BUTTON, INPUT_RELEASE, i, 0, time);
+        }
+    }
+
+    return count;
+}
+
+// TetrisInput_RecordLatency
+// Adds the time from an event's timestamp to now to the histogram of its
+// source.
+// Param uint32_t "event": event being handled
+// Param uint32_t "now": current time in ms
+// Return: void
+void TetrisInput_RecordLatency(uint32_t event, uint32_t now) {
+    uint32_t elapsed = (now - INPUT_EVENT_TIME(event)) & 0xFFFF;
+    uint8_t bucket = 0;
+
+    while (bucket < INPUT_LATENCY_BUCKETS - 1 && elapsed >= (1u << bucket)) {
+        bucket++;
+    }
+    latency[INPUT_EVENT_SOURCE(event) % INPUT_SOURCES][bucket]++;
+}
+
+// TetrisInput_GetLatency
+// Copies the latency histogram of one source.
+// Param uint8_t "source": inputSource_t
+// Param uint32_t* "histogram": room for INPUT_LATENCY_BUCKETS counts
+// Return: void
+void TetrisInput_GetLatency(uint8_t source, uint32_t* histogram) {
+    uint8_t i = 0;
+
+    for (i = 0; i < INPUT_LATENCY_BUCKETS; i++) {
+        histogram[i] = latency[source % INPUT_SOURCES][i];
+    }
+}
+
+// TetrisInput_ResetLatency
+// Clears the latency histograms.
+// Return: void
+void TetrisInput_ResetLatency(void) {
+    uint8_t i = 0;
+    uint8_t j = 0;
+
+    for (i = 0; i < INPUT_SOURCES; i++) {
+        for (j = 0; j < INPUT_LATENCY_BUCKETS; j++) {
+            latency[i][j] = 0;
+        }
+    }
+}
+
+// TetrisInput_NewPiece
+// Resets lock delay for a freshly spawned piece.
+// Return: void
+void TetrisInput_NewPiece(void) {
+    grounded = false;
+    landed = false;
+    resetsLeft = config.lockResets;
+}
+
+// TetrisInput_Airborne
+// Marks the piece as free to fall.
+// Return: void
+void TetrisInput_Airborne(void) {
+    grounded = false;
+}
+
+// TetrisInput_Grounded
+// Marks the piece as resting on the stack, starting lock delay if it was
+// not already running. Landing on a new lowest row gives a full delay and
+// the reset budget back. Landing again higher up costs a reset, and with
+// none left the old deadline stands, so lifting a piece off the stack and
+// back cannot hold off its lock.
+// Param uint32_t "now": current time in ms
+// Param int32_t "row": row the piece rests on, larger is lower
+// Return: void
+void TetrisInput_Grounded(uint32_t now, int32_t row) {
+    if (grounded) {
+        return;
+    }
+    grounded = true;
+
+    if (!landed || row > lowestRow) {
+        landed = true;
+        lowestRow = row;
+        resetsLeft = config.lockResets;
+        lockDeadline = now + config.lockDelayMS;
+    } else if (resetsLeft > 0) {
+        resetsLeft--;
+        lockDeadline = now + config.lockDelayMS;
+    }
+}
+
+// TetrisInput_LockReset
+// Restarts lock delay after a successful move or rotation of a grounded
+// piece, while resets remain.
+// Param uint32_t "now": current time in ms
+// Return: void
+void TetrisInput_LockReset(uint32_t now) {
+    if (grounded && resetsLeft > 0) {
+        resetsLeft--;
+        lockDeadline = now + config.lockDelayMS;
+    }
+}
+
+// TetrisInput_IsGrounded
+// Return: bool, true while lock delay is running
+bool TetrisInput_IsGrounded(void) {
+    return grounded;
+}
+
+// TetrisInput_LockDue
+// Checks if a grounded piece has used up its lock delay.
+// Param uint32_t "now": current time in ms
+// Return: bool
+bool TetrisInput_LockDue(uint32_t now) {
+    return grounded && Input_Reached(now, lockDeadline);
+}
+
+// TetrisInput_LockDeadline
+// Return: uint32_t, time at which a grounded piece locks
+uint32_t TetrisInput_LockDeadline(void) {
+    return lockDeadline;
+}
+
+/********************************Public Functions***********************************/
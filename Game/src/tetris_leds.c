@@ -0,0 +1,237 @@
+// tetris_leds.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for the LED matrix animations. TetrisLEDs_Update runs as a
+// periodic event and is the only writer of the PCA9956b once the game
+// runs. Game code posts requests, each frame applies them to the driver's
+// shadow image and queues one burst of the registers that changed.
+// Flashes and the game over fade use the chip's group blink / dimming so
+// they cost a few register writes instead of a frame per step.
+
+/************************************Includes***************************************/
+
+#include "../tetris_leds.h"
+
+#include "../../MultimodDrivers/multimod_PCA9956b.h"
+#include "../../G8RTOS/G8RTOS_CriticalSection.h"
+
+/************************************Includes***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef enum {
+    LEDS_EFFECT_NONE = 0,
+    LEDS_EFFECT_FLASH,          // hardware blink of the current pattern
+    LEDS_EFFECT_SWEEP,          // columns lit one after another
+    LEDS_EFFECT_DIM             // group dimming down to off
+} ledsEffect_t;
+
+/******************************Data Type Definitions********************************/
+
+/*******************************Private Variables***********************************/
+
+// Requests from game code, taken by the next frame
+static uint8_t requestPattern[LEDS_SIZE * LEDS_SIZE];
+static volatile bool patternRequested = false;
+static volatile uint8_t flashRequested = 0;
+static volatile bool sweepRequested = false;
+static volatile bool offRequested = false;
+static volatile uint8_t requestIREF = LEDS_IREF;
+static volatile bool irefRequested = false;
+
+// Brightness each cell fades towards, and what it shows now
+static uint8_t target[LEDS_SIZE * LEDS_SIZE];
+static uint8_t brightness[LEDS_SIZE * LEDS_SIZE];
+
+static ledsEffect_t effect = LEDS_EFFECT_NONE;
+static uint16_t effectFrames = 0;
+static uint8_t groupPWM = 0xFF;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// TetrisLEDs_SetGroupMode
+// Puts every matrix channel under group control, or back to individual PWM.
+// Param bool "group": use GRPPWM/GRPFREQ
+// Return: void
+static void TetrisLEDs_SetGroupMode(bool group) {
+    uint8_t i = 0;
+
+    for (i = 0; i < LEDS_SIZE * LEDS_SIZE; i++) {
+        PCA9956b_SetOutputMode(LEDS_FIRST_CHANNEL + i, group ? LEDOUT_PWM_GROUP : LEDOUT_PWM);
+    }
+}
+
+// TetrisLEDs_EndEffect
+// Returns to plain per-channel PWM.
+// Return: void
+static void TetrisLEDs_EndEffect(void) {
+    TetrisLEDs_SetGroupMode(false);
+    PCA9956b_SetGroup(0xFF, 0x00, false);
+    groupPWM = 0xFF;
+    effect = LEDS_EFFECT_NONE;
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisLEDs_Init
+// Sets matrix channels to a fixed current with PWM off. Written by the
+// first TetrisLEDs_Update.
+// Return: void
+void TetrisLEDs_Init(void) {
+    uint8_t i = 0;
+
+    for (i = 0; i < LEDS_SIZE * LEDS_SIZE; i++) {
+        target[i] = 0;
+        brightness[i] = 0;
+        PCA9956b_SetChannel(LEDS_FIRST_CHANNEL + i, 0x00, LEDS_IREF);
+    }
+    effect = LEDS_EFFECT_NONE;
+}
+
+// TetrisLEDs_ShowPattern
+// Fades the matrix to a 4x4 pattern, row-major like PIECES. Ends a
+// game over fade.
+// Param const uint8_t[][] "pattern": nonzero cells are lit
+// Return: void
+void TetrisLEDs_ShowPattern(const uint8_t pattern[LEDS_SIZE][LEDS_SIZE]) {
+    uint8_t row = 0;
+    uint8_t col = 0;
+    int32_t state = StartCriticalSection();
+
+    for (row = 0; row < LEDS_SIZE; row++) {
+        for (col = 0; col < LEDS_SIZE; col++) {
+            requestPattern[LEDS_CHANNEL(row, col) - LEDS_FIRST_CHANNEL] = pattern[row][col] ? 0xFF : 0x00;
+        }
+    }
+    patternRequested = true;
+    EndCriticalSection(state);
+}
+
+// TetrisLEDs_LineClear
+// Blinks the matrix, longer for more lines.
+// Param uint8_t "lines": lines cleared
+// Return: void
+void TetrisLEDs_LineClear(uint8_t lines) {
+    flashRequested = lines;
+}
+
+// TetrisLEDs_LevelUp
+// Sweeps a lit column across the matrix.
+// Return: void
+void TetrisLEDs_LevelUp(void) {
+    sweepRequested = true;
+}
+
+// TetrisLEDs_Off
+// Fades the whole matrix out.
+// Return: void
+void TetrisLEDs_Off(void) {
+    offRequested = true;
+}
+
+// TetrisLEDs_SetIREF
+// Scales the output current of the whole matrix, for ambient light.
+// Param uint8_t "iref": output current, LEDS_IREF is full
+// Return: void
+void TetrisLEDs_SetIREF(uint8_t iref) {
+    requestIREF = iref;
+    irefRequested = true;
+}
+
+/********************************Public Functions***********************************/
+
+/*******************************Periodic Threads***********************************/
+
+// TetrisLEDs_Update
+// Advances effects and fades by one frame and queues the changed registers.
+// Return: void
+void TetrisLEDs_Update(void) {
+    uint8_t i = 0;
+    uint8_t column = 0;
+
+    // Take requests, stronger effects first
+    if (offRequested) {
+        offRequested = false;
+        effect = LEDS_EFFECT_DIM;
+        TetrisLEDs_SetGroupMode(true);
+    } else if (sweepRequested) {
+        sweepRequested = false;
+        if (effect != LEDS_EFFECT_NONE) {
+            TetrisLEDs_EndEffect();
+        }
+        effect = LEDS_EFFECT_SWEEP;
+        effectFrames = 0;
+    } else if (flashRequested) {
+        if (effect == LEDS_EFFECT_NONE || effect == LEDS_EFFECT_FLASH) {
+            effect = LEDS_EFFECT_FLASH;
+            effectFrames = flashRequested * LEDS_FLASH_FRAMES;
+            TetrisLEDs_SetGroupMode(true);
+            PCA9956b_SetGroup(LEDS_FLASH_DUTY, LEDS_FLASH_FREQ, true);
+        }
+        flashRequested = 0;
+    }
+
+    if (irefRequested) {
+        irefRequested = false;
+        for (i = 0; i < LEDS_SIZE * LEDS_SIZE; i++) {
+            PCA9956b_SetIREF(LEDS_FIRST_CHANNEL + i, requestIREF);
+        }
+    }
+
+    if (patternRequested) {
+        for (i = 0; i < LEDS_SIZE * LEDS_SIZE; i++) {
+            target[i] = requestPattern[i];
+        }
+        patternRequested = false;
+        if (effect == LEDS_EFFECT_DIM) {
+            TetrisLEDs_EndEffect();
+        }
+    }
+
+    switch (effect) {
+        case LEDS_EFFECT_FLASH:
+            if (effectFrames == 0 || --effectFrames == 0) {
+                TetrisLEDs_EndEffect();
+            }
+            break;
+        case LEDS_EFFECT_SWEEP:
+            column = (effectFrames / LEDS_SWEEP_FRAMES) % LEDS_SIZE;
+            for (i = 0; i < LEDS_SIZE * LEDS_SIZE; i++) {
+                brightness[i] = ((i / LEDS_SIZE) == column) ? 0xFF : 0x00;
+            }
+            if (++effectFrames >= LEDS_SWEEP_FRAMES * LEDS_SIZE * LEDS_SWEEP_PASSES) {
+                effect = LEDS_EFFECT_NONE;
+            }
+            break;
+        case LEDS_EFFECT_DIM:
+            groupPWM = (groupPWM > LEDS_DIM_STEP) ? (groupPWM - LEDS_DIM_STEP) : 0;
+            PCA9956b_SetGroup(groupPWM, 0x00, false);
+            break;
+        default:
+            break;
+    }
+
+    // Cells fade towards the pattern except while the sweep drives them
+    if (effect != LEDS_EFFECT_SWEEP) {
+        for (i = 0; i < LEDS_SIZE * LEDS_SIZE; i++) {
+            if (brightness[i] < target[i]) {
+                brightness[i] = (target[i] - brightness[i] > LEDS_FADE_STEP) ? (brightness[i] + LEDS_FADE_STEP) : target[i];
+            } else if (brightness[i] > target[i]) {
+                brightness[i] = (brightness[i] - target[i] > LEDS_FADE_STEP) ? (brightness[i] - LEDS_FADE_STEP) : target[i];
+            }
+        }
+    }
+
+    for (i = 0; i < LEDS_SIZE * LEDS_SIZE; i++) {
+        PCA9956b_SetPWM(LEDS_FIRST_CHANNEL + i, brightness[i]);
+    }
+
+    // Only registers that changed go out, nothing at all once settled
+    PCA9956b_FlushAsync();
+}
+
+/*******************************Periodic Threads***********************************/
@@ -0,0 +1,207 @@
+// tetris_level.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-19
+// Defines for level progression and gravity. Gravity is kept as time per
+// row in microseconds. Elapsed time is accumulated and divided by the row
+// time, so several rows can fall in one update at high levels and the
+// remainder carries over without drift.
+
+/************************************Includes***************************************/
+
+#include "../tetris_level.h"
+
+/************************************Includes***************************************/
+
+/*******************************Private Variables***********************************/
+
+// Time per row for each level, (0.8 - (level - 1) * 0.007) ^ (level - 1) seconds
+static const uint32_t rowTimeUS[LEVEL_MAX] = {
+    1000000,    // 1
+    793000,     // 2
+    617796,     // 3
+    472729,     // 4
+    355197,     // 5
+    262004,     // 6
+    189677,     // 7
+    134735,     // 8
+    93882,      // 9
+    64152,      // 10
+    42976,      // 11
+    28218,      // 12
+    18153,      // 13
+    11439,      // 14
+    7059,       // 15
+    4264,       // 16
+    2520,       // 17
+    1457,       // 18
+    824,        // 19
+    455         // 20
+};
+
+// Points for 1-4 lines, multiplied by the level they were cleared on
+static const uint16_t linePoints[5] = {0, 40, 100, 300, 1200};
+
+static levelConfig_t config = {LEVEL_SPEED_PERCENT, LEVEL_SOFT_DROP_FACTOR};
+
+static uint8_t level = LEVEL_START;
+static uint32_t lines = 0;
+static uint8_t startingLevel = LEVEL_START;
+
+// Lines already cleared when the level was last set
+static uint32_t startingLines = 0;
+
+// Time since the last row fell
+static uint32_t gravityUS = 0;
+
+/*******************************Private Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisLevel_Init
+// Starts a new game at the given level.
+// Param uint8_t "startLevel": first level, 1 to LEVEL_MAX
+// Return: void
+void TetrisLevel_Init(uint8_t startLevel) {
+    if (startLevel < 1) {
+        startLevel = 1;
+    }
+    startingLevel = startLevel;
+    level = startLevel;
+    lines = 0;
+    startingLines = 0;
+    gravityUS = 0;
+}
+
+// TetrisLevel_SetLevel
+// Moves a game in progress to a level. Levels advance from there every
+// LEVEL_LINES_PER_LEVEL lines, the line count is kept.
+// Param uint8_t "newLevel": 1 to LEVEL_MAX
+// Return: void
+void TetrisLevel_SetLevel(uint8_t newLevel) {
+    if (newLevel < 1) {
+        newLevel = 1;
+    }
+    startingLevel = newLevel;
+    startingLines = lines;
+    level = newLevel;
+}
+
+// TetrisLevel_SetConfig
+// Sets the drop speeds, taking effect at the next row.
+// Param levelConfig_t* "newConfig": configuration to use, no field 0
+// Return: void
+void TetrisLevel_SetConfig(levelConfig_t* newConfig) {
+    config = *newConfig;
+    if (config.speedPercent == 0) {
+        config.speedPercent = 1;
+    }
+    if (config.softDropFactor == 0) {
+        config.softDropFactor = 1;
+    }
+}
+
+// TetrisLevel_GetConfig
+// Gets the configuration in use.
+// Param levelConfig_t* "current": destination
+// Return: void
+void TetrisLevel_GetConfig(levelConfig_t* current) {
+    *current = config;
+}
+
+// TetrisLevel_AddLines
+// Counts cleared lines, advancing a level every LEVEL_LINES_PER_LEVEL lines.
+// Param uint8_t "cleared": lines cleared by one piece, 0-4
+// Return: uint32_t, points scored
+uint32_t TetrisLevel_AddLines(uint8_t cleared) {
+    uint32_t points = 0;
+    uint32_t reached = 0;
+
+    if (cleared > 4) {
+        cleared = 4;
+    }
+
+    // Score at the level the lines were cleared on
+    points = (uint32_t)linePoints[cleared] * level;
+
+    // Levels keep counting past LEVEL_MAX for scoring, held at the top of uint8_t
+    lines += cleared;
+    reached = startingLevel + ((lines - startingLines) / LEVEL_LINES_PER_LEVEL);
+    if (reached > UINT8_MAX) {
+        reached = UINT8_MAX;
+    }
+    if (reached > level) {
+        level = (uint8_t)reached;
+    }
+
+    return points;
+}
+
+// TetrisLevel_GetLevel
+// Return: uint8_t, current level
+uint8_t TetrisLevel_GetLevel(void) {
+    return level;
+}
+
+// TetrisLevel_GetLines
+// Return: uint32_t, lines cleared this game
+uint32_t TetrisLevel_GetLines(void) {
+    return lines;
+}
+
+// TetrisLevel_GetRowTimeUS
+// Gets the time for a piece to fall one row at the current level.
+// Param bool "softDrop": soft drop is held
+// Return: uint32_t, microseconds per row
+uint32_t TetrisLevel_GetRowTimeUS(bool softDrop) {
+    uint8_t index = level;
+    uint32_t rowTime = 0;
+
+    if (index < 1) {
+        index = 1;
+    } else if (index > LEVEL_MAX) {
+        index = LEVEL_MAX;
+    }
+    rowTime = (uint32_t)(((uint64_t)rowTimeUS[index - 1] * 100) / config.speedPercent);
+
+    if (softDrop) {
+        rowTime /= config.softDropFactor;
+    }
+
+    return (rowTime > 0) ? rowTime : 1;
+}
+
+// TetrisLevel_ResetGravity
+// Restarts the row timer, called when a piece spawns.
+// Return: void
+void TetrisLevel_ResetGravity(void) {
+    gravityUS = 0;
+}
+
+// TetrisLevel_Gravity
+// Advances gravity by elapsed time.
+// Param uint32_t "elapsedUS": time since the last call
+// Param bool "softDrop": soft drop is held
+// Return: uint8_t, whole rows the piece should fall now
+uint8_t TetrisLevel_Gravity(uint32_t elapsedUS, bool softDrop) {
+    uint32_t rowTime = TetrisLevel_GetRowTimeUS(softDrop);
+    uint32_t rows = 0;
+
+    gravityUS += elapsedUS;
+    rows = gravityUS / rowTime;
+    gravityUS -= rows * rowTime;
+
+    return (rows > LEVEL_MAX_ROWS) ? LEVEL_MAX_ROWS : rows;
+}
+
+// TetrisLevel_NextRowUS
+// Gets the time left until gravity moves the piece again.
+// Param bool "softDrop": soft drop is held
+// Return: uint32_t, microseconds
+uint32_t TetrisLevel_NextRowUS(bool softDrop) {
+    uint32_t rowTime = TetrisLevel_GetRowTimeUS(softDrop);
+
+    // Switching to a faster row time can leave the accumulator past it
+    return (gravityUS < rowTime) ? (rowTime - gravityUS) : 0;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,141 @@
+// tetris_light.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for auto-brightness. The OPT3001 converts continuously but only
+// raises its interrupt when the light level leaves a window around the
+// last reading. The interrupt reads the new level over I2C without a
+// thread, moves the window and requests new display and LED brightness.
+
+/************************************Includes***************************************/
+
+#include "../tetris_light.h"
+#include "../tetris_leds.h"
+
+/************************************Includes***************************************/
+
+/*******************************Private Variables***********************************/
+
+// Result register of the last read, written by the I2C interrupt
+static uint16_t result = 0;
+static volatile bool rereadPending = false;
+
+static volatile uint32_t centiLux = 0;
+static volatile uint8_t backlight = 0xFF;
+static volatile bool backlightChanged = false;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// Light_Level
+// Maps a light level to brightness, LIGHT_LEVEL_PER_OCTAVE steps per
+// doubling above LIGHT_DARK_OCTAVE.
+// Param uint32_t "level": hundredths of a lux
+// Return: uint8_t, 0 to 255
+static uint8_t Light_Level(uint32_t level) {
+    int32_t halfOctaves = 0;
+    int32_t brightness = 0;
+
+    // log2 in half octaves from the two leading bits
+    while (level >= 4) {
+        level >>= 1;
+        halfOctaves += 2;
+    }
+    if (level == 3) {
+        halfOctaves++;
+    }
+
+    brightness = (halfOctaves - 2 * LIGHT_DARK_OCTAVE) * LIGHT_LEVEL_PER_OCTAVE / 2;
+    if (brightness < LIGHT_BACKLIGHT_MIN) {
+        return LIGHT_BACKLIGHT_MIN;
+    }
+
+    return (brightness > 0xFF) ? 0xFF : brightness;
+}
+
+// Light_Read
+// Takes a new reading, re-centers the window on it and passes the new
+// brightness on. Runs in the I2C interrupt.
+// Return: void
+static void Light_Read(i2cTransaction_t* transaction) {
+    uint32_t level = 0;
+    uint32_t window = 0;
+    uint8_t brightness = 0;
+    uint32_t iref = 0;
+
+    if (transaction->status == I2C_DONE) {
+        level = OPT3001_ToCentiLux(result);
+        centiLux = level;
+
+        window = level >> LIGHT_WINDOW_SHIFT;
+        if (window < LIGHT_MIN_WINDOW) {
+            window = LIGHT_MIN_WINDOW;
+        }
+        OPT3001_SetLimitsAsync(OPT3001_FromCentiLux((level > window) ? (level - window) : 0),
+                               OPT3001_FromCentiLux(level + window));
+
+        brightness = Light_Level(level);
+        if (brightness != backlight) {
+            backlight = brightness;
+            backlightChanged = true;
+
+            iref = (LEDS_IREF * brightness) / 0xFF;
+            TetrisLEDs_SetIREF((iref < LIGHT_IREF_MIN) ? LIGHT_IREF_MIN : iref);
+        }
+    } else {
+        // INT may still be latched, try again
+        rereadPending = true;
+    }
+
+    if (rereadPending) {
+        rereadPending = false;
+        OPT3001_ReadAsync(&result, Light_Read);
+    }
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisLight_Init
+// Puts the OPT3001 in latched window mode with a window no reading fits
+// in, so the first conversion raises the interrupt and sets brightness.
+// Return: void
+void TetrisLight_Init(void) {
+    OPT3001_SetConfig(LIGHT_CONFIG);
+    OPT3001_SetLowLimit(OPT3001_RESULT_E_MAX, OPT3001_RESULT_R_M);
+    OPT3001_SetHighLimit(OPT3001_RESULT_E_MAX, OPT3001_RESULT_R_M);
+    OPT3001_IntEnable();
+}
+
+// TetrisLight_Handler
+// Starts reading a new light level, call from the OPT3001 pin interrupt.
+// Return: void
+void TetrisLight_Handler(void) {
+    if (!OPT3001_ReadAsync(&result, Light_Read)) {
+        rereadPending = true;
+    }
+}
+
+// TetrisLight_TakeBacklight
+// Gets a display brightness change, once per change.
+// Param uint8_t* "level": new WRDISBV value
+// Return: bool, true if brightness changed since the last call
+bool TetrisLight_TakeBacklight(uint8_t* level) {
+    if (!backlightChanged) {
+        return false;
+    }
+
+    backlightChanged = false;
+    *level = backlight;
+
+    return true;
+}
+
+// TetrisLight_GetLux
+// Return: uint32_t, last light level in hundredths of a lux
+uint32_t TetrisLight_GetLux(void) {
+    return centiLux;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,318 @@
+// tetris_link.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for the board to board link. Reliable messages use go-back-N:
+// up to LINK_WINDOW are in flight, the receiver only takes the next one in
+// order, and when the oldest goes unacknowledged for LINK_RETRANSMIT_MS
+// everything from it on is sent again. Each side picks a session number
+// at start, a new one from the peer means it restarted and its numbering
+// is learned again. Callers serialize.
+
+/************************************Includes***************************************/
+
+#include "../tetris_link.h"
+
+#include <string.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define LINK_WINDOW_MASK        (LINK_WINDOW - 1)
+
+/*************************************Defines***************************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Reliable message kept until acknowledged
+typedef struct {
+    uint8_t type;
+    uint8_t length;
+    uint8_t sends;              // times sent, 1 if never resent
+    uint32_t sentAt;            // ms
+    uint8_t payload[LINK_MAX_PAYLOAD];
+} linkSlot_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/*******************************Private Variables***********************************/
+
+static linkWrite_t writeFrame = 0;
+static linkDeliver_t deliverMessage = 0;
+static linkStats_t stats;
+
+// Our numbering: the oldest message not acknowledged and the next to use
+static uint8_t session = 0;
+static uint8_t unacked = 0;
+static uint8_t nextSeq = 0;
+static linkSlot_t window[LINK_WINDOW];
+
+// Peer numbering, known once a frame other than a reliable one came in
+static bool peerKnown = false;
+static uint8_t peerSession = 0;
+static uint8_t expected = 0;
+
+static bool ackPending = false;
+static uint32_t lastSent = 0;
+static uint32_t lastHeard = 0;
+
+// Frame built here, callers serialize
+static uint8_t raw[LINK_MAX_RAW];
+static uint8_t frame[LINK_MAX_FRAME];
+
+// Bytes since the last delimiter, and the frame they decode to
+static uint8_t rxFrame[LINK_MAX_FRAME];
+static uint16_t rxLength = 0;
+static bool rxOverflow = false;
+static uint8_t rxRaw[LINK_MAX_RAW];
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// Link_Transmit
+// Encodes and writes one frame, acknowledging everything received so far.
+// Param uint8_t "type": type and LINK_RELIABLE
+// Param uint8_t "seq": message number, or the oldest unacknowledged one
+// Param const void* "payload": payload bytes
+// Param uint16_t "length": payload bytes
+// Param uint32_t "now": time in ms
+// Return: bool, false if the transport had no room
+static bool Link_Transmit(uint8_t type, uint8_t seq, const void* payload, uint16_t length, uint32_t now) {
+    uint16_t n = 0;
+
+    raw[0] = type | (peerKnown ? LINK_ACK_VALID : 0);
+    raw[1] = session;
+    raw[2] = seq;
+    raw[3] = expected;
+    if (length) {
+        memcpy(&raw[LINK_HEADER_BYTES], payload, length);
+    }
+
+    n = TetrisFrame_Encode(raw, LINK_HEADER_BYTES + length, frame);
+    if (writeFrame == 0 || !writeFrame(frame, n)) {
+        stats.writeFailures++;
+        return false;
+    }
+
+    stats.framesSent++;
+    stats.bytesSent += n;
+    lastSent = now;
+    ackPending = false;
+    return true;
+}
+
+// Link_Acknowledge
+// Frees the messages the peer has taken. Acknowledgements outside the
+// window are old or from a peer that doesn't know us yet.
+// Param uint8_t "ack": next number the peer expects
+// Param uint32_t "now": time in ms
+// Return: void
+static void Link_Acknowledge(uint8_t ack, uint32_t now) {
+    linkSlot_t* oldest = &window[unacked & LINK_WINDOW_MASK];
+
+    if (ack == unacked || (uint8_t)(ack - unacked) > (uint8_t)(nextSeq - unacked)) {
+        return;
+    }
+
+    // A resent message can't tell which copy was acknowledged
+    if (oldest->sends == 1) {
+        stats.rttMS = now - oldest->sentAt;
+    }
+    unacked = ack;
+}
+
+// Link_Handle
+// Checks a frame, takes its acknowledgement and delivers its message.
+// Param const uint8_t* "data": frame bytes without delimiters
+// Param uint16_t "length": bytes
+// Param uint32_t "now": time in ms
+// Return: void
+static void Link_Handle(const uint8_t* data, uint16_t length, uint32_t now) {
+    int16_t n = TetrisFrame_Decode(data, length, rxRaw, LINK_MAX_RAW);
+    uint8_t type = 0;
+    uint8_t seq = 0;
+
+    if (n < LINK_HEADER_BYTES) {
+        stats.badFrames++;
+        return;
+    }
+
+    type = rxRaw[0];
+    seq = rxRaw[2];
+    stats.framesReceived++;
+
+    // A new session starts from the number any unreliable frame carries
+    if (!peerKnown || rxRaw[1] != peerSession) {
+        if (type & LINK_RELIABLE) {
+            return;
+        }
+        peerKnown = true;
+        peerSession = rxRaw[1];
+        expected = seq;
+        stats.peers++;
+    }
+    lastHeard = now;
+
+    if (type & LINK_ACK_VALID) {
+        Link_Acknowledge(rxRaw[3], now);
+    }
+
+    type &= (uint8_t)~LINK_ACK_VALID;
+    if (type & LINK_RELIABLE) {
+        // Anything but the next in order was delivered already or follows
+        // a loss, go-back-N sends it again. Either way the peer needs to hear.
+        ackPending = true;
+        if (seq != expected) {
+            stats.duplicates++;
+            return;
+        }
+        expected++;
+    } else if (type == LINK_TYPE_ACK) {
+        return;
+    }
+
+    if (deliverMessage) {
+        deliverMessage(type, &rxRaw[LINK_HEADER_BYTES], (uint16_t)(n - LINK_HEADER_BYTES), now);
+    }
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisLink_Init
+// Sets the transport and starts a new session with nothing in flight.
+// Param linkWrite_t "write": sends a whole frame or nothing
+// Param linkDeliver_t "deliver": takes received messages
+// Param uint8_t "number": session number, differs from the last start
+// Return: void
+void TetrisLink_Init(linkWrite_t write, linkDeliver_t deliver, uint8_t number) {
+    writeFrame = write;
+    deliverMessage = deliver;
+    session = number;
+    unacked = 0;
+    nextSeq = 0;
+    peerKnown = false;
+    expected = 0;
+    ackPending = false;
+    rxLength = 0;
+    rxOverflow = false;
+    memset(&stats, 0, sizeof(stats));
+}
+
+// TetrisLink_GetStats
+// Gets frame counts since TetrisLink_Init.
+// Param linkStats_t* "current": destination
+// Return: void
+void TetrisLink_GetStats(linkStats_t* current) {
+    *current = stats;
+}
+
+// TetrisLink_Send
+// Sends a message. Reliable ones are kept and resent until acknowledged,
+// and queue even if the transport is full for now.
+// Param uint8_t "type": 1 to 63, with LINK_RELIABLE if it must arrive
+// Param const void* "payload": payload bytes
+// Param uint16_t "length": payload bytes, at most LINK_MAX_PAYLOAD
+// Param uint32_t "now": time in ms
+// Return: bool, false if the window is full, or an unreliable one wasn't sent
+bool TetrisLink_Send(uint8_t type, const void* payload, uint16_t length, uint32_t now) {
+    linkSlot_t* slot = 0;
+
+    if (length > LINK_MAX_PAYLOAD) {
+        return false;
+    }
+    if (!(type & LINK_RELIABLE)) {
+        return Link_Transmit(type, unacked, payload, length, now);
+    }
+
+    if ((uint8_t)(nextSeq - unacked) >= LINK_WINDOW) {
+        stats.windowFull++;
+        return false;
+    }
+
+    slot = &window[nextSeq & LINK_WINDOW_MASK];
+    slot->type = type;
+    slot->length = (uint8_t)length;
+    slot->sends = 1;
+    slot->sentAt = now;
+    if (length) {
+        memcpy(slot->payload, payload, length);
+    }
+
+    Link_Transmit(type, nextSeq, payload, length, now);
+    nextSeq++;
+    return true;
+}
+
+// TetrisLink_Receive
+// Takes bytes from the transport in any pieces, handling each frame as
+// its closing delimiter arrives.
+// Param const uint8_t* "data": received bytes
+// Param uint32_t "length": bytes
+// Param uint32_t "now": time in ms
+// Return: void
+void TetrisLink_Receive(const uint8_t* data, uint32_t length, uint32_t now) {
+    uint32_t i = 0;
+
+    for (i = 0; i < length; i++) {
+        if (data[i] != FRAME_DELIMITER) {
+            if (rxLength < sizeof(rxFrame)) {
+                rxFrame[rxLength++] = data[i];
+            } else {
+                rxOverflow = true;
+            }
+            continue;
+        }
+
+        if (rxOverflow) {
+            stats.badFrames++;
+        } else if (rxLength > 0) {
+            Link_Handle(rxFrame, rxLength, now);
+        }
+        rxLength = 0;
+        rxOverflow = false;
+    }
+}
+
+// TetrisLink_Update
+// Resends the window once its oldest message is overdue, and acknowledges
+// or keeps the link alive when nothing else went out.
+// Param uint32_t "now": time in ms
+// Return: void
+void TetrisLink_Update(uint32_t now) {
+    linkSlot_t* slot = 0;
+    uint8_t seq = 0;
+
+    if (unacked != nextSeq && (int32_t)(now - window[unacked & LINK_WINDOW_MASK].sentAt) >= LINK_RETRANSMIT_MS) {
+        for (seq = unacked; seq != nextSeq; seq++) {
+            slot = &window[seq & LINK_WINDOW_MASK];
+            if (!Link_Transmit(slot->type, seq, slot->payload, slot->length, now)) {
+                break;
+            }
+            slot->sends++;
+            slot->sentAt = now;
+            stats.retransmits++;
+        }
+    }
+
+    if (ackPending || (int32_t)(now - lastSent) >= LINK_KEEPALIVE_MS) {
+        Link_Transmit(LINK_TYPE_ACK, unacked, 0, 0, now);
+    }
+}
+
+// TetrisLink_IsConnected
+// Param uint32_t "now": time in ms
+// Return: bool, true if the peer was heard within LINK_TIMEOUT_MS
+bool TetrisLink_IsConnected(uint32_t now) {
+    return peerKnown && (int32_t)(now - lastHeard) < LINK_TIMEOUT_MS;
+}
+
+// TetrisLink_Pending
+// Return: uint8_t, reliable messages not yet acknowledged
+uint8_t TetrisLink_Pending(void) {
+    return (uint8_t)(nextSeq - unacked);
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,253 @@
+// tetris_mic.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for mic control. Blocks arrive from the capture interrupt; one
+// pass over a block takes its mean, energy and peak and, with the detector
+// on, a second runs a Goertzel filter at the whistle pitch, all in fixed
+// point. State only changes once per block. Events share the input event
+// format and queue of the joystick, buttons and motion.
+
+/************************************Includes***************************************/
+
+#include "../tetris_mic.h"
+#include "../tetris_input.h"
+
+#include <math.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Goertzel coefficient, 2 cos(w) in Q14
+#define MIC_COEFF_BITS          14
+
+/*************************************Defines***************************************/
+
+/*******************************Private Variables***********************************/
+
+static micConfig_t config = {true, MIC_CLAP_PEAK, MIC_CLAP_CREST, MIC_CLAP_RISE, MIC_CLAP_HOLDOFF_MS,
+                             MIC_TONE_HZ, MIC_TONE_SHARE, MIC_TONE_MIN_RMS};
+
+static uint32_t sampleRate = 0;
+static int32_t coeff = 0;
+static bool toneOn = false;
+
+// Filter state, DC with MIC_DC_SHIFT and background with MIC_FLOOR_SHIFT
+// fraction bits
+static bool primed = false;
+static int32_t dc = 0;
+static uint32_t background = 0;
+
+static uint32_t clapHoldoff = 0;
+static uint8_t toneBlocks = 0;
+static bool tonePressed = false;
+
+static micLevel_t level;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// Mic_Reached
+// Checks if a timestamp has been reached, tolerant of SystemTime wrap.
+// Return: bool
+static bool Mic_Reached(uint32_t now, uint32_t deadline) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+// Mic_Sqrt
+// Return: uint16_t, the integer square root
+static uint16_t Mic_Sqrt(uint32_t value) {
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint16_t)root;
+}
+
+// Mic_SetTone
+// Computes the Goertzel coefficient for the configured pitch.
+// Return: void
+static void Mic_SetTone(void) {
+    const float pi = 3.14159265f;
+
+    coeff = 0;
+    toneOn = (config.toneHz && sampleRate);
+    if (toneOn) {
+        coeff = (int32_t)(2.0f * cosf((2.0f * pi * config.toneHz) / sampleRate) * (1 << MIC_COEFF_BITS));
+    }
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisMic_Init
+// Clears filter and detector state.
+// Param uint32_t "rate": capture sample rate in Hz
+// Return: void
+void TetrisMic_Init(uint32_t rate) {
+    sampleRate = rate;
+    Mic_SetTone();
+
+    primed = false;
+    toneBlocks = 0;
+    tonePressed = false;
+    level.claps = 0;
+    level.blocks = 0;
+}
+
+// TetrisMic_SetConfig
+// Sets thresholds and the whistle pitch.
+// Param micConfig_t* "newConfig": configuration to use
+// Return: void
+void TetrisMic_SetConfig(micConfig_t* newConfig) {
+    config = *newConfig;
+    Mic_SetTone();
+    toneBlocks = 0;
+}
+
+// TetrisMic_GetConfig
+// Gets the configuration in use.
+// Param micConfig_t* "current": destination
+// Return: void
+void TetrisMic_GetConfig(micConfig_t* current) {
+    *current = config;
+}
+
+// TetrisMic_GetLevel
+// Gets the measurements of the last block and the detector counts.
+// Param micLevel_t* "current": destination
+// Return: void
+void TetrisMic_GetLevel(micLevel_t* current) {
+    *current = level;
+}
+
+// TetrisMic_Update
+// Measures a block and produces a hard drop flick for a clap, and a held
+// down press while a whistle lasts.
+// Param const uint16_t* "samples": 12 bit ADC results
+// Param uint16_t "count": samples, even and at most 256
+// Param uint32_t "now": time the block finished, ms
+// Param uint32_t* "events": room for INPUT_MAX_EVENTS events
+// Return: uint8_t, number of events written
+uint8_t TetrisMic_Update(const uint16_t* samples, uint16_t count, uint32_t now, uint32_t* events) {
+    uint32_t sum = 0;
+    uint32_t energy = 0;
+    int32_t offset = 0;
+    int32_t x = 0;
+    int32_t s0 = 0;
+    int32_t s1 = 0;
+    int32_t s2 = 0;
+    int64_t power = 0;
+    uint16_t peak = 0;
+    uint16_t rms = 0;
+    uint16_t i = 0;
+    uint8_t n = 0;
+    bool clap = false;
+    bool tone = false;
+
+    if (count == 0) {
+        return 0;
+    }
+    if (!primed) {
+        for (i = 0; i < count; i++) {
+            sum += samples[i];
+        }
+        dc = (int32_t)(sum / count) << MIC_DC_SHIFT;
+        sum = 0;
+    }
+    offset = dc >> MIC_DC_SHIFT;
+
+    for (i = 0; i < count; i++) {
+        sum += samples[i];
+        x = (int32_t)samples[i] - offset;
+        energy += (uint32_t)(x * x);
+        if (x < 0) {
+            x = -x;
+        }
+        if (x > peak) {
+            peak = (uint16_t)x;
+        }
+    }
+
+    if (toneOn) {
+        for (i = 0; i < count; i++) {
+            s0 = ((int32_t)samples[i] - offset) + (int32_t)(((int64_t)coeff * s1) >> MIC_COEFF_BITS) - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+        power = (int64_t)s1 * s1 + (int64_t)s2 * s2 - ((((int64_t)coeff * s1) >> MIC_COEFF_BITS) * s2);
+    }
+
+    dc += (int32_t)(sum / count) - (dc >> MIC_DC_SHIFT);
+    rms = Mic_Sqrt(energy / count);
+    if (!primed) {
+        background = (uint32_t)rms << MIC_FLOOR_SHIFT;
+        primed = true;
+    }
+
+    level.rms = rms;
+    level.peak = peak;
+    level.background = (uint16_t)(background >> MIC_FLOOR_SHIFT);
+    level.toneShare = 0;
+    level.blocks++;
+
+    // A pure tone on the pitch puts N/2 times the block energy in the bin
+    if (toneOn && energy) {
+        power = (power > 0) ? (power << 9) / ((int64_t)count * energy) : 0;
+        level.toneShare = (power > 0xFFFF) ? 0xFFFF : (uint16_t)power;
+    }
+
+    if (!config.enabled) {
+        return 0;
+    }
+
+    // A clap is loud, short against the block and sudden against the room
+    clap = (peak >= config.clapPeak) && (peak >= (uint32_t)config.clapCrest * rms) &&
+           (peak >= (uint32_t)config.clapRise * level.background);
+    if (clap && Mic_Reached(now, clapHoldoff)) {
+        events[n++] = INPUT_EVENT(INPUT_SOURCE_MIC, INPUT_PRESS, INPUT_UP, 1, now);
+        events[n++] = INPUT_EVENT(INPUT_SOURCE_MIC, INPUT_RELEASE, INPUT_UP, 0, now);
+        clapHoldoff = now + config.clapHoldoffMS;
+        level.claps++;
+    }
+
+    // Claps don't count toward the room level
+    if (!clap) {
+        background += rms - (background >> MIC_FLOOR_SHIFT);
+    }
+
+    tone = toneOn && (level.toneShare >= config.toneShare) && (rms >= config.toneMinRMS);
+    if (tone) {
+        if (toneBlocks < MIC_TONE_BLOCKS) {
+            toneBlocks++;
+        }
+        if (toneBlocks == MIC_TONE_BLOCKS && !tonePressed) {
+            events[n++] = INPUT_EVENT(INPUT_SOURCE_MIC, INPUT_PRESS, INPUT_DOWN, 1, now);
+            tonePressed = true;
+        }
+    } else {
+        toneBlocks = 0;
+        if (tonePressed) {
+            events[n++] = INPUT_EVENT(INPUT_SOURCE_MIC, INPUT_RELEASE, INPUT_DOWN, 0, now);
+            tonePressed = false;
+        }
+    }
+
+    return n;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,163 @@
+// tetris_motion.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for motion control. Frames come from the BMI160 FIFO a burst at
+// a time; tilt is classified once per burst with hysteresis like the
+// joystick, shakes are looked for in every frame. Events share the input
+// event format and queue of the joystick and buttons.
+
+/************************************Includes***************************************/
+
+#include "../tetris_motion.h"
+#include "../tetris_input.h"
+
+/************************************Includes***************************************/
+
+/*******************************Private Variables***********************************/
+
+static motionConfig_t config = {true, MOTION_ODR, MOTION_BWP, MOTION_WATERMARK, MOTION_FILTER_SHIFT,
+                                MOTION_TILT_PRESS, MOTION_TILT_RELEASE, MOTION_REPEAT_MS,
+                                MOTION_SHAKE_THRESHOLD, MOTION_SHAKE_HOLDOFF_MS};
+
+// Filter state, tilt with MOTION_FILTER_SHIFT fraction bits
+static bool primed = false;
+static int32_t tilt = 0;
+static int32_t gravity[3];
+
+// Tilt classification, -1, 0 or 1 in the sign of X
+static int8_t tiltState = 0;
+static uint32_t nextRepeat = 0;
+static uint32_t shakeHoldoff = 0;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// Motion_Reached
+// Checks if a timestamp has been reached, tolerant of SystemTime wrap.
+// Return: bool
+static bool Motion_Reached(uint32_t now, uint32_t deadline) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisMotion_Init
+// Clears filter and classification state.
+// Return: void
+void TetrisMotion_Init(void) {
+    primed = false;
+    tiltState = 0;
+}
+
+// TetrisMotion_SetConfig
+// Sets sensor setup and thresholds. Sensor setup is applied by the
+// caller, see BMI160_ConfigureAccel / BMI160_EnableFIFO.
+// Param motionConfig_t* "newConfig": configuration to use
+// Return: void
+void TetrisMotion_SetConfig(motionConfig_t* newConfig) {
+    config = *newConfig;
+    primed = false;
+}
+
+// TetrisMotion_GetConfig
+// Gets the configuration in use.
+// Param motionConfig_t* "current": destination
+// Return: void
+void TetrisMotion_GetConfig(motionConfig_t* current) {
+    *current = config;
+}
+
+// TetrisMotion_Update
+// Filters a burst of frames and produces tilt press / repeat / release
+// events and a hard drop flick for a shake.
+// Param const int16_t* "frames": X, Y, Z per frame
+// Param uint8_t "count": frames in the burst
+// Param uint32_t "now": time of the interrupt that signaled the burst, ms
+// Param uint32_t* "events": room for INPUT_MAX_EVENTS events
+// Return: uint8_t, number of events written
+uint8_t TetrisMotion_Update(const int16_t* frames, uint8_t count, uint32_t now, uint32_t* events) {
+    uint8_t n = 0;
+    uint8_t i = 0;
+    uint8_t axis = 0;
+    int32_t deviation = 0;
+    int32_t shake = 0;
+    int32_t offset = 0;
+    int8_t newState = 0;
+    uint8_t steps = 0;
+
+    if (!config.enabled || count == 0) {
+        return 0;
+    }
+
+    if (!primed) {
+        tilt = frames[0] << config.filterShift;
+        for (axis = 0; axis < 3; axis++) {
+            gravity[axis] = frames[axis] << MOTION_GRAVITY_SHIFT;
+        }
+        primed = true;
+    }
+
+    for (i = 0; i < count; i++, frames += 3) {
+        tilt += frames[0] - (tilt >> config.filterShift);
+
+        shake = 0;
+        for (axis = 0; axis < 3; axis++) {
+            gravity[axis] += frames[axis] - (gravity[axis] >> MOTION_GRAVITY_SHIFT);
+            deviation = frames[axis] - (gravity[axis] >> MOTION_GRAVITY_SHIFT);
+            shake += (deviation < 0) ? -deviation : deviation;
+        }
+
+        // A shake flicks up once, then waits for the board to settle
+        if (shake >= config.shakeThreshold && Motion_Reached(now, shakeHoldoff) && n == 0) {
+            events[n++] = INPUT_EVENT(INPUT_SOURCE_MOTION, INPUT_PRESS, INPUT_UP, 1, now);
+            events[n++] = INPUT_EVENT(INPUT_SOURCE_MOTION, INPUT_RELEASE, INPUT_UP, 0, now);
+            shakeHoldoff = now + config.shakeHoldoffMS;
+        }
+    }
+
+    // Shaking swings X around, tilt is left alone until it settles
+    if (!Motion_Reached(now, shakeHoldoff)) {
+        return n;
+    }
+
+    offset = tilt >> config.filterShift;
+    if (offset >= config.tiltPress) {
+        newState = 1;
+    } else if (offset <= -(int32_t)config.tiltPress) {
+        newState = -1;
+    } else if (tiltState > 0 && offset > config.tiltRelease) {
+        newState = 1;
+    } else if (tiltState < 0 && offset < -(int32_t)config.tiltRelease) {
+        newState = -1;
+    }
+
+    // Positive X is the board tipped to the right
+    if (newState != tiltState) {
+        if (tiltState != 0) {
+            events[n++] = INPUT_EVENT(INPUT_SOURCE_MOTION, INPUT_RELEASE,
+                                      (tiltState > 0) ? INPUT_RIGHT : INPUT_LEFT, 0, now);
+        }
+        if (newState != 0) {
+            events[n++] = INPUT_EVENT(INPUT_SOURCE_MOTION, INPUT_PRESS,
+                                      (newState > 0) ? INPUT_RIGHT : INPUT_LEFT, 1, now);
+            nextRepeat = now + config.repeatMS;
+        }
+        tiltState = newState;
+    } else if (tiltState != 0) {
+        while (Motion_Reached(now, nextRepeat) && steps < INPUT_EVENT_MAX_COUNT) {
+            nextRepeat += config.repeatMS;
+            steps++;
+        }
+        if (steps > 0) {
+            events[n++] = INPUT_EVENT(INPUT_SOURCE_MOTION, INPUT_REPEAT,
+                                      (tiltState > 0) ? INPUT_RIGHT : INPUT_LEFT, steps, now);
+        }
+    }
+
+    return n;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,311 @@
+// tetris_music.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for the music sequencer. Runs inside the audio refill: each block
+// is rendered in chunks that end on the next note event, so notes start
+// within one synth control period of their tick. Game code only sets
+// requests, which the next block takes.
+
+/************************************Includes***************************************/
+
+#include "../tetris_music.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// MIDI note numbers used by the theme
+#define NOTE_C2     36
+#define NOTE_D2     38
+#define NOTE_E2     40
+#define NOTE_A2     45
+#define NOTE_GS4    68
+#define NOTE_A4     69
+#define NOTE_B4     71
+#define NOTE_C5     72
+#define NOTE_D5     74
+#define NOTE_E5     76
+#define NOTE_F5     77
+#define NOTE_G5     79
+#define NOTE_GS5    80
+#define NOTE_A5     81
+
+// Korobeiniki, eight bars each, 16 ticks to a bar
+#define THEME_A \
+    {NOTE_E5, 4}, {NOTE_B4, 2}, {NOTE_C5, 2}, {NOTE_D5, 4}, {NOTE_C5, 2}, {NOTE_B4, 2}, \
+    {NOTE_A4, 4}, {NOTE_A4, 2}, {NOTE_C5, 2}, {NOTE_E5, 4}, {NOTE_D5, 2}, {NOTE_C5, 2}, \
+    {NOTE_B4, 6}, {NOTE_C5, 2}, {NOTE_D5, 4}, {NOTE_E5, 4}, \
+    {NOTE_C5, 4}, {NOTE_A4, 4}, {NOTE_A4, 4}, {MUSIC_REST, 4}, \
+    {MUSIC_REST, 2}, {NOTE_D5, 4}, {NOTE_F5, 2}, {NOTE_A5, 4}, {NOTE_G5, 2}, {NOTE_F5, 2}, \
+    {NOTE_E5, 6}, {NOTE_C5, 2}, {NOTE_E5, 4}, {NOTE_D5, 2}, {NOTE_C5, 2}, \
+    {NOTE_B4, 4}, {NOTE_B4, 2}, {NOTE_C5, 2}, {NOTE_D5, 4}, {NOTE_E5, 4}, \
+    {NOTE_C5, 4}, {NOTE_A4, 4}, {NOTE_A4, 4}, {MUSIC_REST, 4}
+
+#define THEME_B \
+    {NOTE_E5, 8}, {NOTE_C5, 8}, {NOTE_D5, 8}, {NOTE_B4, 8}, \
+    {NOTE_C5, 8}, {NOTE_A4, 8}, {NOTE_GS4, 8}, {NOTE_B4, 4}, {MUSIC_REST, 4}, \
+    {NOTE_E5, 8}, {NOTE_C5, 8}, {NOTE_D5, 8}, {NOTE_B4, 8}, \
+    {NOTE_C5, 4}, {NOTE_E5, 4}, {NOTE_A5, 8}, {NOTE_GS5, 16}
+
+// One bar of bass, eighths alternating between the root and its octave
+#define BASS_BAR(root) \
+    {(root), 2}, {(root) + 12, 2}, {(root), 2}, {(root) + 12, 2}, \
+    {(root), 2}, {(root) + 12, 2}, {(root), 2}, {(root) + 12, 2}
+
+#define BASS_A \
+    BASS_BAR(NOTE_E2), BASS_BAR(NOTE_A2), BASS_BAR(NOTE_E2), BASS_BAR(NOTE_A2), \
+    BASS_BAR(NOTE_D2), BASS_BAR(NOTE_C2), BASS_BAR(NOTE_E2), BASS_BAR(NOTE_A2)
+
+#define BASS_B \
+    BASS_BAR(NOTE_A2), BASS_BAR(NOTE_E2), BASS_BAR(NOTE_A2), BASS_BAR(NOTE_E2), \
+    BASS_BAR(NOTE_A2), BASS_BAR(NOTE_E2), BASS_BAR(NOTE_A2), BASS_BAR(NOTE_E2)
+
+/*************************************Defines***************************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Playback position of one track
+typedef struct {
+    uint16_t index;                 // next note
+    int32_t wait;                   // samples until the next note starts
+    int32_t gate;                   // samples until the sounding note is released
+    bool held;
+} musicTrackState_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/*******************************Private Variables***********************************/
+
+static const synthInstrument_t leadInstrument = {SYNTH_WAVE_SQUARE, 4, 120, 19661, 40, 12000};
+static const synthInstrument_t bassInstrument = {SYNTH_WAVE_TRIANGLE, 4, 160, 22938, 30, 16000};
+
+static const musicNote_t melody[] = {THEME_A, THEME_A, THEME_B};
+static const musicNote_t bass[] = {BASS_A, BASS_A, BASS_B};
+
+static const musicTrack_t theme[MUSIC_TRACKS] = {
+    {melody, sizeof(melody) / sizeof(melody[0]), &leadInstrument},
+    {bass, sizeof(bass) / sizeof(bass[0]), &bassInstrument}
+};
+
+static musicTrackState_t tracks[MUSIC_TRACKS];
+static uint32_t sampleRate = 0;
+static uint32_t tickSamples = 0;
+static uint16_t tempo = 0;
+static bool playing = false;
+static bool paused = false;
+
+// Requests from game code, taken by the next block
+static volatile bool playRequested = false;
+static volatile bool stopRequested = false;
+static volatile bool pauseRequested = false;
+static volatile uint16_t requestBPM = MUSIC_BPM_START;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// TetrisMusic_ReleaseAll
+// Lets every music voice ring out.
+// Return: void
+static void TetrisMusic_ReleaseAll(void) {
+    uint8_t i = 0;
+
+    for (i = 0; i < MUSIC_TRACKS; i++) {
+        TetrisSynth_NoteOff(i);
+        tracks[i].held = false;
+    }
+}
+
+// TetrisMusic_TakeRequests
+// Applies play, stop, pause and tempo requests at a block boundary.
+// Return: void
+static void TetrisMusic_TakeRequests(void) {
+    uint8_t i = 0;
+
+    if (stopRequested) {
+        stopRequested = false;
+        playing = false;
+        TetrisMusic_ReleaseAll();
+    }
+
+    if (playRequested) {
+        playRequested = false;
+        for (i = 0; i < MUSIC_TRACKS; i++) {
+            tracks[i].index = 0;
+            tracks[i].wait = 0;
+            tracks[i].gate = 0;
+        }
+        TetrisMusic_ReleaseAll();
+        playing = true;
+    }
+
+    if (pauseRequested != paused) {
+        paused = pauseRequested;
+        if (paused) {
+            TetrisMusic_ReleaseAll();
+        }
+    }
+
+    // New tempo applies from the next note of each track
+    if (requestBPM != tempo) {
+        tempo = requestBPM;
+        tickSamples = (sampleRate * 60) / ((uint32_t)tempo * MUSIC_TICKS_PER_BEAT);
+    }
+}
+
+// TetrisMusic_Advance
+// Releases notes whose gate ran out and starts every note that is due.
+// Return: int32_t, samples until the next event of any track
+static int32_t TetrisMusic_Advance(void) {
+    musicTrackState_t* t = 0;
+    const musicNote_t* note = 0;
+    int32_t length = 0;
+    int32_t next = 0x7FFFFFFF;
+    uint8_t i = 0;
+
+    for (i = 0; i < MUSIC_TRACKS; i++) {
+        t = &tracks[i];
+
+        if (t->held && t->gate <= 0) {
+            TetrisSynth_NoteOff(i);
+            t->held = false;
+        }
+
+        while (t->wait <= 0) {
+            note = &theme[i].notes[t->index];
+            length = (int32_t)note->ticks * tickSamples;
+
+            t->gate = t->wait + (length * MUSIC_GATE_EIGHTHS) / 8;
+            t->wait += length;
+            if (note->note == MUSIC_REST) {
+                TetrisSynth_NoteOff(i);
+                t->held = false;
+            } else {
+                TetrisSynth_NoteOn(i, note->note, theme[i].instrument);
+                t->held = true;
+            }
+
+            if (++t->index >= theme[i].length) {
+                t->index = 0;
+            }
+        }
+
+        if (t->wait < next) {
+            next = t->wait;
+        }
+        if (t->held && t->gate < next) {
+            next = t->gate;
+        }
+    }
+
+    return next;
+}
+
+// TetrisMusic_Elapse
+// Moves every track forward by rendered samples.
+// Param uint16_t "samples": samples rendered since TetrisMusic_Advance
+// Return: void
+static void TetrisMusic_Elapse(uint16_t samples) {
+    uint8_t i = 0;
+
+    for (i = 0; i < MUSIC_TRACKS; i++) {
+        tracks[i].wait -= samples;
+        tracks[i].gate -= samples;
+    }
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisMusic_Init
+// Sets up the synthesizer for the output rate, stopped.
+// Param uint32_t "rate": output sample rate in Hz
+// Return: void
+void TetrisMusic_Init(uint32_t rate) {
+    sampleRate = rate;
+    TetrisSynth_Init(rate);
+
+    playing = false;
+    paused = false;
+    tempo = 0;
+    requestBPM = MUSIC_BPM_START;
+    TetrisMusic_TakeRequests();
+}
+
+// TetrisMusic_Play
+// Starts the theme from the beginning.
+// Return: void
+void TetrisMusic_Play(void) {
+    pauseRequested = false;
+    playRequested = true;
+}
+
+// TetrisMusic_Stop
+// Stops the theme, notes ring out over their release.
+// Return: void
+void TetrisMusic_Stop(void) {
+    stopRequested = true;
+}
+
+// TetrisMusic_Pause
+// Holds the theme where it is, or resumes it.
+// Param bool "pause": true to hold
+// Return: void
+void TetrisMusic_Pause(bool pause) {
+    pauseRequested = pause;
+}
+
+// TetrisMusic_SetLevel
+// Sets the tempo for a game level.
+// Param uint8_t "level": game level, from 1
+// Return: void
+void TetrisMusic_SetLevel(uint8_t level) {
+    uint32_t bpm = MUSIC_BPM_START + (uint32_t)((level > 1) ? (level - 1) : 0) * MUSIC_BPM_PER_LEVEL;
+
+    requestBPM = (bpm > MUSIC_BPM_MAX) ? MUSIC_BPM_MAX : bpm;
+}
+
+// TetrisMusic_IsPlaying
+// Return: bool, true while the theme runs, paused or not
+bool TetrisMusic_IsPlaying(void) {
+    return playing;
+}
+
+// TetrisMusic_Render
+// Mixes the next block of music into samples. Notes start at the synth
+// control period after their tick.
+// Param int16_t* "samples": word aligned block to mix into
+// Param uint16_t "count": samples, a multiple of SYNTH_CONTROL_SAMPLES
+// Return: void
+void TetrisMusic_Render(int16_t* samples, uint16_t count) {
+    uint16_t done = 0;
+    uint16_t chunk = 0;
+    int32_t next = 0;
+    bool running = false;
+
+    TetrisMusic_TakeRequests();
+    running = playing && !paused;
+
+    while (done < count) {
+        chunk = count - done;
+        if (running) {
+            next = TetrisMusic_Advance();
+            if (next < chunk) {
+                // Whole control periods, the event lands in the last one
+                chunk = ((next + SYNTH_CONTROL_SAMPLES - 1) / SYNTH_CONTROL_SAMPLES) * SYNTH_CONTROL_SAMPLES;
+                if (chunk == 0) {
+                    chunk = SYNTH_CONTROL_SAMPLES;
+                }
+            }
+        }
+
+        TetrisSynth_Render(samples + done, chunk);
+        if (running) {
+            TetrisMusic_Elapse(chunk);
+        }
+        done += chunk;
+    }
+}
+
+/********************************Public Functions***********************************/
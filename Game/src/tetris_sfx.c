@@ -0,0 +1,299 @@
+// tetris_sfx.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for the sound effect mixer. Runs inside the audio refill after
+// the music. Game code posts a trigger by setting a byte, which the next
+// block takes, so posting never waits on audio and needs no critical
+// section. Each voice decodes its clip a chunk at a time, so ADPCM clips
+// stream from flash without a buffer per clip. Chunks are stepped in Q16
+// at the clip's rate and added to the block with saturation.
+
+/************************************Includes***************************************/
+
+#include "../tetris_sfx.h"
+#include "../tetris_dsp.h"
+
+/************************************Includes***************************************/
+
+/****************************Data Structure Definitions*****************************/
+
+typedef struct {
+    const sfxClip_t* clip;          // 0 while the voice is free
+    adpcmDecoder_t decoder;
+    uint32_t fetched;               // clip samples taken into chunks
+    int16_t chunk[SFX_CHUNK_SAMPLES];
+    uint16_t chunkLength;
+    uint32_t position;              // index into the chunk, Q16
+    uint32_t step;                  // clip samples per output sample, Q16
+    uint8_t priority;
+    int16_t gain;                   // Q15
+} sfxVoice_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/*******************************Private Variables***********************************/
+
+// Higher takes voices from lower, equal takes the oldest
+static const uint8_t clipPriority[SFX_CLIPS] = {
+    0,                              // SFX_ROTATE
+    1,                              // SFX_LOCK
+    2,                              // SFX_LINE
+    2,                              // SFX_LEVEL
+    3,                              // SFX_TETRIS
+    4                               // SFX_GAME_OVER
+};
+
+// Clips are normalized, these set the balance with the music
+static const int16_t clipGain[SFX_CLIPS] = {
+    9830,                           // SFX_ROTATE
+    13107,                          // SFX_LOCK
+    14746,                          // SFX_LINE
+    14746,                          // SFX_LEVEL
+    16384,                          // SFX_TETRIS
+    16384                           // SFX_GAME_OVER
+};
+
+static sfxVoice_t voices[SFX_VOICES];
+static uint32_t outputRate = 0;
+static sfxStats_t sfxStats;
+
+// Posted by game code, taken by the next block
+static volatile uint8_t pending[SFX_CLIPS];
+static volatile bool stopRequested = false;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// TetrisSFX_Allocate
+// Finds a voice for a clip: a free one, else the lowest priority voice
+// not above the clip's, the one furthest into its clip on a tie.
+// Param uint8_t "priority": priority of the new clip
+// Return: sfxVoice_t*, 0 if every voice outranks the clip
+static sfxVoice_t* TetrisSFX_Allocate(uint8_t priority) {
+    sfxVoice_t* victim = 0;
+    sfxVoice_t* v = 0;
+    uint8_t i = 0;
+
+    for (i = 0; i < SFX_VOICES; i++) {
+        v = &voices[i];
+        if (!v->clip) {
+            return v;
+        }
+        if (v->priority > priority) {
+            continue;
+        }
+        if (!victim || v->priority < victim->priority ||
+            (v->priority == victim->priority && v->fetched > victim->fetched)) {
+            victim = v;
+        }
+    }
+
+    if (victim) {
+        sfxStats.steals++;
+    } else {
+        sfxStats.drops++;
+    }
+    return victim;
+}
+
+// TetrisSFX_Start
+// Starts a clip on a voice from its first sample.
+// Param sfxId_t "id": clip to start
+// Return: void
+static void TetrisSFX_Start(sfxId_t id) {
+    const sfxClip_t* clip = &sfxClips[id];
+    sfxVoice_t* v = 0;
+
+    sfxStats.triggers++;
+    if (clip->length == 0) {
+        return;
+    }
+
+    v = TetrisSFX_Allocate(clipPriority[id]);
+    if (!v) {
+        return;
+    }
+
+    v->clip = clip;
+    v->fetched = 0;
+    v->chunkLength = 0;
+    v->position = 0;
+    v->step = ((uint32_t)clip->rate << 16) / outputRate;
+    v->priority = clipPriority[id];
+    v->gain = clipGain[id];
+}
+
+// TetrisSFX_Fetch
+// Fills a voice's chunk with the next samples of its clip.
+// Param sfxVoice_t* "v": voice to fill
+// Return: bool, false once the clip has ended
+static bool TetrisSFX_Fetch(sfxVoice_t* v) {
+    const sfxClip_t* clip = v->clip;
+    const int8_t* pcm = 0;
+    uint32_t start = 0;
+    uint16_t count = SFX_CHUNK_SAMPLES;
+    uint16_t i = 0;
+
+    if (clip->length - v->fetched < count) {
+        count = (uint16_t)(clip->length - v->fetched);
+    }
+    if (count == 0) {
+        return false;
+    }
+
+    if (clip->format == SFX_FORMAT_ADPCM) {
+        if (v->fetched == 0) {
+            TetrisADPCM_Start(&v->decoder, (const uint8_t*)clip->data, clip->length);
+        }
+        start = TetrisDSP_Cycles();
+        TetrisADPCM_Decode(&v->decoder, v->chunk, count);
+        sfxStats.decodeCycles += TetrisDSP_Cycles() - start;
+        sfxStats.decoded += count;
+    } else {
+        pcm = (const int8_t*)clip->data + v->fetched;
+        for (i = 0; i < count; i++) {
+            v->chunk[i] = (int16_t)(pcm[i] * 256);
+        }
+    }
+
+    v->fetched += count;
+    v->chunkLength = count;
+    return true;
+}
+
+// TetrisSFX_Next
+// Steps a voice to its next output sample, fetching chunks as they run
+// out, and frees the voice at the end of its clip.
+// Param sfxVoice_t* "v": playing voice
+// Param uint32_t* "position": the voice's chunk position, advanced
+// Return: int16_t, the sample scaled by the voice's gain, 0 once ended
+static inline int16_t TetrisSFX_Next(sfxVoice_t* v, uint32_t* position) {
+    int16_t sample = 0;
+
+    while ((*position >> 16) >= v->chunkLength) {
+        if (!v->clip) {
+            return 0;
+        }
+        *position -= (uint32_t)v->chunkLength << 16;
+        if (!TetrisSFX_Fetch(v)) {
+            v->clip = 0;
+            return 0;
+        }
+    }
+
+    sample = (int16_t)(((int32_t)v->chunk[*position >> 16] * v->gain) >> 15);
+    *position += v->step;
+    return sample;
+}
+
+// TetrisSFX_TakeRequests
+// Applies stop and trigger posts at a block boundary.
+// Return: void
+static void TetrisSFX_TakeRequests(void) {
+    uint8_t i = 0;
+
+    if (stopRequested) {
+        stopRequested = false;
+        for (i = 0; i < SFX_VOICES; i++) {
+            voices[i].clip = 0;
+        }
+    }
+
+    // Highest first, so a clip is not stolen by one posted with it
+    for (i = SFX_CLIPS; i > 0; i--) {
+        if (pending[i - 1]) {
+            pending[i - 1] = 0;
+            TetrisSFX_Start((sfxId_t)(i - 1));
+        }
+    }
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisSFX_Init
+// Frees every voice and clears posts and stats.
+// Param uint32_t "rate": output sample rate in Hz
+// Return: void
+void TetrisSFX_Init(uint32_t rate) {
+    uint8_t i = 0;
+
+    outputRate = rate;
+    for (i = 0; i < SFX_VOICES; i++) {
+        voices[i].clip = 0;
+    }
+    for (i = 0; i < SFX_CLIPS; i++) {
+        pending[i] = 0;
+    }
+    stopRequested = false;
+
+    sfxStats.triggers = 0;
+    sfxStats.steals = 0;
+    sfxStats.drops = 0;
+    sfxStats.decoded = 0;
+    sfxStats.decodeCycles = 0;
+    TetrisDSP_CyclesInit();
+}
+
+// TetrisSFX_Play
+// Posts a clip to start with the next block. Safe from any thread or
+// interrupt, a clip posted twice before the block starts once.
+// Param sfxId_t "id": clip to play
+// Return: void
+void TetrisSFX_Play(sfxId_t id) {
+    if (id < SFX_CLIPS) {
+        pending[id] = 1;
+    }
+}
+
+// TetrisSFX_StopAll
+// Cuts every playing clip at the next block.
+// Return: void
+void TetrisSFX_StopAll(void) {
+    stopRequested = true;
+}
+
+// TetrisSFX_GetStats
+// Param sfxStats_t* "stats": filled with the counts since init
+// Return: void
+void TetrisSFX_GetStats(sfxStats_t* stats) {
+    *stats = sfxStats;
+}
+
+// TetrisSFX_Mix
+// Mixes every playing clip into a block, saturating, and frees voices
+// whose clip ended.
+// Param int16_t* "samples": word aligned block to mix into
+// Param uint16_t "count": samples, even
+// Return: void
+void TetrisSFX_Mix(int16_t* samples, uint16_t count) {
+    uint32_t* out = 0;
+    sfxVoice_t* v = 0;
+    uint32_t position = 0;
+    int16_t s0 = 0;
+    int16_t s1 = 0;
+    uint16_t n = 0;
+    uint8_t i = 0;
+
+    TetrisSFX_TakeRequests();
+
+    for (i = 0; i < SFX_VOICES; i++) {
+        v = &voices[i];
+        out = (uint32_t*)samples;
+        position = v->position;
+
+        for (n = 0; n < count && v->clip; n += 2) {
+            s0 = TetrisSFX_Next(v, &position);
+            s1 = TetrisSFX_Next(v, &position);
+
+            *out = TetrisDSP_QAdd16(*out, TetrisDSP_Pack(s0, s1));
+            out++;
+        }
+
+        v->position = position;
+    }
+}
+
+/********************************Public Functions***********************************/
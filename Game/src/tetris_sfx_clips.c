@@ -0,0 +1,661 @@
+// tetris_sfx_clips.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Sound effect clips, IMA-ADPCM at 8000 Hz. Generated by
+// tools/sfx_build.c, edit the scripts there and rebuild this file.
+
+/************************************Includes***************************************/
+
+#include "../tetris_sfx.h"
+
+/************************************Includes***************************************/
+
+/*******************************Private Variables***********************************/
+
+static const uint8_t rotateData[92] = {
+    0x00, 0x00, 0x00, 0x00, 0x77, 0xF7, 0xFF, 0x7F, 0x77, 0x64, 0x8F, 0x0C, 0x07, 0x48, 0xCF, 0x70,
+    0x80, 0xF4, 0xC0, 0x70, 0x08, 0xF8, 0x08, 0x78, 0x00, 0xF8, 0x08, 0x06, 0x08, 0x8F, 0x80, 0x07,
+    0x08, 0x8F, 0x80, 0x07, 0xE8, 0x80, 0x60, 0x08, 0xE8, 0x80, 0x60, 0x08, 0xD8, 0x08, 0x68, 0x08,
+    0x8D, 0x00, 0x85, 0x80, 0x0D, 0x08, 0x04, 0x08, 0x8D, 0x80, 0x85, 0xC0, 0x80, 0x30, 0x80, 0xE0,
+    0x80, 0x40, 0x08, 0xC8, 0x80, 0x84, 0x80, 0x8B, 0x80, 0x05, 0x08, 0x8D, 0x81, 0x83, 0x80, 0x0C,
+    0x48, 0x80, 0xD0, 0x08, 0x21, 0x88, 0xB0, 0x80, 0x58, 0x80, 0xD0, 0x80
+};
+
+static const uint8_t lockData[302] = {
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x11, 0x20, 0x11, 0x21, 0x12, 0x33,
+    0x33, 0x43, 0x33, 0x25, 0x32, 0x43, 0x52, 0x22, 0x33, 0xCB, 0xCB, 0xBB, 0xAD, 0xAA, 0xAC, 0xBB,
+    0xBB, 0xCC, 0xAB, 0xAC, 0xBB, 0xDB, 0xBA, 0xBB, 0xBC, 0xBC, 0xBB, 0xBC, 0xD8, 0x39, 0x33, 0x53,
+    0x42, 0x32, 0x33, 0x43, 0x16, 0x22, 0x22, 0x43, 0x23, 0x43, 0x32, 0x44, 0x21, 0x32, 0x24, 0x34,
+    0x32, 0x13, 0xBC, 0xFF, 0xFF, 0x0A, 0x08, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x02,
+    0x11, 0x11, 0x22, 0x21, 0x43, 0x22, 0x23, 0x43, 0x33, 0x43, 0x25, 0x32, 0x31, 0x43, 0x33, 0x26,
+    0x22, 0x33, 0x43, 0xC0, 0xAE, 0x9A, 0xAA, 0xBA, 0xBB, 0xCB, 0xAD, 0xAB, 0xBC, 0xBA, 0xBB, 0xDC,
+    0xAA, 0xAB, 0xCB, 0xBB, 0xEA, 0xAA, 0xBA, 0xBB, 0xBC, 0xCB, 0xBC, 0xBA, 0xC8, 0xBB, 0xCB, 0xDB,
+    0xAB, 0x0B, 0x43, 0x43, 0x10, 0xB3, 0x32, 0x00, 0x16, 0x23, 0x21, 0x33, 0x42, 0x42, 0x33, 0x33,
+    0x35, 0x32, 0x43, 0x43, 0x33, 0x33, 0x34, 0x34, 0x41, 0x24, 0x23, 0x33, 0x34, 0x43, 0x53, 0x32,
+    0x28, 0x43, 0x33, 0x63, 0xB0, 0xBA, 0xBB, 0xAD, 0x9F, 0x9A, 0xA9, 0xAA, 0xBA, 0xBB, 0xCC, 0xAB,
+    0xBC, 0xBA, 0xBB, 0xBC, 0xAD, 0xBB, 0xBB, 0xBC, 0xC9, 0xAC, 0xBB, 0xBB, 0xAD, 0xBB, 0xCC, 0xAB,
+    0xB2, 0xAC, 0xCB, 0x33, 0x25, 0x32, 0x33, 0x25, 0x17, 0x21, 0x11, 0x22, 0x32, 0x32, 0x44, 0x32,
+    0x33, 0x43, 0x33, 0x43, 0x25, 0x32, 0x33, 0x43, 0x48, 0x52, 0x22, 0x22, 0x33, 0x34, 0x43, 0x24,
+    0x2C, 0xA2, 0xBB, 0xBB, 0xAE, 0xAB, 0xBB, 0xEB, 0x9E, 0x99, 0x9A, 0x9A, 0xBA, 0xBA, 0xCB, 0xAC,
+    0xBB, 0xCA, 0xBA, 0xBB, 0xDC, 0xAA, 0xBB, 0xBB, 0xB4, 0xDB, 0xBA, 0xBA, 0xCB, 0xBB, 0xBC, 0x0F,
+    0x17, 0x10, 0x10, 0x01, 0x22, 0x11, 0x22, 0x42, 0xD3, 0xF3, 0x28, 0x00, 0x07, 0x11, 0x11, 0x11,
+    0x12, 0x22, 0x32, 0x24, 0x21, 0x23, 0x43, 0x33, 0x63, 0x22, 0x32, 0x71, 0x0F, 0x10, 0x10, 0x10,
+    0x11, 0x11, 0x81, 0xF9, 0x9F, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0xA9, 0x8F, 0x88
+};
+
+static const uint8_t lineData[1148] = {
+    0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xF7, 0xFF, 0xFF, 0x7F, 0x80, 0x50, 0x8F, 0xC0, 0x70, 0x80,
+    0x50, 0x8F, 0xC0, 0x70, 0x80, 0x84, 0x8F, 0xC0, 0x70, 0x80, 0x84, 0x8F, 0x80, 0xD0, 0x87, 0x40,
+    0xF8, 0x08, 0x0C, 0x07, 0x48, 0xF8, 0x08, 0x0C, 0x07, 0x48, 0xF8, 0x08, 0x0C, 0x87, 0x40, 0xF8,
+    0x80, 0x0C, 0x87, 0x40, 0xF8, 0x80, 0x80, 0x7D, 0x08, 0x84, 0x0F, 0xC8, 0x70, 0x08, 0x84, 0x0F,
+    0xC8, 0x70, 0x08, 0x88, 0x8F, 0x80, 0x70, 0x00, 0x88, 0x8F, 0x08, 0x70, 0x00, 0x88, 0x8F, 0x80,
+    0x18, 0x07, 0x80, 0xF8, 0x08, 0x08, 0x07, 0x80, 0xF8, 0x08, 0x08, 0x07, 0x08, 0xF8, 0x08, 0x08,
+    0x07, 0x08, 0xF8, 0x08, 0x08, 0x07, 0x08, 0xF8, 0x08, 0x08, 0x70, 0x00, 0x88, 0x8F, 0x80, 0x70,
+    0x80, 0x80, 0x8F, 0x80, 0x70, 0x80, 0x80, 0x8F, 0x80, 0x70, 0x80, 0x80, 0x8F, 0x00, 0x78, 0x80,
+    0x80, 0xF8, 0x08, 0x08, 0xC3, 0xAF, 0x54, 0x00, 0x87, 0x80, 0xF0, 0x80, 0x08, 0x07, 0x88, 0xF0,
+    0x80, 0x80, 0x87, 0x80, 0xF0, 0x80, 0x80, 0x87, 0x80, 0xF0, 0x80, 0x80, 0x87, 0x80, 0x80, 0x0F,
+    0x08, 0x68, 0x80, 0x80, 0x8E, 0x80, 0x60, 0x80, 0x80, 0x8E, 0x00, 0x68, 0x80, 0x80, 0x8E, 0x80,
+    0x60, 0x80, 0x80, 0x8E, 0x00, 0x68, 0x08, 0x80, 0xE8, 0x80, 0x08, 0x86, 0x80, 0xE0, 0x80, 0x80,
+    0x86, 0x80, 0xE0, 0x80, 0x80, 0x86, 0x80, 0xE0, 0x86, 0x40, 0x8F, 0xC0, 0x07, 0x48, 0x8F, 0xC0,
+    0x07, 0x48, 0xCF, 0x70, 0x80, 0xF4, 0x08, 0x7C, 0x80, 0xF4, 0x08, 0x7C, 0x80, 0xF4, 0x0C, 0x07,
+    0x48, 0x0F, 0xC8, 0x87, 0x40, 0x0F, 0xC8, 0x47, 0xF8, 0x08, 0x7C, 0x08, 0xF4, 0x80, 0x7C, 0x48,
+    0xF8, 0xC0, 0x70, 0x08, 0x8F, 0x0C, 0x87, 0x80, 0x8F, 0x0C, 0x87, 0x80, 0x8F, 0x0C, 0x87, 0xF0,
+    0x08, 0x70, 0x80, 0xF8, 0x08, 0x70, 0x80, 0xF8, 0x62, 0xA2, 0x58, 0x00, 0x08, 0x87, 0x80, 0x8F,
+    0x00, 0x87, 0x80, 0x8F, 0x00, 0x87, 0x80, 0x8F, 0x70, 0x08, 0xF8, 0x08, 0x70, 0x08, 0xF8, 0x80,
+    0x70, 0x08, 0xF8, 0x80, 0x87, 0x80, 0x0F, 0x08, 0x87, 0x80, 0x0F, 0x08, 0x87, 0xF0, 0x80, 0x70,
+    0x08, 0xF8, 0x80, 0x70, 0x08, 0xF8, 0x80, 0x70, 0x08, 0x8E, 0x80, 0x07, 0x88, 0x8E, 0x80, 0x87,
+    0x00, 0x8F, 0x60, 0x08, 0xE8, 0x08, 0x78, 0x80, 0xF0, 0x08, 0x78, 0x80, 0xE8, 0x80, 0x86, 0x80,
+    0x0E, 0x88, 0x87, 0x80, 0x0E, 0x08, 0x86, 0x80, 0x0E, 0x68, 0x08, 0xE8, 0x80, 0x60, 0x08, 0xE8,
+    0x80, 0x60, 0x08, 0x0E, 0x08, 0x86, 0x80, 0x0E, 0x08, 0x86, 0x80, 0x0E, 0x08, 0x05, 0xD8, 0x80,
+    0x50, 0x80, 0xE0, 0x80, 0x50, 0x80, 0xD8, 0x80, 0x50, 0x08, 0x0D, 0x08, 0x85, 0x80, 0x0D, 0x08,
+    0x85, 0x80, 0x0D, 0x58, 0x08, 0xD8, 0x80, 0x50, 0x08, 0xD8, 0x80, 0x50, 0xFD, 0x48, 0x58, 0x00,
+    0x81, 0x50, 0x8F, 0x7C, 0x40, 0x8F, 0x7C, 0x84, 0x8F, 0x7C, 0x84, 0x8F, 0x7C, 0x84, 0x8F, 0x7C,
+    0x84, 0xCF, 0x70, 0x84, 0xCF, 0x70, 0x84, 0xCF, 0x70, 0x84, 0xCF, 0x70, 0x84, 0xCF, 0x70, 0x84,
+    0xCF, 0x70, 0x84, 0xCF, 0x70, 0x84, 0xCF, 0x70, 0x08, 0x8F, 0x70, 0x80, 0x8F, 0x0C, 0x87, 0xF0,
+    0x08, 0x87, 0xF0, 0x08, 0x07, 0xF8, 0x08, 0x07, 0xF8, 0x08, 0x07, 0xF8, 0x08, 0x07, 0xF8, 0x08,
+    0x87, 0xF0, 0x08, 0x07, 0xF8, 0x08, 0x07, 0xF8, 0x80, 0x87, 0xF0, 0x80, 0x87, 0xF0, 0x80, 0x87,
+    0xF0, 0x80, 0x87, 0xF0, 0x80, 0x87, 0xF0, 0x80, 0x87, 0xF0, 0x80, 0x70, 0x08, 0x0F, 0x78, 0x08,
+    0x8E, 0x60, 0x08, 0x8E, 0x60, 0x80, 0x8E, 0x60, 0x08, 0x8E, 0x60, 0x80, 0x8E, 0x60, 0x80, 0x8E,
+    0x60, 0x08, 0x0E, 0x68, 0x08, 0x0E, 0x68, 0x08, 0x0E, 0x68, 0x08, 0x0E, 0x68, 0x08, 0x0E, 0x68,
+    0xE6, 0x56, 0x58, 0x00, 0x08, 0x0E, 0x68, 0x08, 0x0E, 0x68, 0x08, 0xE8, 0x80, 0x86, 0xE0, 0x80,
+    0x86, 0xE0, 0x80, 0x86, 0xE0, 0x80, 0x86, 0xE0, 0x80, 0x86, 0xE0, 0x80, 0x05, 0xD8, 0x80, 0x05,
+    0xD8, 0x80, 0x05, 0xD8, 0x80, 0x05, 0xD8, 0x08, 0x05, 0xD8, 0x08, 0x05, 0xD8, 0x80, 0x85, 0xD0,
+    0x80, 0x85, 0xD0, 0x80, 0x85, 0xD0, 0x80, 0x85, 0x80, 0x0D, 0x58, 0x08, 0x0D, 0x58, 0x08, 0x0D,
+    0x58, 0x08, 0x0D, 0x58, 0x81, 0xF4, 0xC8, 0x47, 0x8F, 0x7C, 0xF4, 0x0C, 0x47, 0xCF, 0x70, 0xF4,
+    0x0C, 0x07, 0xF4, 0x7C, 0x84, 0x8F, 0x07, 0xF8, 0x78, 0x80, 0x8F, 0x47, 0xF8, 0x0C, 0x07, 0x8F,
+    0x70, 0xF0, 0x0C, 0x07, 0x8F, 0x70, 0xF0, 0x08, 0x07, 0xCF, 0x70, 0x84, 0x0F, 0x06, 0xF8, 0x78,
+    0x80, 0x8F, 0x87, 0xF0, 0x78, 0x08, 0x8F, 0x70, 0xE8, 0x08, 0x07, 0x8F, 0x70, 0xF0, 0x80, 0x07,
+    0x0F, 0x78, 0x80, 0x0F, 0xC8, 0xA5, 0x57, 0x00, 0x06, 0xF8, 0x78, 0x08, 0x8F, 0x87, 0xF0, 0x78,
+    0x08, 0x8F, 0x87, 0xF0, 0x08, 0x87, 0x8E, 0x70, 0xE8, 0x80, 0x07, 0x0F, 0x78, 0xF0, 0x80, 0x07,
+    0xE8, 0x68, 0x80, 0x0F, 0x86, 0xF0, 0x60, 0x08, 0x0F, 0x05, 0xE8, 0x68, 0x80, 0x8E, 0x60, 0xE0,
+    0x08, 0x06, 0x0E, 0x68, 0xE0, 0x80, 0x06, 0x0E, 0x68, 0x80, 0x0E, 0x85, 0xE0, 0x68, 0x08, 0x8E,
+    0x86, 0xE0, 0x50, 0x08, 0x8E, 0x60, 0xD8, 0x80, 0x86, 0x0D, 0x68, 0xD8, 0x80, 0x06, 0x0E, 0x68,
+    0xC8, 0x08, 0x05, 0xD8, 0x58, 0x80, 0x8D, 0x05, 0xD8, 0x58, 0x08, 0x8D, 0x05, 0xD8, 0x08, 0x05,
+    0x8D, 0x50, 0xD0, 0x08, 0x05, 0x8D, 0x50, 0xD0, 0x08, 0x85, 0x8C, 0x50, 0x80, 0x8D, 0x05, 0xD8,
+    0x40, 0x08, 0x0D, 0x84, 0xD0, 0x40, 0x08, 0x0D, 0x58, 0xC8, 0x80, 0x85, 0x0C, 0x58, 0xC8, 0x80,
+    0x85, 0x0C, 0x58, 0x08, 0x0D, 0x84, 0xD0, 0x40, 0x97, 0x4A, 0x58, 0x00, 0x08, 0x0D, 0x84, 0xD0,
+    0x40, 0x08, 0x0D, 0x84, 0xD0, 0x80, 0x04, 0x0C, 0x48, 0xC0, 0x08, 0x04, 0x8C, 0x40, 0xC0, 0x08,
+    0x84, 0xC0, 0x48, 0x80, 0x0C, 0x03, 0xD8, 0x30, 0x80, 0x0D, 0x03, 0xD8, 0x30, 0x80, 0x0D, 0x48,
+    0xC0, 0x80, 0x84, 0x0B, 0x58, 0xB8, 0x80, 0x04, 0x8C, 0x40, 0x08, 0x0C, 0x83, 0xD0, 0x30, 0x80,
+    0x0D, 0x03, 0xD8, 0x30, 0x08, 0x8C, 0x40, 0xC0, 0x08, 0x84, 0x8B, 0x50, 0xB8, 0x08, 0x04, 0x8C,
+    0x40, 0xB8, 0x08, 0x85, 0xC0, 0x48, 0x08, 0x0C, 0x83, 0xC0, 0x48, 0x80, 0x0C, 0x03, 0xD8, 0x80,
+    0x84, 0x0B, 0x58, 0xB8, 0x80, 0x04, 0x8C, 0x40, 0xB8, 0x08, 0x85, 0x8B, 0x50, 0x08, 0x0C, 0x83,
+    0xD0, 0x30, 0x08, 0x0D, 0x83, 0xC0, 0x48, 0x80, 0x0C, 0x48, 0xB8, 0x80, 0x85, 0x0B, 0x58, 0xB8,
+    0x80, 0x04, 0x8C, 0x40, 0x08, 0x0C, 0x83, 0xD0, 0x30, 0x08, 0x0D, 0x03, 0x77, 0x25, 0x4F, 0x00,
+    0xC8, 0x48, 0x80, 0x0C, 0x03, 0xD8, 0x80, 0x84, 0x0B, 0x58, 0xB8, 0x08, 0x85, 0x8B, 0x50, 0xB8,
+    0x08, 0x85, 0xC0, 0x30, 0x08, 0x0D, 0x83, 0xD0, 0x30, 0x80, 0x0D, 0x03, 0xD8, 0x30, 0x80, 0x0D,
+    0x48, 0xC0, 0x80, 0x84, 0x0B, 0x48, 0xC0, 0x08, 0x84, 0x8B, 0x50, 0x08, 0x8C, 0x84, 0xB0, 0x48,
+    0x80, 0x8C, 0x04, 0xC8, 0x30, 0x80, 0x8C, 0x40, 0xC0, 0x08, 0x84, 0x8B, 0x40, 0xD0, 0x80, 0x04,
+    0x0C, 0x38, 0xC0, 0x08, 0x84, 0xC0, 0x30, 0x80, 0x0D, 0x83, 0xD0, 0x30, 0x80, 0x0D, 0x03, 0xC8,
+    0x08, 0x84, 0x8B, 0x50, 0xB8, 0x08, 0x85, 0x8B, 0x50, 0xB8, 0x08, 0x85, 0x8B, 0x50, 0x08, 0x8C,
+    0x84, 0xC0, 0x30, 0x08, 0x8C, 0x04, 0xC8, 0x30, 0x08, 0x8C, 0x40, 0xB8, 0x08, 0x85, 0x8B, 0x50,
+    0xB8, 0x08, 0x85, 0x8B, 0x50, 0x08, 0x8C, 0x84, 0xC0, 0x30, 0x08, 0x8C, 0x84, 0xC0, 0x30, 0x80,
+    0x8B, 0x11, 0x48, 0x00, 0x8C, 0x84, 0xC0, 0x80, 0x84, 0x0B, 0x58, 0xB8, 0x80, 0x04, 0x0C, 0x48,
+    0xB8, 0x08, 0x85, 0xC0, 0x30, 0x08, 0x8C, 0x84, 0xC0, 0x30, 0x08, 0x0D, 0x83, 0xC0, 0x48, 0x08,
+    0x0C, 0x48, 0xB8, 0x80, 0x04, 0x0C, 0x48, 0xB8, 0x80, 0x85, 0x0B, 0x48, 0x80, 0x0C, 0x03, 0xC8,
+    0x48, 0x80, 0x0C, 0x03, 0xC8, 0x48, 0x08, 0x0C, 0x48, 0xB8, 0x80, 0x85, 0x0B, 0x30, 0xC8, 0x80,
+    0x04, 0x8C, 0x40, 0xB8, 0x00, 0x83, 0xD0, 0x30, 0x08, 0x0D, 0x03, 0xD8, 0x20, 0x80, 0x8A, 0x84,
+    0xC0, 0x80, 0x84, 0x8B, 0x21, 0xB0, 0x80, 0x84, 0x0B, 0x58, 0xB8, 0x08
+};
+
+static const uint8_t levelData[1428] = {
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x77, 0xF7, 0xFF, 0x1F, 0x57, 0xB8, 0xBB, 0x41, 0x34, 0xBB, 0xBC,
+    0x34, 0x13, 0xDB, 0x8B, 0x53, 0x82, 0xCB, 0x1A, 0x53, 0xA2, 0xCB, 0x3A, 0x24, 0xB1, 0xBC, 0x48,
+    0x43, 0xB9, 0xCB, 0x32, 0x34, 0xCB, 0xAB, 0x34, 0x13, 0xCC, 0x0B, 0x24, 0x94, 0xBB, 0x3B, 0x34,
+    0xC3, 0xCB, 0x39, 0x34, 0xC0, 0xBB, 0x50, 0x32, 0xC9, 0xBB, 0x43, 0x33, 0xCC, 0x9A, 0x43, 0x83,
+    0xCB, 0x1C, 0x33, 0xA4, 0xCB, 0x4B, 0x32, 0xC2, 0xBB, 0x48, 0x33, 0xD0, 0xBB, 0x32, 0x35, 0xBB,
+    0xBC, 0x34, 0x13, 0xBC, 0x8B, 0x34, 0x84, 0xBC, 0x2B, 0x34, 0xB4, 0xBB, 0x4B, 0x34, 0xB0, 0xBC,
+    0x30, 0x44, 0xB9, 0xCB, 0x32, 0x34, 0xCB, 0xAB, 0x34, 0x03, 0xBC, 0x0C, 0x24, 0x93, 0xBC, 0x3B,
+    0x34, 0xC3, 0xCB, 0x49, 0x32, 0xC0, 0xBB, 0x41, 0x43, 0xBA, 0xBC, 0x24, 0x23, 0xAC, 0x8C, 0x33,
+    0x03, 0xBD, 0x2B, 0x43, 0x3D, 0x21, 0x4E, 0x00, 0xA4, 0xCB, 0x3A, 0x43, 0xC2, 0xBB, 0x48, 0x33,
+    0xC8, 0xCB, 0x41, 0x33, 0xDB, 0xAA, 0x43, 0x12, 0xCB, 0x0B, 0x43, 0x94, 0xBB, 0x2C, 0x43, 0xB3,
+    0xBC, 0x4A, 0x33, 0xB0, 0xBD, 0x40, 0x33, 0xCA, 0xCB, 0x33, 0x43, 0xAC, 0x9B, 0x53, 0x02, 0xCB,
+    0x1B, 0x43, 0xA3, 0xDB, 0x3B, 0x34, 0xC2, 0xBB, 0x49, 0x43, 0xB8, 0xCB, 0x31, 0x34, 0xCA, 0xBB,
+    0x34, 0x23, 0xCC, 0x9A, 0x34, 0x93, 0xCB, 0x1C, 0x43, 0xA2, 0xCB, 0x3A, 0x34, 0xC1, 0xBB, 0x48,
+    0x43, 0xB9, 0xCB, 0x32, 0x25, 0xBB, 0x9C, 0x33, 0x05, 0xBB, 0x0C, 0x43, 0x93, 0xBC, 0x3B, 0x34,
+    0xC3, 0xCB, 0x39, 0x53, 0xB0, 0xCB, 0x30, 0x34, 0xBA, 0xBC, 0x43, 0x23, 0xBC, 0x9B, 0x34, 0x04,
+    0xAC, 0x0B, 0x34, 0xA3, 0xBC, 0x3C, 0x43, 0xB1, 0xCB, 0x49, 0x33, 0xC8, 0xCB, 0x31, 0x34, 0xBB,
+    0xBC, 0x34, 0x13, 0xBC, 0x8B, 0x44, 0x82, 0xDB, 0x0F, 0xE0, 0x4E, 0x00, 0x3E, 0x04, 0xCB, 0x42,
+    0xB0, 0x2B, 0x24, 0xCC, 0x31, 0xB2, 0x0C, 0x43, 0xCB, 0x30, 0xB3, 0x9C, 0x34, 0xCA, 0x39, 0x95,
+    0xAB, 0x34, 0xB9, 0x3C, 0x84, 0xBB, 0x53, 0xB0, 0x2C, 0x13, 0xBC, 0x42, 0xB1, 0x1C, 0x33, 0xCC,
+    0x30, 0xB4, 0x8B, 0x34, 0xCB, 0x38, 0xA4, 0x9B, 0x34, 0xC9, 0x4B, 0x83, 0xAC, 0x43, 0xB8, 0x3C,
+    0x03, 0xBC, 0x42, 0xB1, 0x1C, 0x14, 0xCB, 0x31, 0xC3, 0x0B, 0x34, 0xBC, 0x48, 0xA3, 0x9C, 0x24,
+    0xB9, 0x4A, 0x93, 0xAC, 0x53, 0xB8, 0x3B, 0x04, 0xBC, 0x43, 0xB0, 0x2C, 0x13, 0xDB, 0x31, 0xC2,
+    0x1B, 0x24, 0xCB, 0x30, 0xB4, 0x9B, 0x44, 0xBA, 0x49, 0x93, 0xAC, 0x24, 0xC8, 0x3A, 0x84, 0xCB,
+    0x33, 0xC0, 0x3B, 0x04, 0xCB, 0x32, 0xC2, 0x1C, 0x23, 0xBC, 0x31, 0xB4, 0x0C, 0x33, 0xDB, 0x38,
+    0xA4, 0x9B, 0x53, 0xB9, 0x4A, 0x93, 0xAC, 0x43, 0xB8, 0x3C, 0x04, 0xAC, 0x68, 0xB1, 0x54, 0x00,
+    0x32, 0xC1, 0x1B, 0x24, 0xBC, 0x41, 0xB2, 0x0C, 0x43, 0xBB, 0x48, 0xB3, 0x8C, 0x43, 0xBA, 0x4A,
+    0x94, 0xAB, 0x34, 0xB9, 0x3C, 0x04, 0xBC, 0x43, 0xB0, 0x2C, 0x13, 0xBC, 0x32, 0xD3, 0x1B, 0x43,
+    0xAC, 0x30, 0xC3, 0x8B, 0x34, 0xDA, 0x38, 0xA3, 0x9C, 0x43, 0xB9, 0x4B, 0x84, 0xCB, 0x33, 0xC0,
+    0x3B, 0x04, 0xCB, 0x32, 0xD2, 0x2B, 0x23, 0xCC, 0x31, 0xC3, 0x0B, 0x53, 0xBB, 0x48, 0xB3, 0x8C,
+    0x43, 0xC9, 0x39, 0x93, 0xAC, 0x53, 0xB8, 0x3C, 0x03, 0xBC, 0x43, 0xB0, 0x2C, 0x13, 0xBC, 0x41,
+    0xB2, 0x0C, 0x24, 0xCB, 0x30, 0xB4, 0x8B, 0x34, 0xBB, 0x5A, 0x93, 0xAC, 0x34, 0xC9, 0x3A, 0x84,
+    0xCB, 0x33, 0xC0, 0x3B, 0x04, 0xCB, 0x32, 0xC2, 0x1C, 0x23, 0xBC, 0x31, 0xB4, 0x8C, 0x34, 0xCB,
+    0x38, 0xA4, 0x9B, 0x34, 0xBA, 0x5B, 0x93, 0xCB, 0x24, 0xB8, 0x4B, 0x03, 0xBC, 0x42, 0xC1, 0x2B,
+    0xE8, 0xE2, 0x4F, 0x00, 0x4F, 0xC3, 0x4A, 0xC1, 0x38, 0xC0, 0x40, 0xB9, 0x51, 0xCA, 0x33, 0xCB,
+    0x33, 0xAC, 0x14, 0x8C, 0x84, 0x0B, 0x94, 0x2C, 0xA3, 0x3D, 0xC3, 0x3A, 0xD3, 0x49, 0xB0, 0x48,
+    0xC8, 0x31, 0xD9, 0x42, 0xBB, 0x24, 0x9C, 0x23, 0x8D, 0x03, 0x0C, 0x94, 0x1B, 0xA5, 0x3C, 0xC3,
+    0x3A, 0xD3, 0x39, 0xC1, 0x48, 0xB8, 0x50, 0xC9, 0x32, 0xDA, 0x33, 0xAC, 0x23, 0x9C, 0x04, 0x8B,
+    0x84, 0x1B, 0xA4, 0x2C, 0xA4, 0x3B, 0xC3, 0x4A, 0xC1, 0x38, 0xC0, 0x30, 0xD8, 0x31, 0xCA, 0x33,
+    0xAC, 0x33, 0x9D, 0x13, 0x8C, 0x84, 0x0B, 0x94, 0x2B, 0xB4, 0x4B, 0xC3, 0x3A, 0xC2, 0x49, 0xC0,
+    0x30, 0xC8, 0x31, 0xCA, 0x33, 0xDB, 0x23, 0xAB, 0x14, 0x8C, 0x84, 0x0B, 0x95, 0x1B, 0xA4, 0x3B,
+    0xB4, 0x4B, 0xC2, 0x39, 0xC1, 0x48, 0xB8, 0x50, 0xB9, 0x32, 0xCB, 0x33, 0xAC, 0x14, 0x9B, 0x04,
+    0x0C, 0x94, 0x1B, 0xA4, 0x31, 0x02, 0x55, 0x00, 0x3B, 0xB4, 0x4B, 0xC2, 0x39, 0xC1, 0x48, 0xB8,
+    0x50, 0xB9, 0x32, 0xCB, 0x43, 0xBB, 0x24, 0x9C, 0x13, 0x8C, 0x84, 0x1C, 0xA3, 0x3B, 0xB4, 0x3C,
+    0xC3, 0x4A, 0xB1, 0x49, 0xC0, 0x40, 0xB9, 0x41, 0xBA, 0x43, 0xBB, 0x24, 0x9C, 0x13, 0x8C, 0x84,
+    0x0B, 0x94, 0x2B, 0xA4, 0x3D, 0xB2, 0x4A, 0xC1, 0x38, 0xC0, 0x30, 0xD8, 0x31, 0xBA, 0x43, 0xCB,
+    0x33, 0xAC, 0x14, 0x9B, 0x04, 0x0C, 0x94, 0x1B, 0xA4, 0x3B, 0xB4, 0x4B, 0xC2, 0x49, 0xB0, 0x48,
+    0xC8, 0x31, 0xC9, 0x32, 0xCB, 0x33, 0xAC, 0x14, 0x9B, 0x04, 0x0C, 0x83, 0x1D, 0xA3, 0x3B, 0xB4,
+    0x4B, 0xC2, 0x39, 0xC1, 0x48, 0xB8, 0x40, 0xC9, 0x32, 0xDA, 0x23, 0xBB, 0x15, 0x9B, 0x04, 0x8B,
+    0x84, 0x1C, 0x93, 0x2D, 0xB3, 0x4B, 0xB2, 0x5B, 0xB1, 0x49, 0xC0, 0x40, 0xB9, 0x41, 0xBA, 0x43,
+    0xBB, 0x24, 0x9C, 0x13, 0x8C, 0x84, 0x0B, 0x95, 0x18, 0x17, 0x54, 0x00, 0x2B, 0xB3, 0x3C, 0xC3,
+    0x4A, 0xB1, 0x49, 0xC0, 0x30, 0xC8, 0x41, 0xBA, 0x52, 0xAB, 0x33, 0x9D, 0x13, 0x8C, 0x03, 0x0C,
+    0x94, 0x1B, 0xA5, 0x3B, 0xC3, 0x3A, 0xD3, 0x39, 0xC1, 0x48, 0xC8, 0x31, 0xC9, 0x32, 0xCB, 0x33,
+    0xAC, 0x14, 0x9B, 0x04, 0x0C, 0x83, 0x1C, 0xA3, 0x3C, 0xC3, 0x4B, 0xB2, 0x4A, 0xC1, 0x48, 0xB8,
+    0x40, 0xB9, 0x42, 0xBB, 0x43, 0xBB, 0x15, 0x9B, 0x04, 0x0C, 0x83, 0x1C, 0xA3, 0x2C, 0xA4, 0x3C,
+    0xB2, 0x4A, 0xC1, 0x38, 0xC0, 0x40, 0xB9, 0x51, 0xBA, 0x33, 0xBC, 0x15, 0x9B, 0x04, 0x8B, 0x84,
+    0x0B, 0x95, 0x2C, 0xB3, 0x4B, 0xB2, 0x5B, 0xB1, 0x49, 0xC0, 0x30, 0xC8, 0x31, 0xCA, 0x33, 0xBC,
+    0x24, 0xAB, 0x14, 0x8C, 0x84, 0x0B, 0x94, 0x1B, 0xA5, 0x3B, 0xB4, 0x4B, 0xC2, 0x39, 0xC1, 0x48,
+    0xB8, 0x40, 0xC9, 0x32, 0xBB, 0x34, 0xAC, 0x23, 0x9C, 0x04, 0x0C, 0x83, 0x87, 0x17, 0x4F, 0x00,
+    0x1C, 0xA4, 0x3B, 0xC3, 0x4B, 0xB2, 0x4A, 0xC1, 0x48, 0xB8, 0x40, 0xB9, 0x42, 0xBB, 0x34, 0xAC,
+    0x23, 0x9C, 0x04, 0x0C, 0x83, 0x1C, 0xA3, 0x2C, 0xA4, 0x3C, 0xB2, 0x4A, 0xC1, 0x38, 0xC0, 0x40,
+    0xB9, 0x51, 0xBA, 0x43, 0xBB, 0x24, 0x9C, 0x13, 0x8C, 0x03, 0x0D, 0x94, 0x2B, 0xB3, 0x3C, 0xB4,
+    0x4B, 0xC2, 0x49, 0xB0, 0x48, 0xC8, 0x31, 0xBA, 0x43, 0xCB, 0x33, 0xAC, 0x14, 0x9B, 0x04, 0x0C,
+    0x94, 0x2B, 0xB3, 0x3C, 0xB4, 0x4B, 0xC2, 0x39, 0xC1, 0x48, 0xB8, 0x50, 0xB9, 0x32, 0xDB, 0x33,
+    0x9C, 0x13, 0x8C, 0x03, 0x0D, 0x83, 0x1C, 0xA4, 0x3B, 0xC3, 0x4B, 0xB2, 0x4A, 0xC1, 0x48, 0xB8,
+    0x40, 0xB9, 0x42, 0xCA, 0x33, 0xAC, 0x23, 0x9C, 0x04, 0x0C, 0x83, 0x1C, 0xA3, 0x2C, 0xB4, 0x4B,
+    0xB2, 0x4A, 0xC1, 0x48, 0xB8, 0x40, 0xC8, 0x31, 0xCA, 0x33, 0xAC, 0x33, 0x9D, 0x13, 0x8C, 0x84,
+    0x3F, 0x1B, 0x51, 0x00, 0x0B, 0x94, 0x2C, 0xB3, 0x4B, 0xC3, 0x3A, 0xC2, 0x49, 0xC0, 0x30, 0xC8,
+    0x31, 0xCA, 0x33, 0xBC, 0x24, 0xAB, 0x14, 0x8C, 0x84, 0x0B, 0x94, 0x2B, 0xA4, 0x2C, 0xB4, 0x3A,
+    0xC2, 0x49, 0xB0, 0x48, 0xC8, 0x31, 0xD9, 0x32, 0xCB, 0x33, 0xAC, 0x14, 0x9B, 0x04, 0x8B, 0x84,
+    0x1C, 0xA4, 0x3B, 0xB4, 0x4B, 0xC2, 0x39, 0xC1, 0x48, 0xB8, 0x40, 0xB9, 0x51, 0xBA, 0x43, 0xBB,
+    0x24, 0x9C, 0x13, 0x8C, 0x84, 0x1C, 0xA3, 0x3B, 0xB4, 0x3C, 0xC3, 0x4A, 0xB1, 0x49, 0xC0, 0x30,
+    0xC8, 0x31, 0xDA, 0x33, 0xAC, 0x23, 0x9C, 0x04, 0x8B, 0x84, 0x0B, 0x95, 0x2B, 0xB4, 0x4B, 0xB2,
+    0x4B, 0xC2, 0x49, 0xB0, 0x48, 0xC8, 0x31, 0xD9, 0x32, 0xBB, 0x24, 0xAB, 0x14, 0x8C, 0x03, 0x0C,
+    0x94, 0x1B, 0xA5, 0x3B, 0xC3, 0x5B, 0xB1, 0x49, 0xB0, 0x48, 0xC8, 0x31, 0xC9, 0x32, 0xDB, 0x33,
+    0x9C, 0x13, 0x8C, 0x03, 0x9B, 0x1E, 0x4E, 0x00, 0x8C, 0x84, 0x1B, 0xA4, 0x3C, 0xC3, 0x3A, 0xD3,
+    0x39, 0xC1, 0x38, 0xC0, 0x40, 0xB9, 0x51, 0xBA, 0x33, 0xAC, 0x23, 0x9C, 0x04, 0x8B, 0x84, 0x1C,
+    0x93, 0x2C, 0xB4, 0x4B, 0xC2, 0x39, 0xC1, 0x38, 0xC0, 0x40, 0xB9, 0x51, 0xBA, 0x43, 0xBB, 0x14,
+    0x9B, 0x04, 0x8B, 0x84, 0x0B, 0x95, 0x2B, 0xB4, 0x4B, 0xB2, 0x5B, 0xB1, 0x49, 0xC0, 0x30, 0xC8,
+    0x31, 0xCA, 0x33, 0xBC, 0x24, 0xAB, 0x14, 0x8C, 0x03, 0x0C, 0x94, 0x1B, 0xA5, 0x3B, 0xC3, 0x4A,
+    0xB1, 0x49, 0xB0, 0x48, 0xC8, 0x31, 0xD9, 0x32, 0xCB, 0x33, 0xAC, 0x14, 0x9B, 0x04, 0x0C, 0x83,
+    0x1C, 0xA3, 0x3C, 0xC3, 0x3A, 0xD3, 0x39, 0xC1, 0x38, 0xC0, 0x40, 0xB9, 0x51, 0xBA, 0x33, 0xAC,
+    0x14, 0x9B, 0x04, 0x0C, 0x83, 0x1C, 0xA3, 0x2C, 0xB4, 0x3A, 0xD3, 0x39, 0xC1, 0x38, 0xC0, 0x40,
+    0xB9, 0x41, 0xBA, 0x53, 0xBB, 0x24, 0x9C, 0x13, 0xB4, 0x12, 0x48, 0x00, 0x8C, 0x03, 0x0C, 0x94,
+    0x2B, 0xB3, 0x3C, 0xB4, 0x4B, 0xB1, 0x49, 0xB0, 0x58, 0xC8, 0x31, 0xBA, 0x43, 0xCB, 0x33, 0x9C,
+    0x13, 0x9C, 0x04, 0x0C, 0x83, 0x1C, 0xA3, 0x3C, 0xC3, 0x3A, 0xD3, 0x39, 0xC1, 0x48, 0xB8, 0x31,
+    0xCA, 0x42, 0xCA, 0x23, 0xAB, 0x14, 0x9B, 0x04, 0x0C, 0x83, 0x1D, 0xA3, 0x3B, 0xB4, 0x4B, 0xC2,
+    0x39, 0xC1, 0x48, 0xB8, 0x40, 0xB9, 0x32, 0xCB, 0x43, 0xBB, 0x24, 0x9C, 0x13, 0x0C, 0x93, 0x1B,
+    0xA5, 0x3B, 0xB4, 0x3C, 0xB2, 0x4A, 0xB1, 0x49, 0xC0, 0x30, 0xC8, 0x41, 0xAA, 0x22, 0xAB, 0x33,
+    0x9D, 0x13, 0x8C, 0x84, 0x1B, 0x92, 0x2B, 0xA4, 0x3C, 0xC3, 0x3A, 0xC2, 0x28, 0xA0, 0x38, 0xC8,
+    0x31, 0xBA, 0x43, 0xCB
+};
+
+static const uint8_t tetrisData[2055] = {
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0x67, 0x32, 0x33, 0xF7, 0x8F, 0x00, 0x00, 0x01,
+    0x10, 0x01, 0x51, 0xF7, 0x00, 0x00, 0x01, 0x00, 0x11, 0x10, 0x75, 0x0F, 0x00, 0x00, 0x01, 0x10,
+    0x10, 0x11, 0x75, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x01, 0x51, 0xF7, 0x00, 0x00, 0x01, 0x10, 0x00,
+    0x11, 0x75, 0x0F, 0x00, 0x10, 0x00, 0x10, 0x10, 0x01, 0x75, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x41, 0xF7, 0x08, 0x00, 0x10, 0x00, 0x01, 0x01, 0x74, 0x8F, 0x00, 0x00, 0x10, 0x00, 0x01, 0x31,
+    0xFE, 0x80, 0x10, 0x00, 0x00, 0x01, 0x01, 0x51, 0xF7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x11, 0xE3,
+    0x0F, 0x08, 0x10, 0x00, 0x00, 0x01, 0x31, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x31, 0xFE,
+    0x08, 0x00, 0x00, 0x01, 0x10, 0x00, 0xC4, 0x8F, 0x00, 0x00, 0x10, 0x00, 0x10, 0x40, 0xFC, 0x08,
+    0x00, 0x00, 0x01, 0x00, 0x33, 0x1A, 0x4E, 0x00, 0x01, 0xC4, 0x8F, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0x10, 0xE3, 0x0F, 0x00, 0x08, 0x10, 0x00, 0x10, 0x30, 0xFD, 0x08, 0x00, 0x00, 0x01, 0x10, 0x10,
+    0xD2, 0x8F, 0x00, 0x00, 0x10, 0x00, 0x01, 0xE3, 0x0F, 0x00, 0x10, 0x10, 0x10, 0x41, 0xF7, 0x10,
+    0x00, 0x01, 0x10, 0x11, 0xF7, 0x08, 0x01, 0x10, 0x10, 0x10, 0xF7, 0x08, 0x10, 0x10, 0x10, 0x10,
+    0xF7, 0x08, 0x10, 0x00, 0x11, 0x10, 0xF7, 0x08, 0x10, 0x00, 0x01, 0x11, 0xF7, 0x08, 0x10, 0x00,
+    0x01, 0x11, 0xF7, 0x08, 0x00, 0x01, 0x01, 0x11, 0x97, 0x0F, 0x00, 0x01, 0x10, 0x10, 0x71, 0x8F,
+    0x10, 0x00, 0x01, 0x01, 0x71, 0x8F, 0x10, 0x00, 0x10, 0x10, 0x71, 0x8F, 0x10, 0x00, 0x10, 0x10,
+    0x71, 0x8F, 0x10, 0x00, 0x10, 0x10, 0x70, 0x8F, 0x00, 0x01, 0x10, 0x10, 0x70, 0x8F, 0x00, 0x01,
+    0x00, 0x11, 0x10, 0xF7, 0x08, 0x00, 0x01, 0x10, 0xD7, 0x2F, 0x50, 0x00, 0x10, 0xF7, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0x10, 0xF7, 0x80, 0x01, 0x00, 0x01, 0x10, 0xF7,
+    0x80, 0x01, 0x00, 0x10, 0x30, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x30, 0xFC, 0x00, 0x00, 0x00, 0x10,
+    0x30, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x10, 0xC2, 0x0F, 0x00, 0x00, 0x10, 0x00, 0xC3, 0x0F, 0x00,
+    0x00, 0x10, 0x00, 0xC3, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xC3, 0x0F, 0x00, 0x1C, 0x10, 0x10, 0x11,
+    0x41, 0xF7, 0x01, 0x10, 0x10, 0x01, 0xF7, 0x10, 0x10, 0x10, 0x01, 0xF7, 0x10, 0x00, 0x11, 0x10,
+    0xF7, 0x10, 0x00, 0x01, 0x11, 0x71, 0x0F, 0x10, 0x10, 0x10, 0x71, 0x0E, 0x00, 0x01, 0x01, 0x71,
+    0x1F, 0x00, 0x10, 0x01, 0x71, 0x1F, 0x00, 0x10, 0x10, 0x71, 0x0F, 0x01, 0x10, 0x10, 0x11, 0xF7,
+    0x10, 0x00, 0x01, 0x01, 0xE7, 0x00, 0x10, 0x10, 0x10, 0xE7, 0x00, 0x10, 0xD6, 0xFF, 0x54, 0x00,
+    0x00, 0x11, 0xE7, 0x00, 0x00, 0x01, 0x11, 0xF7, 0x01, 0x00, 0x01, 0x01, 0x71, 0x0F, 0x01, 0x00,
+    0x11, 0x70, 0x0E, 0x00, 0x01, 0x10, 0x71, 0x0E, 0x00, 0x01, 0x10, 0x70, 0x0E, 0x00, 0x10, 0x10,
+    0x80, 0x8F, 0x00, 0x01, 0x01, 0x11, 0xF7, 0x00, 0x00, 0x01, 0x01, 0xE7, 0x00, 0x10, 0x00, 0x11,
+    0xF9, 0x08, 0x01, 0x10, 0x10, 0xF9, 0x08, 0x10, 0x10, 0xA1, 0xF6, 0x00, 0x00, 0x10, 0x10, 0x70,
+    0x0E, 0x00, 0x00, 0x01, 0x81, 0x8F, 0x00, 0x01, 0x10, 0x80, 0x8F, 0x00, 0x01, 0x01, 0x91, 0x8F,
+    0x00, 0x01, 0x11, 0x6A, 0x0F, 0x00, 0x00, 0x10, 0x10, 0xF9, 0x08, 0x01, 0x10, 0x10, 0xF9, 0x08,
+    0x1B, 0x21, 0x22, 0x74, 0x0F, 0x10, 0x11, 0x61, 0x0E, 0x01, 0x11, 0xF6, 0x10, 0x01, 0x11, 0xF6,
+    0x01, 0x11, 0x20, 0xE6, 0x10, 0x10, 0x61, 0x0F, 0x11, 0x10, 0x61, 0x1F, 0x10, 0x01, 0x62, 0x0E,
+    0x01, 0xC0, 0x57, 0x00, 0x01, 0x11, 0xF8, 0x00, 0x11, 0x10, 0xE6, 0x00, 0x11, 0x01, 0xE6, 0x10,
+    0x10, 0x81, 0x0F, 0x10, 0x01, 0x61, 0x0E, 0x01, 0x01, 0x51, 0x0F, 0x01, 0x01, 0xF0, 0x00, 0x01,
+    0x11, 0xE6, 0x10, 0x10, 0x00, 0x0F, 0x10, 0x10, 0x81, 0x0F, 0x10, 0x10, 0x61, 0x0E, 0x01, 0x11,
+    0xF8, 0x00, 0x01, 0x11, 0xF8, 0x00, 0x01, 0x11, 0xF8, 0x00, 0x01, 0x01, 0x0F, 0x00, 0x11, 0x00,
+    0x0F, 0x00, 0x11, 0x00, 0x0F, 0x00, 0x01, 0xF1, 0x00, 0x10, 0x01, 0xF0, 0x00, 0x10, 0x10, 0xF0,
+    0x00, 0x10, 0x01, 0x0F, 0x00, 0x01, 0x01, 0x0F, 0x00, 0x01, 0xF1, 0x00, 0x10, 0x10, 0xF0, 0x00,
+    0x10, 0x01, 0xF0, 0x00, 0x10, 0x10, 0x0F, 0x10, 0x00, 0x01, 0x0F, 0x00, 0x01, 0x01, 0x0F, 0x10,
+    0x00, 0xF1, 0x00, 0x10, 0x10, 0xF0, 0x00, 0x01, 0x10, 0xF0, 0x00, 0x10, 0x10, 0x0F, 0x10, 0x00,
+    0x01, 0x0F, 0x00, 0x01, 0xBB, 0x1C, 0x53, 0x00, 0x1F, 0x01, 0x12, 0xF5, 0x11, 0x11, 0xE5, 0x01,
+    0x11, 0xF4, 0x10, 0x11, 0xE5, 0x10, 0x11, 0xE5, 0x10, 0x11, 0xF1, 0x10, 0x10, 0xF1, 0x10, 0x20,
+    0xF0, 0x10, 0x11, 0xF0, 0x10, 0x11, 0xF0, 0x10, 0x11, 0xF0, 0x10, 0x11, 0xF0, 0x10, 0x11, 0xF0,
+    0x10, 0x11, 0xF0, 0x10, 0x11, 0x61, 0x1E, 0x01, 0x11, 0x0F, 0x01, 0x11, 0x0F, 0x11, 0x01, 0x0F,
+    0x11, 0x01, 0x0F, 0x11, 0x01, 0x0F, 0x11, 0x01, 0x0F, 0x11, 0x01, 0x0F, 0x11, 0x01, 0x0F, 0x11,
+    0x01, 0x0F, 0x11, 0x01, 0x0F, 0x11, 0x01, 0x0F, 0x11, 0x01, 0x0F, 0x11, 0x01, 0x0F, 0x11, 0x01,
+    0x1F, 0x10, 0x01, 0xF1, 0x10, 0x10, 0xF1, 0x10, 0x01, 0xF1, 0x10, 0x01, 0xF1, 0x10, 0x11, 0xF0,
+    0x10, 0x01, 0xF1, 0x01, 0x01, 0xF1, 0x01, 0x01, 0xF1, 0x01, 0x01, 0xF1, 0x01, 0x01, 0xF1, 0x01,
+    0x01, 0xF1, 0x01, 0x01, 0xF1, 0x01, 0x01, 0xF1, 0xEE, 0xA4, 0x58, 0x00, 0x01, 0x01, 0xF1, 0x01,
+    0x01, 0xF1, 0x01, 0x01, 0x11, 0x0F, 0x01, 0x11, 0x0F, 0x01, 0x11, 0x1F, 0x10, 0x10, 0x1F, 0x10,
+    0x10, 0x1F, 0x10, 0x10, 0x1F, 0x10, 0x10, 0x1F, 0x10, 0x10, 0x1F, 0x00, 0x1C, 0x11, 0x62, 0x1E,
+    0x11, 0xE5, 0x11, 0x11, 0x1F, 0x11, 0xF1, 0x20, 0x11, 0x0F, 0x21, 0xF0, 0x11, 0x11, 0x1F, 0x11,
+    0xF1, 0x20, 0x11, 0x0F, 0x21, 0x41, 0x1F, 0x11, 0xF1, 0x11, 0x11, 0x0F, 0x21, 0xF1, 0x10, 0x21,
+    0x0F, 0x11, 0xF2, 0x10, 0x21, 0x0F, 0x11, 0xF2, 0x10, 0x21, 0x0F, 0x11, 0xF2, 0x01, 0x21, 0xF1,
+    0x10, 0x11, 0x1F, 0x11, 0xF1, 0x11, 0x11, 0x1F, 0x10, 0xF2, 0x10, 0x21, 0x0F, 0x11, 0xF2, 0x01,
+    0x11, 0x1F, 0x11, 0xF1, 0x11, 0x11, 0x1F, 0x01, 0x12, 0x0F, 0x11, 0xF1, 0x11, 0x11, 0x1F, 0x11,
+    0xF1, 0x01, 0x11, 0x1E, 0x10, 0xE1, 0x01, 0x11, 0x1E, 0x10, 0xE1, 0x01, 0x2D, 0xE8, 0x56, 0x00,
+    0x11, 0x1E, 0x10, 0xE1, 0x01, 0x11, 0xF1, 0x11, 0x11, 0x1F, 0x01, 0xE1, 0x01, 0x11, 0x1E, 0x10,
+    0xE1, 0x01, 0x11, 0x1E, 0x10, 0xE1, 0x11, 0x10, 0x1E, 0x10, 0xE1, 0x01, 0x11, 0xE1, 0x10, 0x11,
+    0x1E, 0x10, 0xE1, 0x01, 0x11, 0x1E, 0x10, 0xE1, 0x01, 0x11, 0x1E, 0x10, 0xE1, 0x01, 0x11, 0x1E,
+    0x10, 0xE1, 0x01, 0x11, 0x1E, 0x10, 0x11, 0x0E, 0x11, 0xD0, 0x10, 0x11, 0x1E, 0x10, 0xE1, 0x01,
+    0x1C, 0x22, 0x2F, 0x21, 0x2F, 0x21, 0x2F, 0x21, 0x2F, 0x21, 0x1E, 0xE2, 0x21, 0xE1, 0x21, 0xF2,
+    0x21, 0xF2, 0x12, 0xF2, 0x12, 0xF2, 0x12, 0x2E, 0x21, 0x2F, 0x21, 0x2F, 0x21, 0x2F, 0x21, 0x1E,
+    0xD1, 0x21, 0xE1, 0x21, 0xF2, 0x12, 0xF2, 0x12, 0xE2, 0x11, 0xE2, 0x21, 0x1E, 0x12, 0x1E, 0x12,
+    0x1D, 0x21, 0x1E, 0x12, 0x1E, 0x12, 0x1D, 0xD1, 0x11, 0xE2, 0x21, 0xD1, 0x11, 0xE2, 0x11, 0xE2,
+    0xBD, 0xC5, 0x58, 0x00, 0x21, 0x1E, 0x12, 0x1D, 0x21, 0x1E, 0x21, 0x1E, 0x12, 0x1D, 0x21, 0x1E,
+    0xD1, 0x21, 0xD1, 0x11, 0xE2, 0x11, 0xE2, 0x21, 0xD1, 0x11, 0xD1, 0x11, 0x1D, 0x12, 0x1D, 0x11,
+    0x1D, 0x21, 0x1E, 0x12, 0x1D, 0xD1, 0x11, 0xD2, 0x11, 0xD1, 0x11, 0xE2, 0x11, 0xD2, 0x11, 0xD1,
+    0x11, 0x1D, 0x12, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x11, 0x1D, 0xC1, 0x11, 0xD1, 0x11, 0xD1, 0x11,
+    0xC1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0x1C, 0x11, 0x1D, 0x11, 0x1C, 0x11, 0x1D, 0x11, 0x1C, 0x11,
+    0x1D, 0xC1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x11, 0xD1, 0x11, 0x1C, 0x11, 0x1D, 0x11, 0x1D,
+    0x11, 0x1C, 0x11, 0x1D, 0x11, 0x1C, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x11, 0xD1, 0x11, 0xC1, 0x11,
+    0xD1, 0x01, 0x1B, 0x21, 0x1E, 0x11, 0x1D, 0x11, 0x1C, 0x11, 0x1D, 0xC1, 0x11, 0xB0, 0x11, 0xF2,
+    0x11, 0xC1, 0x01, 0xD2, 0x05, 0xD1, 0x58, 0x00, 0x11, 0xB0, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1D,
+    0x11, 0x1C, 0x10, 0x1C, 0xC1, 0x11, 0xD1, 0x11, 0xC1, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x01,
+    0x1B, 0x21, 0x1E, 0x11, 0x1D, 0x01, 0x1B, 0x21, 0x1E, 0x01, 0x1C, 0xC1, 0x11, 0xD1, 0x11, 0xC1,
+    0x11, 0xD1, 0x11, 0xD1, 0x11, 0x1C, 0x01, 0x1B, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x11, 0x1D,
+    0xC1, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x11, 0x1D, 0x11, 0x1D, 0x01,
+    0x1B, 0x21, 0x1E, 0x11, 0x1D, 0xC1, 0x11, 0xB0, 0x11, 0xE2, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0xD1,
+    0x11, 0x1D, 0x11, 0x1C, 0x11, 0x1D, 0x11, 0x1D, 0x01, 0x1B, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x11,
+    0xD1, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x11, 0x1D, 0x11, 0x1D, 0x01,
+    0x1B, 0xD1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0xB4, 0xDB, 0x55, 0x00, 0x11, 0xD1, 0x11, 0x1C,
+    0x10, 0x1B, 0x21, 0x1E, 0x11, 0x1D, 0x01, 0x1B, 0x11, 0x1D, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x11,
+    0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x01, 0x1B, 0x21, 0x1E, 0x11, 0x1D, 0x01, 0x1B, 0x21, 0x1E, 0xB0,
+    0x11, 0xE2, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x11, 0xD1, 0x11, 0x1C, 0x01, 0x1B, 0x11, 0x1D,
+    0x11, 0x1D, 0x11, 0x1C, 0xD1, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x11, 0xD1, 0x11, 0xB0, 0x11,
+    0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x11, 0x1D, 0x11, 0x1D, 0x01, 0x1B, 0xD1, 0x11, 0xD1, 0x11, 0xC1,
+    0x11, 0xD1, 0x11, 0xD1, 0x11, 0x1C, 0x01, 0x1B, 0x21, 0x1E, 0x11, 0x1D, 0x01, 0x1B, 0x11, 0x1D,
+    0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x01, 0x1B, 0x21, 0x1E, 0x11,
+    0x1D, 0x01, 0x1B, 0x21, 0x1E, 0xB0, 0x11, 0xE2, 0x11, 0xD1, 0x11, 0xB0, 0x95, 0xDC, 0x52, 0x00,
+    0x11, 0xE2, 0x11, 0xD1, 0x11, 0x1C, 0x01, 0x1B, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0xD1, 0x11,
+    0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x11,
+    0x1D, 0x11, 0x1D, 0x01, 0x1B, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0x1C,
+    0x01, 0x1B, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x11, 0x1D, 0xD1, 0x11, 0xC1, 0x11, 0xD1, 0x11,
+    0xB0, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0x1C, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x20, 0x1D, 0xC1,
+    0x01, 0xB1, 0x11, 0xE2, 0x01, 0xD2, 0x11, 0xB0, 0x11, 0xE2, 0x01, 0x1B, 0x21, 0x1E, 0x11, 0x1D,
+    0x01, 0x1B, 0x21, 0x1E, 0xB0, 0x11, 0xE2, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x11, 0xD1, 0x11,
+    0x1C, 0x01, 0x1B, 0x21, 0x1E, 0x20, 0x1D, 0x01, 0x1B, 0x21, 0x1E, 0xB0, 0x11, 0xE2, 0x11, 0xD1,
+    0x91, 0xCE, 0x56, 0x00, 0x11, 0xB0, 0x11, 0xE2, 0x01, 0x1B, 0x21, 0x1E, 0x11, 0x1D, 0x01, 0x1B,
+    0x21, 0x1E, 0x11, 0x1D, 0xC1, 0x11, 0xB0, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x11, 0xD1, 0x11,
+    0x1D, 0x11, 0x1C, 0x11, 0x1D, 0x01, 0x1B, 0x11, 0x1D, 0xD1, 0x11, 0xC1, 0x11, 0xD1, 0x11, 0xD1,
+    0x11, 0xB0, 0x11, 0xE2, 0x11, 0x1C, 0x20, 0x1D, 0x01, 0x1B, 0x11, 0x1D, 0x11, 0x1D, 0xC1, 0x11,
+    0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x01, 0xD2, 0x11, 0xB0, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1D, 0x11,
+    0x1C, 0x20, 0x1D, 0x01, 0x1B, 0xD1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x01, 0xD2, 0x11, 0x1C,
+    0x10, 0x1B, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x11, 0x1D, 0xD1, 0x11, 0xC1, 0x11, 0xD1, 0x11,
+    0xB0, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0x1C, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x20, 0x1D, 0xC1,
+    0x01, 0xB1, 0x11, 0xE2, 0xD2, 0xD4, 0x55, 0x00, 0x01, 0xD2, 0x11, 0xB0, 0x11, 0xE2, 0x01, 0x1B,
+    0x21, 0x1E, 0x11, 0x1D, 0x01, 0x1B, 0x21, 0x1E, 0xB0, 0x11, 0xE2, 0x11, 0xD1, 0x11, 0xB0, 0x11,
+    0xE2, 0x11, 0xD1, 0x11, 0x1C, 0x01, 0x1B, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x11, 0x1D, 0xD1,
+    0x11, 0xC1, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x01, 0x1B, 0x21, 0x1E, 0x11, 0x1D, 0x01, 0x1B,
+    0x21, 0x1E, 0x11, 0x1D, 0xC1, 0x01, 0xB1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x11, 0xD1, 0x11,
+    0x1D, 0x11, 0x1C, 0x11, 0x1D, 0x01, 0x1B, 0x11, 0x1D, 0xD1, 0x11, 0xC1, 0x11, 0xD1, 0x11, 0xD1,
+    0x11, 0xB0, 0x11, 0xE2, 0x01, 0x1B, 0x21, 0x1E, 0x11, 0x1D, 0x01, 0x1B, 0x21, 0x1E, 0xC1, 0x11,
+    0xC0, 0x11, 0xC1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x01, 0x1B, 0x21, 0x1E, 0x11, 0x1D, 0x01,
+    0x1B, 0x11, 0x1D, 0x11, 0x1D, 0xC1, 0x11, 0xD1, 0x68, 0xCF, 0x54, 0x00, 0x11, 0xC1, 0x01, 0xD2,
+    0x11, 0xB0, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x20, 0x1D, 0x01, 0x1B, 0xD1, 0x11,
+    0xD1, 0x11, 0xC1, 0x11, 0xC0, 0x11, 0xC1, 0x11, 0xD1, 0x11, 0x1D, 0x11, 0x1C, 0x01, 0x1C, 0x11,
+    0x1C, 0x11, 0x1D, 0xC1, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0x1D,
+    0x11, 0x1D, 0x11, 0x1C, 0x01, 0x1C, 0x11, 0x1C, 0xD1, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x11,
+    0xB0, 0x11, 0xE2, 0x01, 0x1B, 0x21, 0x1E, 0x11, 0x1D, 0x01, 0x1B, 0x21, 0x1E, 0x01, 0x1B, 0xD1,
+    0x11, 0xD1, 0x11, 0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x11, 0x1C, 0x01, 0x1B, 0x11, 0x1D, 0x11, 0x1D,
+    0x11, 0x1C, 0x11, 0x1D, 0xC1, 0x11, 0xC0, 0x11, 0xC1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xC1, 0x01,
+    0x1B, 0x21, 0x1E, 0x01, 0x1B, 0x11, 0x1D, 0x11, 0x1D, 0xC1, 0x11, 0xD1, 0x56, 0xEC, 0x4A, 0x00,
+    0x11, 0xC1, 0x11, 0xC0, 0x11, 0xC1, 0x11, 0xD1, 0x11, 0x1C, 0x01, 0x1B, 0x11, 0x1D, 0x11, 0x1D,
+    0x11, 0x1C, 0xD1, 0x11, 0xB0, 0x11, 0xE2, 0x11, 0xB0, 0x11, 0xD1, 0x11, 0xC1, 0x11, 0x1D, 0x11,
+    0x1C, 0x10, 0x1C, 0x11, 0x1C, 0x11, 0x1D, 0x11, 0x1C, 0xB0, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xC1,
+    0x01, 0xB1, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1C, 0x10, 0x1B, 0x11, 0x1D, 0x01, 0x1B, 0xD1, 0x11,
+    0xA0, 0x01, 0xB1, 0x11, 0xD1, 0x11, 0xD1
+};
+
+static const uint8_t gameOverData[4772] = {
+    0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0xFF, 0xBF, 0xA0, 0x77, 0x80, 0x83, 0xF7, 0x08, 0x08,
+    0x7D, 0x80, 0x80, 0xF5, 0x08, 0x08, 0x7D, 0x80, 0x80, 0xF5, 0x08, 0x08, 0x7D, 0x80, 0x80, 0xF5,
+    0x08, 0x08, 0x7D, 0x80, 0x80, 0xF5, 0x08, 0x08, 0x7D, 0x80, 0x80, 0xF5, 0x08, 0x08, 0x7D, 0x80,
+    0x80, 0x85, 0x8F, 0x80, 0xD0, 0x47, 0x08, 0x58, 0xCF, 0x80, 0xD0, 0x07, 0x88, 0x50, 0x8F, 0x00,
+    0xD8, 0x07, 0x88, 0x50, 0x0F, 0x88, 0xD0, 0x87, 0x00, 0x58, 0x0F, 0x88, 0xD0, 0x87, 0x00, 0x58,
+    0x0F, 0x88, 0xD0, 0x07, 0x88, 0x50, 0x0F, 0x08, 0xD8, 0x87, 0x80, 0x50, 0x0F, 0x08, 0xD8, 0x70,
+    0x80, 0x80, 0xF5, 0x80, 0x80, 0x7D, 0x08, 0x08, 0xF5, 0x80, 0x80, 0x7D, 0x08, 0x08, 0xF5, 0x80,
+    0x80, 0x7D, 0x08, 0x58, 0xF8, 0x08, 0x80, 0x7D, 0x08, 0x58, 0xF8, 0x08, 0x80, 0x7D, 0x08, 0x58,
+    0xF8, 0x08, 0x80, 0x7D, 0xFC, 0x6F, 0x58, 0x00, 0x08, 0x58, 0xF8, 0x80, 0x08, 0x7D, 0x08, 0x08,
+    0x85, 0x0F, 0x88, 0xD0, 0x87, 0x80, 0x85, 0x0F, 0x08, 0xD8, 0x87, 0x80, 0x85, 0x0F, 0x08, 0x0D,
+    0x87, 0x80, 0x50, 0x0F, 0x08, 0x0D, 0x87, 0x80, 0x50, 0x0F, 0x08, 0x0D, 0x87, 0x80, 0x50, 0x0F,
+    0x08, 0x0D, 0x87, 0x80, 0x50, 0x0F, 0x08, 0x0D, 0x87, 0x80, 0x50, 0x0F, 0x08, 0x08, 0x7E, 0x08,
+    0x58, 0xF8, 0x80, 0x80, 0x7D, 0x08, 0x58, 0xF8, 0x80, 0x80, 0x7D, 0x08, 0x58, 0xF8, 0x80, 0xD0,
+    0x70, 0x08, 0x08, 0xF5, 0x80, 0xD0, 0x70, 0x08, 0x08, 0xF5, 0x80, 0xD0, 0x70, 0x08, 0x08, 0xF5,
+    0x80, 0xD0, 0x70, 0x08, 0x08, 0xF5, 0x80, 0x80, 0x71, 0x00, 0x08, 0x58, 0x8F, 0x80, 0xD0, 0x87,
+    0x80, 0x88, 0x8F, 0x08, 0x18, 0x07, 0x80, 0x90, 0x8F, 0x08, 0x18, 0x07, 0x80, 0x90, 0x8F, 0x08,
+    0x18, 0x07, 0x80, 0x88, 0x8F, 0x08, 0x18, 0x07, 0xA1, 0x5B, 0x57, 0x00, 0x80, 0x90, 0x8F, 0x08,
+    0x18, 0x07, 0x80, 0x90, 0x8F, 0x08, 0x00, 0x07, 0x08, 0x80, 0xF5, 0x08, 0x08, 0x70, 0x00, 0x08,
+    0xF9, 0x08, 0x08, 0x70, 0x00, 0x08, 0xF9, 0x08, 0x08, 0x70, 0x80, 0x00, 0xF9, 0x08, 0x08, 0x70,
+    0x80, 0x80, 0xF8, 0x08, 0x08, 0x70, 0x80, 0x80, 0xF8, 0x08, 0x08, 0x70, 0x80, 0x80, 0xF8, 0x08,
+    0x08, 0x70, 0x80, 0x80, 0xF8, 0x08, 0x08, 0x18, 0x07, 0x08, 0x90, 0x8F, 0x80, 0x00, 0x07, 0x08,
+    0x88, 0x8F, 0x80, 0x00, 0x07, 0x08, 0x88, 0x8F, 0x80, 0x00, 0x07, 0x08, 0x88, 0x8F, 0x80, 0x00,
+    0x07, 0x08, 0x88, 0x8F, 0x80, 0x00, 0x07, 0x08, 0x88, 0x8F, 0x80, 0x00, 0x07, 0x08, 0x88, 0x8F,
+    0x80, 0x00, 0x07, 0x08, 0x08, 0xF9, 0x08, 0x08, 0x70, 0x80, 0x80, 0xF8, 0x08, 0x08, 0x70, 0x80,
+    0x80, 0xF8, 0x08, 0x08, 0x70, 0x80, 0x80, 0xF8, 0x08, 0x08, 0x70, 0x80, 0x91, 0x52, 0x56, 0x00,
+    0x08, 0xF8, 0x08, 0x08, 0x70, 0x80, 0x80, 0xF8, 0x08, 0x08, 0x70, 0x80, 0x80, 0xF8, 0x08, 0x08,
+    0x70, 0x80, 0x80, 0xF8, 0x08, 0x08, 0x18, 0x07, 0x08, 0x08, 0x8F, 0x08, 0x80, 0x07, 0x08, 0x08,
+    0x8F, 0x80, 0x80, 0x07, 0x08, 0x08, 0x8F, 0x80, 0x80, 0x07, 0x08, 0x08, 0x8F, 0x80, 0x80, 0x07,
+    0x08, 0x08, 0x8F, 0x80, 0x80, 0x07, 0x08, 0x08, 0x8F, 0x80, 0x80, 0x07, 0x08, 0x08, 0x8F, 0x80,
+    0x80, 0x07, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x78, 0x80, 0x80, 0xF8, 0x80, 0x80, 0x70, 0x08, 0x08,
+    0xF8, 0x80, 0x80, 0x70, 0x08, 0x08, 0xF8, 0x80, 0x80, 0x70, 0x08, 0x08, 0xF8, 0x80, 0x80, 0x70,
+    0x08, 0x08, 0xF8, 0x80, 0x80, 0x70, 0x08, 0x08, 0xE8, 0x08, 0x08, 0x78, 0x80, 0x08, 0xF0, 0x08,
+    0x08, 0x08, 0x07, 0x08, 0x08, 0x8F, 0x80, 0x80, 0x07, 0x08, 0x08, 0x8F, 0x80, 0x00, 0x06, 0x08,
+    0xBA, 0x52, 0x55, 0x00, 0x08, 0x8F, 0x80, 0x80, 0x07, 0x08, 0x08, 0x8F, 0x80, 0x80, 0x07, 0x08,
+    0x08, 0x8F, 0x80, 0x00, 0x86, 0x00, 0x88, 0x0E, 0x88, 0x00, 0x86, 0x00, 0x88, 0x0E, 0x08, 0x88,
+    0x70, 0x80, 0x08, 0xF0, 0x80, 0x80, 0x60, 0x08, 0x08, 0xE8, 0x80, 0x80, 0x60, 0x08, 0x08, 0xE8,
+    0x80, 0x80, 0x60, 0x08, 0x08, 0xE8, 0x80, 0x80, 0x60, 0x08, 0x08, 0xE8, 0x80, 0x80, 0x60, 0x08,
+    0x08, 0xE8, 0x80, 0x80, 0x60, 0x08, 0x08, 0xE8, 0x80, 0x80, 0x60, 0x08, 0x08, 0x08, 0x0F, 0x08,
+    0x08, 0x05, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x05, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x05, 0x08, 0x08,
+    0x0F, 0x08, 0x08, 0x05, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x05, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x05,
+    0x08, 0x08, 0x0F, 0x08, 0x08, 0x05, 0x08, 0x08, 0x8E, 0x80, 0x80, 0x60, 0x08, 0x08, 0xD8, 0x80,
+    0x08, 0x60, 0x08, 0x08, 0x9E, 0x40, 0x54, 0x00, 0x08, 0x08, 0x08, 0x98, 0x8F, 0x88, 0x00, 0x5A,
+    0x07, 0x08, 0x08, 0xF6, 0x08, 0x08, 0x08, 0x7E, 0x80, 0x80, 0x80, 0xF6, 0x08, 0x08, 0xE8, 0x07,
+    0x08, 0x08, 0x68, 0x8F, 0x80, 0x80, 0xE0, 0x07, 0x08, 0x58, 0xF8, 0x08, 0x08, 0x08, 0x7E, 0x80,
+    0x80, 0x08, 0xF6, 0x08, 0x08, 0x0D, 0x07, 0x08, 0x08, 0x68, 0xCF, 0x80, 0x80, 0xE0, 0x47, 0x08,
+    0x58, 0xF8, 0x08, 0x08, 0x08, 0x7E, 0x80, 0x80, 0x85, 0x8F, 0x80, 0x80, 0xE0, 0x87, 0x00, 0x08,
+    0x68, 0x0F, 0x88, 0xD0, 0x70, 0x80, 0x80, 0x60, 0xF8, 0x08, 0x08, 0x08, 0x7E, 0x08, 0x08, 0x85,
+    0x8F, 0x80, 0x80, 0xE0, 0x87, 0x80, 0x00, 0x68, 0x0F, 0x08, 0xD8, 0x70, 0x80, 0x80, 0x80, 0xF6,
+    0x80, 0x80, 0x80, 0x7E, 0x08, 0x08, 0x85, 0x8F, 0x00, 0x88, 0xE0, 0x87, 0x80, 0x50, 0xF8, 0x08,
+    0x80, 0xE8, 0x70, 0x80, 0x08, 0x80, 0xF6, 0x80, 0x76, 0x91, 0x56, 0x00, 0x80, 0x0D, 0x87, 0x00,
+    0x08, 0x86, 0x0F, 0x88, 0x00, 0xE8, 0x87, 0x80, 0x50, 0xF8, 0x80, 0x08, 0x80, 0x7E, 0x08, 0x08,
+    0x68, 0xF8, 0x80, 0x08, 0x0D, 0x87, 0x80, 0x00, 0x68, 0x0F, 0x08, 0x08, 0x0E, 0x87, 0x80, 0x50,
+    0xF8, 0x80, 0x80, 0xE8, 0x70, 0x08, 0x08, 0x08, 0xF6, 0x80, 0x80, 0x0D, 0x87, 0x80, 0x80, 0x60,
+    0x0F, 0x08, 0x08, 0x7E, 0x08, 0x08, 0x68, 0xF8, 0x80, 0x80, 0x80, 0x7E, 0x08, 0x08, 0x58, 0x8F,
+    0x80, 0x80, 0x0E, 0x87, 0x80, 0x80, 0x60, 0x0F, 0x08, 0x08, 0x7D, 0x80, 0x80, 0x80, 0xF6, 0x80,
+    0x80, 0xE0, 0x70, 0x08, 0x08, 0x58, 0x8F, 0x80, 0x80, 0xE0, 0x87, 0x80, 0x08, 0x95, 0x8E, 0x80,
+    0x80, 0x7D, 0x80, 0x80, 0x50, 0xE9, 0x08, 0x08, 0xD8, 0x07, 0x08, 0x08, 0x95, 0x8E, 0x80, 0x80,
+    0x1D, 0x06, 0x08, 0x48, 0xF9, 0x08, 0x08, 0xD8, 0x61, 0x80, 0x80, 0x50, 0xFF, 0x7F, 0x57, 0x00,
+    0xE9, 0x08, 0x08, 0x1C, 0x07, 0x08, 0x88, 0x95, 0x8E, 0x80, 0x80, 0x1D, 0x06, 0x08, 0x48, 0xF9,
+    0x08, 0x80, 0xD8, 0x61, 0x80, 0x80, 0x50, 0xE9, 0x08, 0x08, 0x18, 0x07, 0x80, 0x80, 0x95, 0x8E,
+    0x80, 0x80, 0x71, 0x00, 0x08, 0x58, 0xE9, 0x08, 0x08, 0xD8, 0x61, 0x80, 0x80, 0x88, 0x8F, 0x08,
+    0x08, 0x1D, 0x06, 0x08, 0x88, 0x95, 0x8E, 0x80, 0x00, 0x70, 0x00, 0x08, 0x58, 0xE9, 0x08, 0x08,
+    0x80, 0x71, 0x00, 0x08, 0x88, 0x8F, 0x08, 0x08, 0x18, 0x07, 0x00, 0x88, 0x90, 0x8F, 0x08, 0x08,
+    0x70, 0x00, 0x08, 0x08, 0xF9, 0x88, 0x80, 0x80, 0x71, 0x00, 0x08, 0x88, 0x8F, 0x08, 0x08, 0x18,
+    0x07, 0x80, 0x80, 0xF8, 0x88, 0x00, 0x08, 0x70, 0x00, 0x08, 0x08, 0xF9, 0x88, 0x80, 0x00, 0x07,
+    0x80, 0x80, 0x90, 0x8F, 0x08, 0x08, 0x18, 0x07, 0x80, 0x80, 0xF8, 0x88, 0x80, 0x00, 0x70, 0x00,
+    0x98, 0x59, 0x56, 0x00, 0x08, 0x08, 0xF9, 0x88, 0x80, 0x00, 0x07, 0x80, 0x80, 0x88, 0x8F, 0x08,
+    0x08, 0x18, 0x07, 0x80, 0x80, 0xF8, 0x88, 0x00, 0x08, 0x70, 0x00, 0x08, 0x88, 0x8F, 0x80, 0x80,
+    0x18, 0x07, 0x80, 0x80, 0x88, 0x8F, 0x08, 0x80, 0x70, 0x80, 0x80, 0x80, 0xF8, 0x88, 0x00, 0x88,
+    0x71, 0x00, 0x88, 0x80, 0x8F, 0x80, 0x80, 0x00, 0x07, 0x80, 0x08, 0x90, 0x8F, 0x80, 0x80, 0x70,
+    0x80, 0x80, 0x80, 0xF8, 0x88, 0x00, 0x88, 0x71, 0x80, 0x80, 0x80, 0x8F, 0x80, 0x80, 0x00, 0x07,
+    0x08, 0x08, 0xF8, 0x08, 0x08, 0x08, 0x70, 0x00, 0x88, 0x00, 0xF9, 0x08, 0x08, 0x08, 0x07, 0x08,
+    0x08, 0x88, 0x8F, 0x80, 0x80, 0x00, 0x07, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x08, 0x70, 0x80, 0x80,
+    0x80, 0xF8, 0x08, 0x08, 0x08, 0x07, 0x08, 0x08, 0x88, 0x8F, 0x80, 0x80, 0x00, 0x07, 0x08, 0x08,
+    0xF8, 0x08, 0x08, 0x08, 0x4D, 0xBA, 0x52, 0x00, 0x70, 0x80, 0x80, 0x80, 0xF8, 0x08, 0x08, 0x08,
+    0x07, 0x08, 0x08, 0x88, 0x8F, 0x80, 0x80, 0x70, 0x08, 0x80, 0x80, 0xF8, 0x08, 0x08, 0x08, 0x70,
+    0x80, 0x80, 0x08, 0x8F, 0x00, 0x88, 0x00, 0x07, 0x08, 0x08, 0x88, 0x8F, 0x80, 0x00, 0x78, 0x08,
+    0x08, 0x80, 0xF8, 0x08, 0x80, 0x08, 0x70, 0x80, 0x08, 0x80, 0x0F, 0x08, 0x88, 0x00, 0x07, 0x88,
+    0x80, 0x80, 0x0F, 0x08, 0x88, 0x70, 0x08, 0x08, 0x08, 0xF8, 0x80, 0x80, 0x08, 0x87, 0x80, 0x80,
+    0x80, 0x0F, 0x88, 0x00, 0x08, 0x87, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x80, 0x70, 0x08, 0x08, 0x80,
+    0xF8, 0x80, 0x80, 0x80, 0x87, 0x80, 0x80, 0x80, 0x0F, 0x08, 0x08, 0x08, 0x06, 0x08, 0x08, 0xF8,
+    0x80, 0x80, 0x80, 0x60, 0x80, 0x80, 0x80, 0xF0, 0x08, 0x08, 0x08, 0x86, 0x80, 0x80, 0x80, 0x8E,
+    0x80, 0x80, 0x60, 0x80, 0x80, 0x80, 0xF0, 0x08, 0xF9, 0xCC, 0x56, 0x00, 0x84, 0x80, 0x80, 0x80,
+    0x80, 0xF8, 0x88, 0x80, 0x8A, 0xC0, 0x7F, 0x80, 0x80, 0x80, 0x80, 0xF7, 0x08, 0x08, 0x08, 0x08,
+    0x7F, 0x80, 0x80, 0x80, 0x80, 0x87, 0x8F, 0x80, 0x80, 0x80, 0xF0, 0x07, 0x08, 0x08, 0x88, 0x70,
+    0x8F, 0x80, 0x80, 0x00, 0xF8, 0x07, 0x08, 0x88, 0x00, 0x78, 0x8F, 0x80, 0x00, 0x08, 0xF8, 0x70,
+    0x80, 0x80, 0x80, 0x80, 0xF7, 0x08, 0x80, 0x08, 0x80, 0x7F, 0x80, 0x80, 0x08, 0x08, 0xF7, 0x80,
+    0x08, 0x08, 0x80, 0x7F, 0x08, 0x80, 0x08, 0x80, 0x87, 0x8F, 0x80, 0x80, 0x80, 0xF0, 0x87, 0x80,
+    0x00, 0x08, 0x78, 0x0F, 0x08, 0x88, 0x00, 0xF8, 0x87, 0x80, 0x00, 0x88, 0x70, 0x0F, 0x08, 0x08,
+    0x88, 0xF0, 0x70, 0x80, 0x80, 0x08, 0x80, 0xF7, 0x80, 0x80, 0x80, 0xF8, 0x70, 0x80, 0x08, 0x80,
+    0x80, 0xF7, 0x80, 0x80, 0x80, 0xF0, 0x70, 0x80, 0x08, 0x80, 0x08, 0x87, 0x00, 0x70, 0x57, 0x00,
+    0x0F, 0x88, 0x80, 0x00, 0xF8, 0x87, 0x80, 0x80, 0x80, 0x87, 0x0F, 0x88, 0x00, 0x88, 0xF0, 0x87,
+    0x80, 0x80, 0x80, 0x87, 0x0F, 0x08, 0x88, 0x80, 0xF0, 0x70, 0x08, 0x08, 0x80, 0x08, 0xF7, 0x80,
+    0x80, 0x80, 0xF0, 0x70, 0x08, 0x08, 0x08, 0x70, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x08, 0x08,
+    0x08, 0x08, 0x87, 0x0F, 0x08, 0x08, 0x08, 0xF8, 0x87, 0x80, 0x80, 0x80, 0x87, 0x0F, 0x08, 0x08,
+    0x08, 0xF8, 0x87, 0x80, 0x80, 0x80, 0x87, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x80, 0x80, 0x80,
+    0x80, 0xF7, 0x80, 0x80, 0x80, 0x00, 0x7F, 0x08, 0x08, 0x88, 0x00, 0xF7, 0x80, 0x80, 0x00, 0xE8,
+    0x61, 0x80, 0x80, 0x80, 0x80, 0x70, 0x8F, 0x80, 0x80, 0x80, 0x1E, 0x06, 0x08, 0x08, 0x08, 0x96,
+    0x8E, 0x80, 0x80, 0x80, 0x1E, 0x06, 0x08, 0x08, 0x08, 0x08, 0xF7, 0x08, 0x08, 0x08, 0xE8, 0x61,
+    0x92, 0x57, 0x58, 0x00, 0x80, 0x80, 0x80, 0x60, 0xE9, 0x08, 0x08, 0x08, 0xE8, 0x61, 0x80, 0x80,
+    0x80, 0x60, 0xE9, 0x08, 0x08, 0x08, 0x08, 0x1E, 0x07, 0x88, 0x00, 0x88, 0x96, 0x8E, 0x80, 0x80,
+    0x80, 0x1E, 0x06, 0x08, 0x08, 0x88, 0x96, 0x8E, 0x80, 0x80, 0x00, 0x1E, 0x06, 0x08, 0x08, 0x88,
+    0x60, 0xF9, 0x80, 0x08, 0x80, 0xE0, 0x61, 0x80, 0x80, 0x08, 0x60, 0xE9, 0x08, 0x80, 0x08, 0xE8,
+    0x61, 0x80, 0x08, 0x80, 0x68, 0xE9, 0x08, 0x80, 0x08, 0x80, 0x1E, 0x87, 0x80, 0x80, 0x80, 0x96,
+    0x0E, 0x88, 0x80, 0x00, 0x1E, 0x86, 0x00, 0x88, 0x00, 0x96, 0x0E, 0x88, 0x00, 0x08, 0x1E, 0x86,
+    0x80, 0x00, 0x08, 0x78, 0xD9, 0x08, 0x08, 0x08, 0xE8, 0x61, 0x08, 0x08, 0x08, 0x60, 0xE9, 0x80,
+    0x80, 0x80, 0xE8, 0x61, 0x08, 0x08, 0x08, 0x08, 0xE7, 0x08, 0x08, 0x08, 0x80, 0x49, 0x07, 0x08,
+    0x08, 0x08, 0x68, 0x8F, 0x9F, 0xA9, 0x57, 0x00, 0x80, 0x80, 0x80, 0x10, 0x17, 0x08, 0x08, 0x08,
+    0xC1, 0x8F, 0x80, 0x80, 0x80, 0x10, 0x17, 0x08, 0x08, 0x08, 0x18, 0xFC, 0x08, 0x08, 0x88, 0x80,
+    0x72, 0x81, 0x08, 0x80, 0x28, 0xFC, 0x08, 0x08, 0x08, 0x08, 0x71, 0x81, 0x80, 0x80, 0x10, 0xFC,
+    0x08, 0x08, 0x80, 0x08, 0x49, 0x87, 0x80, 0x80, 0x80, 0x90, 0x9F, 0x80, 0x80, 0x00, 0x4A, 0x07,
+    0x88, 0x80, 0x00, 0x98, 0x9F, 0x00, 0x88, 0x80, 0x20, 0x17, 0x08, 0x88, 0x80, 0x10, 0xFC, 0x88,
+    0x80, 0x80, 0x00, 0x71, 0x81, 0x80, 0x80, 0x10, 0xFC, 0x08, 0x08, 0x08, 0x08, 0x71, 0x00, 0x08,
+    0x08, 0x08, 0xFA, 0x09, 0x80, 0x08, 0x80, 0x49, 0x07, 0x08, 0x80, 0x08, 0x98, 0x8F, 0x88, 0x80,
+    0x00, 0x4A, 0x07, 0x08, 0x08, 0x08, 0x98, 0x8F, 0x08, 0x08, 0x08, 0x98, 0x74, 0x80, 0x80, 0x80,
+    0x08, 0xF9, 0x88, 0x80, 0x80, 0x80, 0x72, 0x00, 0xB7, 0x4A, 0x54, 0x00, 0x08, 0x08, 0x28, 0xFC,
+    0x08, 0x08, 0x80, 0x08, 0x71, 0x00, 0x08, 0x88, 0x00, 0xA8, 0x9F, 0x80, 0x00, 0x08, 0x4A, 0x07,
+    0x08, 0x08, 0x08, 0x98, 0x8F, 0x08, 0x08, 0x08, 0x28, 0x17, 0x08, 0x08, 0x88, 0xC2, 0x8F, 0x80,
+    0x80, 0x80, 0x80, 0x72, 0x00, 0x08, 0x80, 0x28, 0xFC, 0x08, 0x08, 0x08, 0x08, 0x71, 0x00, 0x08,
+    0x08, 0x08, 0xFA, 0x88, 0x80, 0x80, 0xA0, 0x74, 0x80, 0x80, 0x80, 0x80, 0x98, 0x8F, 0x08, 0x08,
+    0x88, 0x49, 0x07, 0x08, 0x88, 0x80, 0x90, 0x8F, 0x08, 0x80, 0x08, 0x28, 0x07, 0x80, 0x80, 0x80,
+    0xA0, 0x9F, 0x80, 0x80, 0x00, 0x98, 0x74, 0x00, 0x08, 0x08, 0x88, 0xF9, 0x09, 0x08, 0x08, 0xA0,
+    0x74, 0x80, 0x80, 0x80, 0x80, 0xF9, 0x88, 0x80, 0x80, 0x80, 0x72, 0x00, 0x08, 0x80, 0x08, 0xC1,
+    0x8F, 0x80, 0x80, 0x80, 0x10, 0x07, 0x80, 0x00, 0x88, 0xC2, 0x8F, 0x00, 0x12, 0xD1, 0x53, 0x00,
+    0x85, 0x80, 0x80, 0x80, 0x00, 0x18, 0xFC, 0x80, 0x8A, 0x80, 0x00, 0xD8, 0x7F, 0x80, 0x80, 0x80,
+    0x80, 0x48, 0xF7, 0x08, 0x08, 0x08, 0x08, 0xC8, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x48, 0xF7, 0x08,
+    0x08, 0x08, 0x80, 0xC8, 0x7F, 0x80, 0x80, 0x80, 0x08, 0x48, 0xF7, 0x08, 0x08, 0x80, 0x08, 0x08,
+    0xFC, 0x47, 0x08, 0x08, 0x88, 0x80, 0x87, 0x8F, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x07, 0x88, 0x00,
+    0x88, 0x80, 0x74, 0x0F, 0x88, 0x80, 0x00, 0x88, 0xFC, 0x87, 0x00, 0x88, 0x00, 0x88, 0x74, 0x8F,
+    0x00, 0x08, 0x08, 0x88, 0xFC, 0x87, 0x80, 0x00, 0x88, 0x00, 0x48, 0xF7, 0x80, 0x80, 0x08, 0x80,
+    0xC0, 0x7F, 0x08, 0x08, 0x08, 0x80, 0x48, 0xF7, 0x80, 0x80, 0x80, 0x80, 0xC8, 0x7F, 0x08, 0x08,
+    0x08, 0x08, 0x40, 0xF7, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x7F, 0x08, 0x08, 0x08, 0x08, 0x48, 0xF7,
+    0x03, 0x90, 0x58, 0x00, 0x80, 0x80, 0x80, 0x80, 0xF0, 0x70, 0x00, 0x08, 0x08, 0x08, 0x08, 0x97,
+    0x8F, 0x80, 0x80, 0x08, 0x80, 0x0F, 0x07, 0x80, 0x80, 0x80, 0x80, 0x87, 0x8F, 0x08, 0x08, 0x08,
+    0x80, 0x0F, 0x07, 0x80, 0x80, 0x08, 0x80, 0x87, 0x8F, 0x08, 0x08, 0x08, 0x80, 0x0F, 0x07, 0x80,
+    0x80, 0x08, 0x08, 0x87, 0x8F, 0x08, 0x80, 0x08, 0x80, 0xF8, 0x71, 0x80, 0x80, 0x80, 0x80, 0x70,
+    0xF8, 0x08, 0x88, 0x80, 0x00, 0xF8, 0x70, 0x80, 0x00, 0x88, 0x00, 0x78, 0xE9, 0x08, 0x08, 0x08,
+    0x08, 0xF8, 0x61, 0x80, 0x80, 0x80, 0x80, 0x70, 0xE9, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x61, 0x80,
+    0x80, 0x80, 0x80, 0x70, 0xE9, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1F, 0x07, 0x08, 0x08, 0x08, 0x88,
+    0x97, 0x8E, 0x80, 0x80, 0x80, 0x80, 0x1F, 0x06, 0x08, 0x08, 0x08, 0x08, 0x97, 0x8E, 0x80, 0x80,
+    0x80, 0x80, 0x1F, 0x06, 0x91, 0x67, 0x57, 0x00, 0x08, 0x08, 0x08, 0x08, 0x97, 0x8E, 0x80, 0x80,
+    0x80, 0x80, 0x1F, 0x06, 0x08, 0x08, 0x08, 0x08, 0x78, 0xF9, 0x08, 0x80, 0x08, 0x80, 0xF8, 0x61,
+    0x80, 0x80, 0x80, 0x80, 0x78, 0xE9, 0x08, 0x08, 0x08, 0x80, 0xF8, 0x61, 0x80, 0x80, 0x80, 0x80,
+    0x78, 0xE9, 0x08, 0x08, 0x08, 0x80, 0xF8, 0x61, 0x80, 0x80, 0x08, 0x80, 0x78, 0xE9, 0x08, 0x08,
+    0x80, 0x80, 0x08, 0x1F, 0x87, 0x80, 0x80, 0x00, 0x88, 0x97, 0x8E, 0x00, 0x88, 0x00, 0x88, 0x1F,
+    0x86, 0x00, 0x08, 0x88, 0x80, 0x97, 0x0E, 0x88, 0x00, 0x88, 0x00, 0x1F, 0x86, 0x00, 0x88, 0x00,
+    0x88, 0x97, 0x0E, 0x08, 0x88, 0x80, 0x00, 0x1F, 0x86, 0x80, 0x00, 0x88, 0x00, 0x97, 0x0E, 0x08,
+    0x08, 0x88, 0x00, 0xF8, 0x71, 0x08, 0x08, 0x08, 0x08, 0x78, 0xE9, 0x80, 0x80, 0x80, 0x80, 0xF8,
+    0x61, 0x08, 0x08, 0x08, 0x08, 0x78, 0xE9, 0x80, 0xE0, 0xA9, 0x56, 0x00, 0x80, 0x80, 0x80, 0x90,
+    0x74, 0x80, 0x80, 0x80, 0x80, 0x10, 0xFC, 0x88, 0x80, 0x00, 0x88, 0x90, 0x74, 0x80, 0x00, 0x88,
+    0x00, 0x88, 0xD2, 0x8F, 0x00, 0x08, 0x88, 0x00, 0x4A, 0x07, 0x80, 0x80, 0x08, 0x80, 0xC1, 0x8F,
+    0x80, 0x80, 0x80, 0x80, 0x49, 0x07, 0x08, 0x08, 0x08, 0x08, 0xC1, 0x8F, 0x80, 0x80, 0x80, 0x80,
+    0x49, 0x07, 0x08, 0x08, 0x08, 0x08, 0xC1, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x49, 0x07, 0x08, 0x08,
+    0x08, 0x08, 0x18, 0xFC, 0x08, 0x88, 0x00, 0x88, 0x90, 0x74, 0x00, 0x08, 0x88, 0x00, 0x18, 0xFC,
+    0x88, 0x80, 0x00, 0x88, 0x90, 0x74, 0x00, 0x08, 0x88, 0x80, 0x10, 0xFC, 0x08, 0x08, 0x88, 0x00,
+    0x98, 0x74, 0x80, 0x80, 0x80, 0x00, 0x18, 0xFC, 0x08, 0x08, 0x08, 0x88, 0x00, 0x49, 0x07, 0x80,
+    0x80, 0x80, 0x80, 0xD2, 0x8F, 0x80, 0x80, 0x00, 0x08, 0x4A, 0x07, 0x08, 0x6A, 0x54, 0x55, 0x00,
+    0x88, 0x80, 0x80, 0xC2, 0x0F, 0x88, 0x80, 0x00, 0x08, 0x28, 0x17, 0x88, 0x00, 0x88, 0x00, 0xD1,
+    0x8F, 0x80, 0x80, 0x80, 0x80, 0x49, 0x07, 0x08, 0x08, 0x08, 0x08, 0x18, 0xFC, 0x08, 0x08, 0x88,
+    0x00, 0x98, 0x74, 0x00, 0x88, 0x00, 0x88, 0x10, 0xFC, 0x08, 0x88, 0x00, 0x88, 0x90, 0x74, 0x80,
+    0x80, 0x00, 0x88, 0x10, 0xFC, 0x08, 0x08, 0x08, 0x08, 0x98, 0x74, 0x80, 0x80, 0x80, 0x80, 0x10,
+    0xFC, 0x08, 0x08, 0x08, 0x08, 0x98, 0x74, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC1, 0x8F, 0x08, 0x08,
+    0x80, 0x80, 0x49, 0x07, 0x80, 0x80, 0x80, 0x80, 0xC1, 0x8F, 0x08, 0x08, 0x08, 0x08, 0x49, 0x07,
+    0x80, 0x80, 0x08, 0x80, 0xC1, 0x8F, 0x08, 0x80, 0x80, 0x08, 0x49, 0x07, 0x08, 0x80, 0x08, 0x80,
+    0xC1, 0x8F, 0x80, 0x80, 0x08, 0x80, 0x98, 0x75, 0x08, 0x80, 0x08, 0x80, 0x28, 0xFC, 0x08, 0x08,
+    0x0F, 0xC5, 0x52, 0x00, 0x06, 0x88, 0x80, 0x00, 0x08, 0x88, 0x80, 0xF3, 0x8F, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xD0, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x75, 0x8F, 0x80, 0x80, 0x80, 0x00,
+    0x08, 0x88, 0xFE, 0x07, 0x08, 0x08, 0x88, 0x00, 0x88, 0x50, 0xF7, 0x08, 0x08, 0x80, 0x08, 0x80,
+    0x08, 0xFD, 0x07, 0x08, 0x88, 0x80, 0x00, 0x88, 0x00, 0x76, 0xCF, 0x80, 0x00, 0x88, 0x00, 0x88,
+    0xD0, 0x7F, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0x75, 0x0F, 0x88, 0x80, 0x00, 0x08, 0x88, 0xD0,
+    0x7F, 0x08, 0x80, 0x80, 0x08, 0x08, 0x08, 0x68, 0xF7, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0xFD,
+    0x87, 0x80, 0x00, 0x88, 0x80, 0x00, 0x58, 0xF7, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0xE8, 0x7F,
+    0x08, 0x08, 0x08, 0x80, 0x08, 0x08, 0x75, 0x0F, 0x08, 0x08, 0x08, 0x88, 0x00, 0xD8, 0x7F, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0xD6, 0x6A, 0x4E, 0x00, 0x08, 0x75, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0xFE, 0x87, 0x80, 0x80, 0x80, 0x80, 0x80, 0x50, 0xF7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x87, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x76, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0xD8,
+    0x7F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x75, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0xD8, 0x7F,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x58, 0xF7, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xFD, 0x87,
+    0x80, 0x80, 0x80, 0x80, 0x08, 0x58, 0xF7, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00, 0xD8, 0x7F, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x57, 0x0F, 0x08, 0x80, 0x08, 0x80, 0x08, 0xF8, 0x72, 0x00, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0xA7, 0x8F, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0xFD, 0x07, 0x08, 0x08,
+    0x08, 0x08, 0x88, 0x70, 0xFA, 0x88, 0x80, 0x80, 0xF6, 0x97, 0x52, 0x00, 0x00, 0x08, 0x88, 0x2F,
+    0x07, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0xF2, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0, 0x72,
+    0x00, 0x88, 0x00, 0x08, 0x88, 0x80, 0xA7, 0x8F, 0x08, 0x80, 0x08, 0x80, 0x80, 0xF0, 0x72, 0x80,
+    0x00, 0x88, 0x00, 0x08, 0x88, 0x20, 0xFF, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x2F, 0x07, 0x08,
+    0x08, 0x80, 0x08, 0x80, 0x78, 0xFA, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0xA0, 0x77, 0x80, 0x80,
+    0x08, 0x80, 0x08, 0x80, 0xA7, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0x72, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x30, 0xFF, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x2F, 0x07, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x28, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x6A, 0x07, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0xE1, 0x8F, 0x08, 0x80, 0x08, 0x80, 0x08, 0xB0, 0x76, 0x80, 0x71, 0x47, 0x56, 0x00,
+    0x80, 0x80, 0x80, 0x00, 0x88, 0xE3, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x6A, 0x07, 0x80,
+    0x80, 0x80, 0x08, 0x80, 0x38, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x6A, 0x07, 0x88, 0x00,
+    0x88, 0x80, 0x80, 0x20, 0xFE, 0x08, 0x80, 0x08, 0x80, 0x80, 0x08, 0xA0, 0x76, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xE3, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x00, 0x98, 0x75, 0x00, 0x08, 0x88, 0x00,
+    0x88, 0x80, 0x30, 0xFF, 0x08, 0x80, 0x08, 0x08, 0x80, 0x80, 0x59, 0x07, 0x08, 0x80, 0x08, 0x80,
+    0x08, 0x38, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x5A, 0x07, 0x80, 0x80, 0x08, 0x80, 0x80,
+    0x08, 0xE2, 0x8F, 0x08, 0x08, 0x08, 0x80, 0x08, 0xB0, 0x76, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xD2, 0x8F, 0x08, 0x08, 0x80, 0x80, 0x08, 0x08, 0x6A, 0x07, 0x08, 0x08, 0x80, 0x08, 0x80, 0x20,
+    0x8F, 0x63, 0x4A, 0x00, 0xFE, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x5A, 0x07, 0x08, 0x08, 0x80,
+    0x08, 0x80, 0x28, 0xFD, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0xB0, 0x77, 0x08, 0x80, 0x08, 0x80,
+    0x08, 0x08, 0xD2, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA0, 0x75, 0x00, 0x08, 0x08, 0x88, 0x00,
+    0x88, 0x20, 0xFE, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x6B, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x18, 0xFD, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x59, 0x07, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08,
+    0xF3, 0x8F, 0x80, 0x80, 0x00, 0x08, 0x08, 0xA8, 0x75, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0xD1,
+    0x8F, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x6A, 0x07, 0x80, 0x80, 0x80, 0x80, 0x08, 0x20, 0xFE,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x5A, 0x07, 0x80, 0x80, 0x08, 0x80, 0x08, 0x38, 0xFE, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x78, 0xC4, 0x4C, 0x00, 0x80, 0xB0, 0x76, 0x80, 0x80, 0x80, 0x08, 0x80,
+    0x08, 0xD1, 0x8F, 0x80, 0x80, 0x00, 0x88, 0x80, 0x90, 0x75, 0x00, 0x88, 0x00, 0x08, 0x88, 0x00,
+    0x18, 0xFE, 0x08, 0x08, 0x08, 0x88, 0x80, 0x00, 0x6B, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x28,
+    0xFD, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0xA8, 0x76, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0xE2,
+    0x8F, 0x80, 0x80, 0x80, 0x00, 0x88, 0x90, 0x75, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0xD1, 0x8F,
+    0x08, 0x80, 0x08, 0x08, 0x80, 0x80, 0x7B, 0x07, 0x88, 0x80, 0x80, 0x00, 0x08, 0x28, 0xFD, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x5A, 0x07, 0x80, 0x80, 0x08, 0x08, 0x80, 0x80, 0xE2, 0x8F, 0x08,
+    0x80, 0x80, 0x08, 0x80, 0xA8, 0x76, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0xD2, 0x8F, 0x80, 0x08,
+    0x80, 0x80, 0x80, 0xA0, 0x75, 0x00, 0x08, 0x08, 0xF2, 0x32, 0x4C, 0x00, 0x08, 0x08, 0x08, 0x38,
+    0xFF, 0x80, 0x08, 0x08, 0x80, 0x80, 0x80, 0x5A, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x28, 0xFD,
+    0x88, 0x80, 0x80, 0x00, 0x08, 0x08, 0xA8, 0x76, 0x80, 0x80, 0x00, 0x88, 0x80, 0x80, 0xE3, 0x8F,
+    0x80, 0x00, 0x88, 0x00, 0x08, 0xA8, 0x75, 0x80, 0x80, 0x80, 0x00, 0x88, 0x80, 0xD2, 0x8F, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x7B, 0x07, 0x88, 0x00, 0x88, 0x00, 0x88, 0x20, 0xFD, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x88, 0x59, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF3, 0x8F, 0x00, 0x88,
+    0x00, 0x08, 0x88, 0xA0, 0x75, 0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0xD2, 0x8F, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0xA8, 0x76, 0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x28, 0xFE, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x5A, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0xFE, 0x08, 0x5E, 0xDA, 0x50, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0xA8, 0x76, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD1, 0x8F, 0x80,
+    0x80, 0x80, 0x08, 0x80, 0x98, 0x76, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0xD1, 0x8F, 0x08, 0x80,
+    0x08, 0x80, 0x80, 0x08, 0x7B, 0x07, 0x88, 0x00, 0x88, 0x00, 0x88, 0x20, 0xFD, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x88, 0x59, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF3, 0x8F, 0x00, 0x88, 0x00,
+    0x08, 0x88, 0xA0, 0x75, 0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0xD2, 0x8F, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0xA8, 0x76, 0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x28, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x5A, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0xA8, 0x76, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD1, 0x8F, 0x80, 0x80, 0x80, 0x08, 0x80, 0x98,
+    0x78, 0xCA, 0x44, 0x00, 0x76, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x38, 0xFE, 0x08, 0x08, 0x08,
+    0x88, 0x00, 0x88, 0x59, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0xFE, 0x08, 0x08, 0x08, 0x08,
+    0x88, 0x00, 0x5A, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF3, 0x8F, 0x00, 0x88, 0x00, 0x88,
+    0x00, 0xA8, 0x75, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0xD1, 0x8F, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x7B, 0x07, 0x88, 0x00, 0x88, 0x00, 0x88, 0x20, 0xFD, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00,
+    0x5A, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0xFE, 0x08, 0x08, 0x08, 0x88, 0x00, 0x08, 0xA8,
+    0x76, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD1, 0x8F, 0x80, 0x80, 0x80, 0x08, 0x08, 0xA0, 0x76,
+    0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0x38, 0xFE, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x59, 0x07,
+    0x80, 0x80, 0x80, 0x80, 0xF9, 0x29, 0x48, 0x00, 0x80, 0x20, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x88,
+    0x00, 0x5A, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF3, 0x8F, 0x00, 0x88, 0x00, 0x88, 0x00,
+    0xA8, 0x75, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0xD1, 0x8F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x7B, 0x07, 0x88, 0x00, 0x88, 0x80, 0x00, 0x28, 0xFD, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x5A,
+    0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0xA0, 0x76,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD2, 0x8F, 0x08, 0x08, 0x08, 0x08, 0x08, 0xA8, 0x76, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x59, 0x07, 0x08,
+    0x08, 0x08, 0x80, 0x08, 0x10, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x59, 0x07, 0x80, 0x08,
+    0x80, 0x08, 0x08, 0x80, 0xF3, 0x8F, 0x00, 0x88, 0xAA, 0xCE, 0x4E, 0x00, 0x00, 0x88, 0x00, 0xA8,
+    0x75, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0xD1, 0x8F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7B,
+    0x07, 0x88, 0x00, 0x88, 0x80, 0x00, 0x28, 0xFD, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x5A, 0x07,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF3, 0x8F, 0x00, 0x88, 0x00, 0x08, 0x88, 0xA0, 0x75, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x88, 0xD2, 0x8F, 0x08, 0x08, 0x08, 0x08, 0x08, 0xA8, 0x76, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x08, 0x28, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x5A, 0x07, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x20, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xA8, 0x76, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xD1, 0x8F, 0x80, 0x80, 0x80, 0x08, 0x80, 0x98, 0x76, 0x80, 0x80, 0x80, 0x80,
+    0x08, 0x80, 0xD1, 0x8F, 0x08, 0x80, 0x08, 0x80, 0x80, 0x08, 0x7B, 0x07, 0x59, 0x34, 0x52, 0x00,
+    0x88, 0x00, 0x88, 0x00, 0x88, 0x20, 0xFD, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x59, 0x07, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xF3, 0x8F, 0x00, 0x88, 0x00, 0x08, 0x88, 0xA0, 0x75, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0xD1, 0x8F, 0x08, 0x08, 0x08, 0x08, 0x08, 0xA8, 0x76, 0x80, 0x80, 0x80,
+    0x00, 0x88, 0x80, 0x20, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x59, 0x07, 0x08, 0x08, 0x08,
+    0x80, 0x80, 0x38, 0xFE, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0xA0, 0x76, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xD1, 0x8F, 0x80, 0x80, 0x80, 0x08, 0x80, 0xB0, 0x76, 0x80, 0x80, 0x80, 0x00, 0x88,
+    0x80, 0xD2, 0x8F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7B, 0x07, 0x88, 0x00, 0x88, 0x00, 0x88,
+    0x20, 0xFD, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x59, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xA1, 0x2A, 0x44, 0x00, 0xF3, 0x8F, 0x00, 0x88, 0x00, 0x08, 0x88, 0xA0, 0x75, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x88, 0xD2, 0x8F, 0x08, 0x08, 0x08, 0x08, 0x08, 0xA8, 0x76, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x08, 0x28, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x5A, 0x07, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x20, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xA8, 0x76, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xD1, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA8, 0x76, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xD2, 0x8F, 0x08, 0x08, 0x80, 0x80, 0x80, 0x80, 0x6A, 0x07, 0x08, 0x80, 0x08, 0x08, 0x08, 0x38,
+    0xFE, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x5A, 0x07, 0x08, 0x08, 0x80, 0x08, 0x08, 0x08, 0xE2,
+    0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x90, 0x75, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE3, 0x8F,
+    0x80, 0x80, 0x80, 0x80, 0x60, 0xD8, 0x48, 0x00, 0x80, 0x80, 0x6A, 0x07, 0x08, 0x08, 0x88, 0x00,
+    0x88, 0x20, 0xFD, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x5A, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x38, 0xFE, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xA8, 0x76, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80,
+    0xD1, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x90, 0x75, 0x00, 0x88, 0x00, 0x08, 0x88, 0x80, 0x20,
+    0xFE, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x6A, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x28, 0xFD,
+    0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x6A, 0x07, 0x88, 0x00, 0x88, 0x00, 0x08, 0x88, 0xD2, 0x8F,
+    0x08, 0x08, 0x08, 0x08, 0x80, 0xA8, 0x76, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD2, 0x8F, 0x08,
+    0x80, 0x80, 0x80, 0x08, 0x80, 0x6A, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x28, 0xFD, 0x88, 0x80,
+    0x80, 0x80, 0x00, 0x88, 0x6A, 0x07, 0x08, 0x08, 0xAD, 0x1B, 0x48, 0x00, 0x08, 0x08, 0x08, 0x28,
+    0xFD, 0x88, 0x00, 0x88, 0x00, 0x08, 0x08, 0xA8, 0x76, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD2,
+    0x8F, 0x08, 0x08, 0x08, 0x80, 0x80, 0xA8, 0x76, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x28, 0xFD,
+    0x88, 0x80, 0x80, 0x80, 0x80, 0x00, 0x6B, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x28, 0xFD, 0x88,
+    0x00, 0x88, 0x00, 0x88, 0x00, 0x59, 0x07, 0x08, 0x08, 0x08, 0x80, 0x80, 0x08, 0xE1, 0x8F, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xB0, 0x76, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0xD1, 0x8F, 0x00, 0x88,
+    0x00, 0x88, 0x80, 0x00, 0x6A, 0x87, 0x80, 0x00, 0x88, 0x00, 0x88, 0x20, 0xFD, 0x08, 0x08, 0x88,
+    0x00, 0x88, 0x00, 0x5A, 0x07, 0x80, 0x08, 0x80, 0x08, 0x80, 0x38, 0xFE, 0x08, 0x08, 0x80, 0x08,
+    0x80, 0x08, 0xA0, 0x75, 0x00, 0x08, 0x88, 0x80, 0x00, 0x08, 0xE2, 0x8F, 0xBB, 0xEF, 0x46, 0x00,
+    0x80, 0x00, 0x88, 0x00, 0x88, 0xA0, 0x75, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0xFE, 0x08,
+    0x80, 0x80, 0x80, 0x08, 0x08, 0x5A, 0x07, 0x08, 0x08, 0x08, 0x08, 0x88, 0x20, 0xFD, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x5A, 0x07, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0xE2, 0x8F, 0x80, 0x80,
+    0x00, 0x08, 0x88, 0xA0, 0x75, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xD2, 0x8F, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x6A, 0x07, 0x88, 0x00, 0x88, 0x80, 0x80, 0x00, 0xFC, 0x08, 0x88, 0x00, 0x88,
+    0x81, 0x80, 0x59, 0x07, 0x80, 0x80, 0x08, 0x08, 0x88, 0x80, 0xE2, 0x8F, 0x80, 0x00, 0x88, 0x80,
+    0x81, 0xA0, 0x75, 0x80, 0x08, 0x80, 0x08, 0x80, 0x88, 0xC1, 0x8F, 0x80, 0x08, 0x80, 0x08, 0x08,
+    0xA1, 0x75, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x29, 0xFD, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80,
+    0x26, 0xFD, 0x2A, 0x00, 0x48, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x18, 0xFC, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08
+};
+
+/*******************************Private Variables***********************************/
+
+/********************************Public Variables***********************************/
+
+const sfxClip_t sfxClips[SFX_CLIPS] = {
+    {rotateData, 176, SFX_CLIP_RATE, SFX_FORMAT_ADPCM},
+    {lockData, 580, SFX_CLIP_RATE, SFX_FORMAT_ADPCM},
+    {lineData, 2224, SFX_CLIP_RATE, SFX_FORMAT_ADPCM},
+    {levelData, 2768, SFX_CLIP_RATE, SFX_FORMAT_ADPCM},
+    {tetrisData, 3982, SFX_CLIP_RATE, SFX_FORMAT_ADPCM},
+    {gameOverData, 9248, SFX_CLIP_RATE, SFX_FORMAT_ADPCM}
+};
+
+/********************************Public Variables***********************************/
@@ -0,0 +1,287 @@
+// tetris_synth.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-19
+// Defines for the wavetable synthesizer. Each voice steps a 32 bit phase
+// through a one-cycle table and is scaled by its envelope. Envelopes run
+// at a control rate, so the per-sample loop is only table lookups and two
+// dual multiply-accumulates for all four voices. Rendering mixes into the
+// block with saturation, so music and effects can share it. Uses no
+// drivers, the host tools render with the same code.
+
+/************************************Includes***************************************/
+
+#include "../tetris_synth.h"
+#include "../tetris_dsp.h"
+
+#include <math.h>
+
+/************************************Includes***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef enum {
+    SYNTH_STAGE_OFF = 0,
+    SYNTH_STAGE_ATTACK,
+    SYNTH_STAGE_DECAY,
+    SYNTH_STAGE_SUSTAIN,
+    SYNTH_STAGE_RELEASE
+} synthStage_t;
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+typedef struct {
+    const int16_t* wave;
+    uint32_t phase;
+    uint32_t increment;             // phase step per sample
+    synthStage_t stage;
+    int32_t level;                  // envelope, Q24
+    int32_t step;                   // level change per control period
+    int32_t sustain;                // Q24
+    uint16_t decayPeriods;
+    uint16_t releasePeriods;
+    uint16_t volume;                // Q15
+    int16_t gain;                   // level * volume, Q15
+} synthVoice_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/*******************************Private Variables***********************************/
+
+static int16_t waves[SYNTH_WAVES][SYNTH_WAVE_SIZE];
+
+// Phase steps of the top octave, lower octaves shift them down
+static uint32_t topOctave[12];
+
+static synthVoice_t voices[SYNTH_VOICES];
+static uint32_t controlRate = 0;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// TetrisSynth_Periods
+// Return: uint16_t, control periods in a duration, at least 1
+static uint16_t TetrisSynth_Periods(uint16_t ms) {
+    uint32_t periods = ((uint32_t)ms * controlRate) / 1000;
+
+    return (periods == 0) ? 1 : ((periods > 0xFFFF) ? 0xFFFF : (uint16_t)periods);
+}
+
+// TetrisSynth_Control
+// Advances every envelope by one control period and updates the gains.
+// Return: void
+static void TetrisSynth_Control(void) {
+    synthVoice_t* v = 0;
+    uint8_t i = 0;
+
+    for (i = 0; i < SYNTH_VOICES; i++) {
+        v = &voices[i];
+
+        switch (v->stage) {
+            case SYNTH_STAGE_ATTACK:
+                v->level += v->step;
+                if (v->level >= SYNTH_LEVEL_FULL) {
+                    v->level = SYNTH_LEVEL_FULL;
+                    v->stage = SYNTH_STAGE_DECAY;
+                    v->step = (SYNTH_LEVEL_FULL - v->sustain) / v->decayPeriods;
+                }
+                break;
+            case SYNTH_STAGE_DECAY:
+                v->level -= v->step;
+                if (v->level <= v->sustain) {
+                    v->level = v->sustain;
+                    v->stage = SYNTH_STAGE_SUSTAIN;
+                }
+                break;
+            case SYNTH_STAGE_RELEASE:
+                v->level -= v->step;
+                if (v->level <= 0) {
+                    v->level = 0;
+                    v->stage = SYNTH_STAGE_OFF;
+                }
+                break;
+            default:
+                break;
+        }
+
+        v->gain = (int16_t)(((v->level >> 9) * v->volume) >> 15);
+    }
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisSynth_Init
+// Builds the wave tables and pitch table and silences every voice.
+// Param uint32_t "rate": output sample rate in Hz
+// Return: void
+void TetrisSynth_Init(uint32_t rate) {
+    const float pi = 3.14159265f;
+    uint16_t i = 0;
+
+    for (i = 0; i < SYNTH_WAVE_SIZE; i++) {
+        waves[SYNTH_WAVE_SINE][i] = (int16_t)(32767.0f * sinf((2.0f * pi * i) / SYNTH_WAVE_SIZE));
+        waves[SYNTH_WAVE_TRIANGLE][i] = (int16_t)((i < SYNTH_WAVE_SIZE / 2) ?
+                                                  (-32767 + (int32_t)i * 65534 / (SYNTH_WAVE_SIZE / 2)) :
+                                                  (32767 - (int32_t)(i - SYNTH_WAVE_SIZE / 2) * 65534 / (SYNTH_WAVE_SIZE / 2)));
+        // Square and saw are louder for the same peak, start them lower
+        waves[SYNTH_WAVE_SQUARE][i] = (i < SYNTH_WAVE_SIZE / 2) ? 16384 : -16384;
+        waves[SYNTH_WAVE_SAW][i] = (int16_t)(((int32_t)i * 32768 / SYNTH_WAVE_SIZE) - 16384);
+    }
+
+    // MIDI notes 108 to 119, phase step = f * 2^32 / rate
+    for (i = 0; i < 12; i++) {
+        topOctave[i] = (uint32_t)(440.0f * powf(2.0f, (float)(SYNTH_NOTE_MAX - 11 + i - 69) / 12.0f) *
+                                  (4294967296.0f / rate));
+    }
+
+    controlRate = rate / SYNTH_CONTROL_SAMPLES;
+    TetrisSynth_Silence();
+}
+
+// TetrisSynth_NoteOn
+// Starts a note on a voice from the beginning of its attack.
+// Param uint8_t "voice": 0 to SYNTH_VOICES - 1
+// Param uint8_t "note": MIDI note, 69 is A4
+// Param const synthInstrument_t* "instrument": wave and envelope
+// Return: void
+void TetrisSynth_NoteOn(uint8_t voice, uint8_t note, const synthInstrument_t* instrument) {
+    synthVoice_t* v = 0;
+
+    if (voice >= SYNTH_VOICES) {
+        return;
+    }
+    v = &voices[voice];
+    if (note > SYNTH_NOTE_MAX) {
+        note = SYNTH_NOTE_MAX;
+    }
+
+    v->wave = waves[instrument->wave];
+    v->phase = 0;
+    v->increment = topOctave[note % 12] >> ((SYNTH_NOTE_MAX / 12) - (note / 12));
+    v->sustain = (int32_t)instrument->sustain << 9;
+    v->decayPeriods = TetrisSynth_Periods(instrument->decayMS);
+    v->releasePeriods = TetrisSynth_Periods(instrument->releaseMS);
+    v->volume = instrument->volume;
+    v->level = 0;
+    v->step = SYNTH_LEVEL_FULL / TetrisSynth_Periods(instrument->attackMS);
+    v->stage = SYNTH_STAGE_ATTACK;
+}
+
+// TetrisSynth_NoteOff
+// Moves a voice to its release from wherever its envelope is.
+// Param uint8_t "voice": 0 to SYNTH_VOICES - 1
+// Return: void
+void TetrisSynth_NoteOff(uint8_t voice) {
+    synthVoice_t* v = 0;
+
+    if (voice >= SYNTH_VOICES) {
+        return;
+    }
+    v = &voices[voice];
+    if (v->stage == SYNTH_STAGE_OFF || v->stage == SYNTH_STAGE_RELEASE) {
+        return;
+    }
+
+    v->step = (v->level / v->releasePeriods) + 1;
+    v->stage = SYNTH_STAGE_RELEASE;
+}
+
+// TetrisSynth_Silence
+// Stops every voice at once.
+// Return: void
+void TetrisSynth_Silence(void) {
+    uint8_t i = 0;
+
+    for (i = 0; i < SYNTH_VOICES; i++) {
+        voices[i].wave = waves[SYNTH_WAVE_SINE];
+        voices[i].increment = 0;
+        voices[i].stage = SYNTH_STAGE_OFF;
+        voices[i].level = 0;
+        voices[i].gain = 0;
+    }
+}
+
+// TetrisSynth_IsActive
+// Param uint8_t "voice": 0 to SYNTH_VOICES - 1
+// Return: bool, true until the voice's release has finished
+bool TetrisSynth_IsActive(uint8_t voice) {
+    return (voice < SYNTH_VOICES) && (voices[voice].stage != SYNTH_STAGE_OFF);
+}
+
+// TetrisSynth_Render
+// Mixes all voices into a block, saturating. Two samples are produced per
+// step, each a pair of SMLADs over the packed voice samples and gains, and
+// added to the block with one QADD16. One SMLAD holds two full-scale
+// products, four do not, so the pairs are summed with a QADD.
+// Param int16_t* "samples": word aligned block to mix into
+// Param uint16_t "count": samples, a multiple of SYNTH_CONTROL_SAMPLES
+// Return: void
+void TetrisSynth_Render(int16_t* samples, uint16_t count) {
+    uint32_t* out = (uint32_t*)samples;
+    const int16_t* w0 = 0;
+    const int16_t* w1 = 0;
+    const int16_t* w2 = 0;
+    const int16_t* w3 = 0;
+    uint32_t p0, p1, p2, p3;
+    uint32_t i0, i1, i2, i3;
+    uint32_t g01 = 0;
+    uint32_t g23 = 0;
+    int32_t a = 0;
+    int32_t b = 0;
+    uint16_t done = 0;
+    uint16_t n = 0;
+
+    for (done = 0; done < count; done += SYNTH_CONTROL_SAMPLES) {
+        TetrisSynth_Control();
+
+        g01 = TetrisDSP_Pack(voices[0].gain, voices[1].gain);
+        g23 = TetrisDSP_Pack(voices[2].gain, voices[3].gain);
+        if (g01 == 0 && g23 == 0) {
+            out += SYNTH_CONTROL_SAMPLES / 2;
+            continue;
+        }
+
+        w0 = voices[0].wave;
+        w1 = voices[1].wave;
+        w2 = voices[2].wave;
+        w3 = voices[3].wave;
+        p0 = voices[0].phase;
+        p1 = voices[1].phase;
+        p2 = voices[2].phase;
+        p3 = voices[3].phase;
+        i0 = voices[0].increment;
+        i1 = voices[1].increment;
+        i2 = voices[2].increment;
+        i3 = voices[3].increment;
+
+        for (n = 0; n < SYNTH_CONTROL_SAMPLES; n += 2) {
+            a = TetrisDSP_QAdd(TetrisDSP_Smlad(TetrisDSP_Pack(w0[p0 >> 24], w1[p1 >> 24]), g01, 0),
+                               TetrisDSP_Smlad(TetrisDSP_Pack(w2[p2 >> 24], w3[p3 >> 24]), g23, 0));
+            p0 += i0;
+            p1 += i1;
+            p2 += i2;
+            p3 += i3;
+
+            b = TetrisDSP_QAdd(TetrisDSP_Smlad(TetrisDSP_Pack(w0[p0 >> 24], w1[p1 >> 24]), g01, 0),
+                               TetrisDSP_Smlad(TetrisDSP_Pack(w2[p2 >> 24], w3[p3 >> 24]), g23, 0));
+            p0 += i0;
+            p1 += i1;
+            p2 += i2;
+            p3 += i3;
+
+            *out = TetrisDSP_QAdd16(*out, TetrisDSP_Pack(TetrisDSP_SatQ15(a), TetrisDSP_SatQ15(b)));
+            out++;
+        }
+
+        voices[0].phase = p0;
+        voices[1].phase = p1;
+        voices[2].phase = p2;
+        voices[3].phase = p3;
+    }
+}
+
+/********************************Public Functions***********************************/
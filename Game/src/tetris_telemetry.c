@@ -0,0 +1,264 @@
+// tetris_telemetry.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for telemetry frames. Payloads are structs copied as they are,
+// the only per-byte work is the CRC and COBS stuffing of tetris_frame while
+// the frame is copied out. Board frames carry only the rows that changed. Apart from
+// TetrisTelemetry_Input, callers serialize with whatever guards the
+// transport.
+
+/************************************Includes***************************************/
+
+#include "../tetris_telemetry.h"
+
+#include <string.h>
+
+#include "../tetris_frame.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define TELEMETRY_INPUT_MASK        (TELEMETRY_INPUT_QUEUE - 1)
+
+/*************************************Defines***************************************/
+
+/*******************************Private Variables***********************************/
+
+static telemetryWrite_t writeFrame = 0;
+static bool enabled = TELEMETRY_ENABLED;
+static uint8_t sequence = 0;
+static telemetryStats_t stats;
+
+// Frame built here, callers serialize
+static uint8_t raw[TELEMETRY_MAX_RAW];
+static uint8_t frame[TELEMETRY_MAX_FRAME];
+
+// Board rows as last sent, packed, and whether the host needs everything
+static uint8_t boardShadow[TELEMETRY_BOARD_ROWS][TELEMETRY_ROW_BYTES];
+static bool boardStale = true;
+static uint32_t lastKeyframe = 0;
+
+static telemetryScore_t scoreShadow;
+static bool scoreStale = true;
+
+// Input events, written by one thread and read by another
+static uint32_t inputQueue[TELEMETRY_INPUT_QUEUE];
+static volatile uint32_t inputHead = 0;
+static volatile uint32_t inputTail = 0;
+
+/*******************************Private Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisTelemetry_Init
+// Sets the transport and makes the next board and score frames complete.
+// Param telemetryWrite_t "write": sends a whole frame or nothing
+// Return: void
+void TetrisTelemetry_Init(telemetryWrite_t write) {
+    writeFrame = write;
+    sequence = 0;
+    inputTail = inputHead;
+    memset(&stats, 0, sizeof(stats));
+    TetrisTelemetry_Keyframe();
+}
+
+// TetrisTelemetry_SetEnabled
+// Starts or stops sending. Turning it on resends the whole board.
+// Param bool "on": send frames
+// Return: void
+void TetrisTelemetry_SetEnabled(bool on) {
+    if (on && !enabled) {
+        TetrisTelemetry_Keyframe();
+    }
+    enabled = on;
+}
+
+// TetrisTelemetry_IsEnabled
+// Return: bool
+bool TetrisTelemetry_IsEnabled(void) {
+    return enabled;
+}
+
+// TetrisTelemetry_GetStats
+// Gets frame counts since TetrisTelemetry_Init.
+// Param telemetryStats_t* "current": destination
+// Return: void
+void TetrisTelemetry_GetStats(telemetryStats_t* current) {
+    *current = stats;
+}
+
+// TetrisTelemetry_Encode
+// Builds a frame: delimiter, COBS of header, payload and CRC, delimiter.
+// Param telemetryType_t "type": payload type
+// Param uint8_t "seq": sequence number, lets the host count lost frames
+// Param uint16_t "time": ms timestamp
+// Param const void* "payload": payload bytes
+// Param uint16_t "length": payload bytes, at most TELEMETRY_MAX_PAYLOAD
+// Param uint8_t* "out": TELEMETRY_MAX_FRAME bytes
+// Return: uint16_t, frame bytes
+uint16_t TetrisTelemetry_Encode(telemetryType_t type, uint8_t seq, uint16_t time,
+                                const void* payload, uint16_t length, uint8_t* out) {
+    raw[0] = (uint8_t)type;
+    raw[1] = seq;
+    raw[2] = (uint8_t)(time & 0xFF);
+    raw[3] = (uint8_t)(time >> 8);
+    memcpy(&raw[TELEMETRY_HEADER_BYTES], payload, length);
+
+    return TetrisFrame_Encode(raw, TELEMETRY_HEADER_BYTES + length, out);
+}
+
+// TetrisTelemetry_Decode
+// Unstuffs the bytes between two delimiters and checks the CRC.
+// Param const uint8_t* "data": frame bytes without delimiters
+// Param uint16_t "length": bytes
+// Param uint8_t* "out": header and payload, TELEMETRY_MAX_RAW bytes
+// Return: int16_t, header and payload bytes, -1 if damaged
+int16_t TetrisTelemetry_Decode(const uint8_t* data, uint16_t length, uint8_t* out) {
+    int16_t n = TetrisFrame_Decode(data, length, out, TELEMETRY_MAX_RAW);
+
+    return (n < TELEMETRY_HEADER_BYTES) ? -1 : n;
+}
+
+// TetrisTelemetry_Send
+// Encodes and sends one frame.
+// Param telemetryType_t "type": payload type
+// Param const void* "payload": payload bytes
+// Param uint16_t "length": payload bytes, at most TELEMETRY_MAX_PAYLOAD
+// Param uint32_t "now": time in ms
+// Return: bool, false if off or the transport had no room
+bool TetrisTelemetry_Send(telemetryType_t type, const void* payload, uint16_t length, uint32_t now) {
+    uint16_t n = 0;
+
+    if (!enabled || writeFrame == 0 || length > TELEMETRY_MAX_PAYLOAD) {
+        return false;
+    }
+
+    n = TetrisTelemetry_Encode(type, sequence, (uint16_t)now, payload, length, frame);
+    if (!writeFrame(frame, n)) {
+        stats.dropped++;
+        return false;
+    }
+
+    sequence++;
+    stats.frames++;
+    stats.bytes += n;
+    return true;
+}
+
+// TetrisTelemetry_Score
+// Sends the score if it changed since the last one sent.
+// Param const telemetryScore_t* "score": current values
+// Param uint32_t "now": time in ms
+// Return: void
+void TetrisTelemetry_Score(const telemetryScore_t* score, uint32_t now) {
+    if (!scoreStale && !memcmp(score, &scoreShadow, sizeof(scoreShadow))) {
+        return;
+    }
+
+    if (TetrisTelemetry_Send(TELEMETRY_SCORE, score, sizeof(*score), now)) {
+        scoreShadow = *score;
+        scoreStale = false;
+    }
+}
+
+// TetrisTelemetry_Board
+// Sends the rows that differ from the last board sent, or all of them on
+// a keyframe. Rows stay pending if the frame couldn't be sent.
+// Param const uint8_t** "board": cell values 0 to 15
+// Param uint32_t "now": time in ms
+// Return: void
+void TetrisTelemetry_Board(const uint8_t board[TELEMETRY_BOARD_ROWS][TELEMETRY_BOARD_COLUMNS], uint32_t now) {
+    uint8_t payload[2 + TELEMETRY_BOARD_ROWS * TELEMETRY_ROW_BYTES];
+    uint8_t packed[TELEMETRY_BOARD_ROWS][TELEMETRY_ROW_BYTES];
+    uint16_t rows = 0;
+    uint16_t n = 2;
+    uint8_t i = 0;
+    uint8_t j = 0;
+
+    if (!enabled) {
+        return;
+    }
+
+    if ((int32_t)(now - lastKeyframe) >= TELEMETRY_KEYFRAME_MS) {
+        TetrisTelemetry_Keyframe();
+    }
+
+    for (i = 0; i < TELEMETRY_BOARD_ROWS; i++) {
+        for (j = 0; j < TELEMETRY_ROW_BYTES; j++) {
+            packed[i][j] = (uint8_t)((board[i][2 * j] & 0x0F) | (board[i][2 * j + 1] << 4));
+        }
+        if (boardStale || memcmp(packed[i], boardShadow[i], TELEMETRY_ROW_BYTES)) {
+            rows |= (uint16_t)(1 << i);
+            memcpy(&payload[n], packed[i], TELEMETRY_ROW_BYTES);
+            n += TELEMETRY_ROW_BYTES;
+        }
+    }
+
+    if (rows == 0) {
+        return;
+    }
+
+    payload[0] = (uint8_t)(rows & 0xFF);
+    payload[1] = (uint8_t)(rows >> 8);
+    if (TetrisTelemetry_Send(TELEMETRY_BOARD, payload, n, now)) {
+        memcpy(boardShadow, packed, sizeof(boardShadow));
+        if (boardStale) {
+            boardStale = false;
+            lastKeyframe = now;
+        }
+    }
+}
+
+// TetrisTelemetry_Keyframe
+// Makes the next board and score frames complete, for a new game or a
+// host that just connected.
+// Return: void
+void TetrisTelemetry_Keyframe(void) {
+    boardStale = true;
+    scoreStale = true;
+}
+
+// TetrisTelemetry_Input
+// Queues an input event for the next batch. Safe against a concurrent
+// TetrisTelemetry_FlushInput, but only one thread may queue.
+// Param uint32_t "event": input event word
+// Return: void
+void TetrisTelemetry_Input(uint32_t event) {
+    uint32_t head = inputHead;
+
+    if (!enabled) {
+        return;
+    }
+    if (head - inputTail >= TELEMETRY_INPUT_QUEUE) {
+        stats.inputsLost++;
+        return;
+    }
+
+    inputQueue[head & TELEMETRY_INPUT_MASK] = event;
+    inputHead = head + 1;
+}
+
+// TetrisTelemetry_FlushInput
+// Sends the queued input events, TELEMETRY_INPUT_BATCH to a frame.
+// Events stay queued if a frame couldn't be sent.
+// Param uint32_t "now": time in ms
+// Return: void
+void TetrisTelemetry_FlushInput(uint32_t now) {
+    uint32_t batch[TELEMETRY_INPUT_BATCH];
+    uint32_t tail = inputTail;
+    uint32_t count = 0;
+
+    while (inputHead != tail) {
+        for (count = 0; count < TELEMETRY_INPUT_BATCH && tail + count != inputHead; count++) {
+            batch[count] = inputQueue[(tail + count) & TELEMETRY_INPUT_MASK];
+        }
+        if (!TetrisTelemetry_Send(TELEMETRY_INPUT, batch, (uint16_t)(count * sizeof(uint32_t)), now)) {
+            break;
+        }
+        tail += count;
+        inputTail = tail;
+    }
+}
+
+/********************************Public Functions***********************************/
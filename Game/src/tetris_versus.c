@@ -0,0 +1,444 @@
+// tetris_versus.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for versus play. Starts, garbage and game over go as reliable
+// link messages, board states as unreliable ones where only the newest
+// matters. Attacks first cancel garbage waiting on the attacker's own
+// board. Hole columns come from a generator of their own so rand(), which
+// deals both boards' pieces, stays in step. Callers serialize, as for the
+// link.
+
+/************************************Includes***************************************/
+
+#include "../tetris_versus.h"
+
+#include <string.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Garbage sent for 1 to 4 lines cleared at once
+#define VERSUS_ATTACKS              {0, 0, 1, 2, 4}
+
+/*************************************Defines***************************************/
+
+/*******************************Private Variables***********************************/
+
+static versusPhase_t phase = VERSUS_IDLE;
+static versusStats_t stats;
+
+// Seed of the game in play and when it started, and a start from the peer
+// that the game thread has not taken yet
+static uint32_t gameSeed = 0;
+static uint32_t startedAt = 0;
+static uint32_t startSeed = 0;
+static bool startPending = false;
+
+// Garbage waiting to come up on this board
+static uint8_t pending = 0;
+static uint8_t pendingHole = 0;
+static uint32_t holeState = 1;
+
+static uint16_t tick = 0;
+static uint32_t lastTick = 0;
+
+// Newest peer state and when it arrived
+static versusState_t peer;
+static bool peerValid = false;
+static uint32_t peerAt = 0;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// Versus_Random
+// Xorshift, for hole columns only.
+// Return: uint32_t
+static uint32_t Versus_Random(void) {
+    holeState ^= holeState << 13;
+    holeState ^= holeState >> 17;
+    holeState ^= holeState << 5;
+    return holeState;
+}
+
+// Versus_Cell
+// Return: uint8_t, a packed cell of a state's rows
+static uint8_t Versus_Cell(const versusState_t* state, int row, int column) {
+    uint8_t cells = state->rows[row][column / 2];
+
+    return (column & 1) ? (cells >> 4) : (cells & 0x0F);
+}
+
+// Versus_Fits
+// Return: bool, true if a state's piece fits at a position on its rows
+static bool Versus_Fits(const versusState_t* state, int x, int y) {
+    int i = 0;
+    int j = 0;
+
+    for (i = 0; i < VERSUS_PIECE_SIZE; i++) {
+        for (j = 0; j < VERSUS_PIECE_SIZE; j++) {
+            if (!(state->pieceMask & (1 << (VERSUS_PIECE_SIZE * i + j)))) {
+                continue;
+            }
+            if (y + i < 0 || y + i >= VERSUS_ROWS || x + j < 0 || x + j >= VERSUS_COLUMNS ||
+                Versus_Cell(state, y + i, x + j)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Versus_Predict
+// Moves a state's piece on by the time since it was sampled: repeats of
+// the held shift, then gravity, each until something is in the way.
+// Param const versusState_t* "state": peer state
+// Param uint32_t "elapsedMS": time since it was sampled
+// Param int8_t* "x": predicted column
+// Param int8_t* "y": predicted row
+// Return: void
+static void Versus_Predict(const versusState_t* state, uint32_t elapsedMS, int8_t* x, int8_t* y) {
+    uint32_t rows = 0;
+    uint32_t shifts = 0;
+    int px = state->pieceX;
+    int py = state->pieceY;
+
+    if (elapsedMS > LINK_TIMEOUT_MS) {
+        elapsedMS = LINK_TIMEOUT_MS;
+    }
+    // Where the peer's timers were when it sampled is not sent, so steps
+    // are rounded, half of one being due on average
+    rows = state->rowTimeUS ? (elapsedMS * 1000 + state->rowTimeUS / 2) / state->rowTimeUS : VERSUS_ROWS;
+    shifts = (state->shift && state->repeatMS) ? (elapsedMS + state->repeatMS / 2) / state->repeatMS : 0;
+
+    for (; shifts > 0 && Versus_Fits(state, px + state->shift, py); shifts--) {
+        px += state->shift;
+    }
+    for (; rows > 0 && Versus_Fits(state, px, py + 1); rows--) {
+        py++;
+    }
+
+    *x = (int8_t)px;
+    *y = (int8_t)py;
+}
+
+// Versus_State
+// Keeps the newest peer state. A state for the same falling piece checks
+// where the last one predicted the piece would be by now.
+// Return: void
+static void Versus_State(const versusState_t* state, uint32_t now) {
+    int8_t x = 0;
+    int8_t y = 0;
+
+    if (peerValid && (int16_t)(state->tick - peer.tick) <= 0 &&
+        (uint16_t)(peer.tick - state->tick) < VERSUS_STALE_TICKS) {
+        stats.staleStates++;
+        return;
+    }
+
+    if (peerValid && (peer.flags & VERSUS_FLAG_PLAYING) && state->pieceType != VERSUS_NO_PIECE &&
+        state->pieceType == peer.pieceType && state->pieceY >= peer.pieceY) {
+        Versus_Predict(&peer, now - peerAt, &x, &y);
+        stats.predictions++;
+        if (x != state->pieceX || y != state->pieceY || state->pieceMask != peer.pieceMask) {
+            stats.mispredictions++;
+        }
+    }
+
+    peer = *state;
+    peerAt = now;
+    peerValid = true;
+    stats.states++;
+}
+
+// Versus_Deliver
+// Takes a message from the link.
+// Return: void
+static void Versus_Deliver(uint8_t type, const uint8_t* payload, uint16_t length, uint32_t now) {
+    versusState_t state;
+    uint32_t seed = 0;
+
+    switch (type) {
+        case VERSUS_START:
+            if (length != sizeof(seed)) {
+                break;
+            }
+            memcpy(&seed, payload, sizeof(seed));
+
+            // Both started at once: the lower seed is played, so only one
+            // side restarts
+            if (phase == VERSUS_PLAYING && (int32_t)(now - startedAt) < VERSUS_START_WINDOW_MS &&
+                seed >= gameSeed) {
+                break;
+            }
+            startSeed = seed;
+            startPending = true;
+            phase = VERSUS_JOINING;
+            break;
+        case VERSUS_GARBAGE:
+            if (length != 2 || phase != VERSUS_PLAYING) {
+                break;
+            }
+            pending = (pending + payload[0] > VERSUS_MAX_PENDING) ? VERSUS_MAX_PENDING : pending + payload[0];
+            pendingHole = payload[1] % VERSUS_COLUMNS;
+            stats.linesReceived += payload[0];
+            break;
+        case VERSUS_OVER:
+            if (phase == VERSUS_PLAYING) {
+                phase = VERSUS_WON;
+                stats.wins++;
+            }
+            break;
+        case VERSUS_STATE:
+            if (length == sizeof(state)) {
+                memcpy(&state, payload, sizeof(state));
+                Versus_State(&state, now);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/*******************************Private Functions***********************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisVersus_Init
+// Starts the link on a transport with no game in play.
+// Param linkWrite_t "write": sends a whole frame or nothing
+// Param uint8_t "session": differs from the last start, see TetrisLink_Init
+// Return: void
+void TetrisVersus_Init(linkWrite_t write, uint8_t session) {
+    TetrisLink_Init(write, Versus_Deliver, session);
+    phase = VERSUS_IDLE;
+    startPending = false;
+    pending = 0;
+    peerValid = false;
+    memset(&stats, 0, sizeof(stats));
+}
+
+// TetrisVersus_GetStats
+// Gets game and prediction counts since TetrisVersus_Init.
+// Param versusStats_t* "current": destination
+// Return: void
+void TetrisVersus_GetStats(versusStats_t* current) {
+    *current = stats;
+}
+
+// TetrisVersus_Receive
+// Takes bytes from the link's transport.
+// Param const uint8_t* "data": received bytes
+// Param uint32_t "length": bytes
+// Param uint32_t "now": time in ms
+// Return: void
+void TetrisVersus_Receive(const uint8_t* data, uint32_t length, uint32_t now) {
+    TetrisLink_Receive(data, length, now);
+}
+
+// TetrisVersus_Update
+// Sends this board's state each VERSUS_TICK_MS, also between games so the
+// link stays up, then lets the link resend and acknowledge.
+// Param versusState_t* "local": this board, tick and pending are filled in
+// Param uint32_t "now": time in ms
+// Return: void
+void TetrisVersus_Update(versusState_t* local, uint32_t now) {
+    if ((int32_t)(now - lastTick) >= VERSUS_TICK_MS) {
+        lastTick = now;
+        local->tick = tick++;
+        local->pending = pending;
+        if (phase != VERSUS_PLAYING) {
+            local->flags &= (uint8_t)~VERSUS_FLAG_PLAYING;
+        }
+        TetrisLink_Send(VERSUS_STATE, local, sizeof(*local), now);
+    }
+
+    TetrisLink_Update(now);
+}
+
+// TetrisVersus_IsConnected
+// Param uint32_t "now": time in ms
+// Return: bool, true if the peer board is heard
+bool TetrisVersus_IsConnected(uint32_t now) {
+    return TetrisLink_IsConnected(now);
+}
+
+// TetrisVersus_NewGame
+// Starts a versus game if a peer is there. A game the peer started is
+// joined quietly, any other start is sent to the peer.
+// Param uint32_t "seed": seed the game's pieces are dealt from
+// Param uint32_t "now": time in ms
+// Return: void
+void TetrisVersus_NewGame(uint32_t seed, uint32_t now) {
+    bool joined = (phase == VERSUS_JOINING && seed == startSeed);
+
+    gameSeed = seed;
+    startedAt = now;
+    pending = 0;
+    holeState = seed ? seed : 1;
+
+    if (!joined && !TetrisLink_IsConnected(now)) {
+        phase = VERSUS_IDLE;
+        return;
+    }
+    if (!joined) {
+        TetrisLink_Send(VERSUS_START, &seed, sizeof(seed), now);
+    }
+    phase = VERSUS_PLAYING;
+    stats.games++;
+}
+
+// TetrisVersus_TakeStart
+// Gets the seed of a game the peer started, once.
+// Param uint32_t* "seed": destination
+// Return: bool, true if a game is to be started with it
+bool TetrisVersus_TakeStart(uint32_t* seed) {
+    if (!startPending) {
+        return false;
+    }
+    startPending = false;
+    *seed = startSeed;
+    return true;
+}
+
+// TetrisVersus_LinesCleared
+// Turns cleared lines into an attack. It cancels garbage waiting here
+// first and the rest goes to the peer.
+// Param uint8_t "lines": lines cleared by one piece
+// Param uint32_t "now": time in ms
+// Return: void
+void TetrisVersus_LinesCleared(uint8_t lines, uint32_t now) {
+    static const uint8_t attacks[] = VERSUS_ATTACKS;
+    uint8_t attack = attacks[(lines > 4) ? 4 : lines];
+    uint8_t cancel = (attack < pending) ? attack : pending;
+    uint8_t garbage[2];
+
+    if (phase != VERSUS_PLAYING) {
+        return;
+    }
+
+    pending -= cancel;
+    attack -= cancel;
+    stats.linesCancelled += cancel;
+    if (attack == 0) {
+        return;
+    }
+
+    garbage[0] = attack;
+    garbage[1] = (uint8_t)(Versus_Random() % VERSUS_COLUMNS);
+    if (TetrisLink_Send(VERSUS_GARBAGE, garbage, sizeof(garbage), now)) {
+        stats.linesSent += attack;
+    }
+}
+
+// TetrisVersus_TakeGarbage
+// Gets the garbage to raise now, after a piece locked without clearing.
+// Param uint8_t* "hole": column left open in every garbage row
+// Return: uint8_t, rows of garbage, 0 for none
+uint8_t TetrisVersus_TakeGarbage(uint8_t* hole) {
+    uint8_t lines = pending;
+
+    if (phase != VERSUS_PLAYING) {
+        return 0;
+    }
+    pending = 0;
+    *hole = pendingHole;
+    return lines;
+}
+
+// TetrisVersus_Lost
+// Tells the peer this board topped out.
+// Param uint32_t "now": time in ms
+// Return: void
+void TetrisVersus_Lost(uint32_t now) {
+    if (phase != VERSUS_PLAYING) {
+        return;
+    }
+    phase = VERSUS_LOST;
+    stats.losses++;
+    TetrisLink_Send(VERSUS_OVER, 0, 0, now);
+}
+
+// TetrisVersus_GetPhase
+// Return: versusPhase_t
+versusPhase_t TetrisVersus_GetPhase(void) {
+    return phase;
+}
+
+// TetrisVersus_PackBoard
+// Packs placed cells into a state's rows.
+// Param const uint8_t** "board": cell values 0 to 15, no falling piece
+// Param versusState_t* "state": destination
+// Return: void
+void TetrisVersus_PackBoard(const uint8_t board[VERSUS_ROWS][VERSUS_COLUMNS], versusState_t* state) {
+    int i = 0;
+    int j = 0;
+
+    for (i = 0; i < VERSUS_ROWS; i++) {
+        for (j = 0; j < VERSUS_ROW_BYTES; j++) {
+            state->rows[i][j] = (uint8_t)((board[i][2 * j] & 0x0F) | (board[i][2 * j + 1] << 4));
+        }
+    }
+}
+
+// TetrisVersus_PieceMask
+// Param const uint8_t** "piece": piece cells as turned, 0 where empty
+// Return: uint16_t, bit 4 * row + column set for each filled cell
+uint16_t TetrisVersus_PieceMask(const uint8_t piece[VERSUS_PIECE_SIZE][VERSUS_PIECE_SIZE]) {
+    uint16_t mask = 0;
+    int i = 0;
+    int j = 0;
+
+    for (i = 0; i < VERSUS_PIECE_SIZE; i++) {
+        for (j = 0; j < VERSUS_PIECE_SIZE; j++) {
+            if (piece[i][j]) {
+                mask |= (uint16_t)(1 << (VERSUS_PIECE_SIZE * i + j));
+            }
+        }
+    }
+    return mask;
+}
+
+// TetrisVersus_PeerBoard
+// Builds the peer's board with its piece where it is predicted to be now:
+// the newest state moved on by the time since it arrived and half a
+// round trip for its way here.
+// Param uint32_t "now": time in ms
+// Param uint8_t** "board": destination, cell values as on this board
+// Return: bool, false if the peer isn't heard
+bool TetrisVersus_PeerBoard(uint32_t now, uint8_t board[VERSUS_ROWS][VERSUS_COLUMNS]) {
+    linkStats_t link;
+    int8_t x = 0;
+    int8_t y = 0;
+    int i = 0;
+    int j = 0;
+
+    if (!peerValid || !TetrisLink_IsConnected(now)) {
+        return false;
+    }
+
+    for (i = 0; i < VERSUS_ROWS; i++) {
+        for (j = 0; j < VERSUS_COLUMNS; j++) {
+            board[i][j] = Versus_Cell(&peer, i, j);
+        }
+    }
+
+    if (peer.pieceType == VERSUS_NO_PIECE || !(peer.flags & VERSUS_FLAG_PLAYING)) {
+        return true;
+    }
+
+    TetrisLink_GetStats(&link);
+    Versus_Predict(&peer, now - peerAt + link.rttMS / 2, &x, &y);
+    for (i = 0; i < VERSUS_PIECE_SIZE; i++) {
+        for (j = 0; j < VERSUS_PIECE_SIZE; j++) {
+            if ((peer.pieceMask & (1 << (VERSUS_PIECE_SIZE * i + j))) && y + i >= 0 && y + i < VERSUS_ROWS &&
+                x + j >= 0 && x + j < VERSUS_COLUMNS) {
+                board[y + i][x + j] = peer.pieceType + 1;
+            }
+        }
+    }
+    return true;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,68 @@
+// tetris_adpcm.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// IMA-ADPCM codec for audio assets in flash, 4 bits per sample in
+// independent blocks. The encoder runs in the host tools, the streaming
+// decoder in the audio refill.
+
+#ifndef TETRIS_ADPCM_H_
+#define TETRIS_ADPCM_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// A block is a 4 byte header (predictor low, high, step index, 0) and then
+// two samples per byte, low nibble first. Each block restarts the decoder,
+// so errors stay inside one block.
+#define ADPCM_BLOCK_SAMPLES     256
+#define ADPCM_HEADER_BYTES      4
+#define ADPCM_BLOCK_BYTES       (ADPCM_HEADER_BYTES + ADPCM_BLOCK_SAMPLES / 2)
+
+// Bytes holding a number of samples
+#define ADPCM_BYTES(samples)    ((((samples) + ADPCM_BLOCK_SAMPLES - 1) / ADPCM_BLOCK_SAMPLES) * ADPCM_HEADER_BYTES + \
+                                 ((samples) + 1) / 2)
+
+/*************************************Defines***************************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Position of a decode through an asset
+typedef struct {
+    const uint8_t* next;            // byte holding the next sample
+    uint32_t left;                  // samples left in the asset
+    uint16_t blockLeft;             // samples left in this block
+    int32_t predictor;
+    uint8_t index;                  // step table index, 0 to 88
+    bool high;                      // next sample is the high nibble
+} adpcmDecoder_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+uint32_t TetrisADPCM_Encode(const int16_t* samples, uint32_t count, uint8_t* data);
+
+void TetrisADPCM_Start(adpcmDecoder_t* decoder, const uint8_t* data, uint32_t count);
+uint16_t TetrisADPCM_Decode(adpcmDecoder_t* decoder, int16_t* samples, uint16_t count);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_ADPCM_H_ */
@@ -0,0 +1,85 @@
+// tetris_ai.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-19
+// Autoplayer placement search for Tetris
+
+#ifndef TETRIS_AI_H_
+#define TETRIS_AI_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../threads.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Number of quarter turns a piece can take
+#define AI_ROTATIONS            4
+
+// Upper bound of placements for one piece (rotations * columns)
+#define AI_MAX_PLACEMENTS       (AI_ROTATIONS * (BOARD_WIDTH + PIECE_SIZE))
+
+// Per-piece search budget. The search stops refining next-piece candidates
+// once either bound is reached and returns the best fully refined move.
+#define AI_EVAL_BUDGET          1200
+#define AI_TIME_BUDGET_US       20000
+
+// Heuristic weights, fixed point (x100)
+#define AI_WEIGHT_LINES         76
+#define AI_WEIGHT_HEIGHT        -51
+#define AI_WEIGHT_HOLES         -36
+#define AI_WEIGHT_BUMPINESS     -18
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Chosen placement, relative to the spawn orientation of the current piece
+typedef struct {
+    uint8_t rotations;      // clockwise quarter turns to apply
+    int8_t x;               // target currentPieceX
+    int8_t y;               // landing currentPieceY
+    int32_t score;
+} tetrisMove_t;
+
+// Search statistics
+typedef struct {
+    uint32_t searches;
+    uint32_t lastEvaluations;
+    uint32_t lastElapsedUS;
+    uint32_t totalEvaluations;
+    uint64_t totalElapsedUS;
+    uint32_t budgetHits;
+} tetrisAIStats_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisAI_Init(void);
+bool TetrisAI_FindMove(uint8_t board[BOARD_HEIGHT][BOARD_WIDTH], uint8_t currentType, uint8_t nextType, tetrisMove_t* move);
+void TetrisAI_GetStats(tetrisAIStats_t* stats);
+uint32_t TetrisAI_GetEvalsPerSecond(void);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_AI_H_ */
@@ -0,0 +1,78 @@
+// tetris_console.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Line-oriented command console for tuning a running game. Commands and
+// tunables are looked up in constant tables, lines are split in place, so
+// nothing is allocated.
+
+#ifndef TETRIS_CONSOLE_H_
+#define TETRIS_CONSOLE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define CONSOLE_ECHO            1       // typed characters are sent back
+#define CONSOLE_LINE_LENGTH     64
+#define CONSOLE_MAX_ARGS        4       // command name included
+#define CONSOLE_PROMPT          "> "
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+// Prints console output, UARTprintf formats
+typedef void (*consolePrint_t)(const char* format, ...);
+
+// Runs a command, argv[0] is its name. Returns false to print its usage.
+typedef bool (*consoleRun_t)(uint8_t argc, char** argv);
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+typedef struct {
+    const char* name;
+    const char* usage;          // arguments and what it does
+    consoleRun_t run;
+} consoleCommand_t;
+
+typedef struct {
+    uint32_t lines;
+    uint32_t errors;            // unknown commands and bad arguments
+    uint32_t overflows;         // lines cut at CONSOLE_LINE_LENGTH
+} consoleStats_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisConsole_Init(const consoleCommand_t* commands, uint8_t count, consolePrint_t print);
+void TetrisConsole_GetStats(consoleStats_t* stats);
+
+void TetrisConsole_Input(char c);
+void TetrisConsole_Execute(char* line);
+
+bool TetrisConsole_ParseNumber(const char* text, uint32_t* value);
+bool TetrisConsole_ParseSwitch(const char* text, bool* on);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_CONSOLE_H_ */
@@ -0,0 +1,110 @@
+// tetris_dsp.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-19
+// Packed 16 bit arithmetic for audio rendering. On the Cortex-M4 these
+// map to single SIMD instructions, other targets (the host tools) get
+// plain C with the same results. Also the cycle counter for profiling.
+
+#ifndef TETRIS_DSP_H_
+#define TETRIS_DSP_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Cortex-M4 debug cycle counter
+#define DSP_DEMCR               (*(volatile uint32_t*)0xE000EDFC)
+#define DSP_DEMCR_TRCENA        0x01000000
+#define DSP_DWT_CTRL            (*(volatile uint32_t*)0xE0001000)
+#define DSP_DWT_CYCCNTENA       0x00000001
+#define DSP_DWT_CYCCNT          (*(volatile uint32_t*)0xE0001004)
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+// TetrisDSP_Pack
+// Return: uint32_t, lo in bits 15:0 and hi in bits 31:16 (PKHBT)
+static inline uint32_t TetrisDSP_Pack(int16_t lo, int16_t hi) {
+    return ((uint32_t)(uint16_t)lo) | ((uint32_t)(uint16_t)hi << 16);
+}
+
+// TetrisDSP_Smlad
+// Dual 16 x 16 multiply, both products added to an accumulator (SMLAD).
+// Return: int32_t, acc + x.lo * y.lo + x.hi * y.hi
+static inline int32_t TetrisDSP_Smlad(uint32_t x, uint32_t y, int32_t acc) {
+#if defined(__TI_ARM_V7M4__)
+    return _smlad(x, y, acc);
+#else
+    return acc + ((int32_t)(int16_t)x * (int16_t)y) + ((int32_t)(int16_t)(x >> 16) * (int16_t)(y >> 16));
+#endif
+}
+
+// TetrisDSP_QAdd
+// Adds two words, saturating to 32 bits (QADD).
+// Return: int32_t
+static inline int32_t TetrisDSP_QAdd(int32_t x, int32_t y) {
+#if defined(__TI_ARM_V7M4__)
+    return _sadd(x, y);
+#else
+    int64_t sum = (int64_t)x + y;
+
+    return (sum > INT32_MAX) ? INT32_MAX : ((sum < INT32_MIN) ? INT32_MIN : (int32_t)sum);
+#endif
+}
+
+// TetrisDSP_QAdd16
+// Adds two pairs of samples, each half saturating to 16 bits (QADD16).
+// Return: uint32_t
+static inline uint32_t TetrisDSP_QAdd16(uint32_t x, uint32_t y) {
+#if defined(__TI_ARM_V7M4__)
+    return _qadd16(x, y);
+#else
+    int32_t lo = (int32_t)(int16_t)x + (int16_t)y;
+    int32_t hi = (int32_t)(int16_t)(x >> 16) + (int16_t)(y >> 16);
+
+    lo = (lo > INT16_MAX) ? INT16_MAX : ((lo < INT16_MIN) ? INT16_MIN : lo);
+    hi = (hi > INT16_MAX) ? INT16_MAX : ((hi < INT16_MIN) ? INT16_MIN : hi);
+    return TetrisDSP_Pack((int16_t)lo, (int16_t)hi);
+#endif
+}
+
+// TetrisDSP_SatQ15
+// Scales a Q30 product sum back to Q15 and saturates it (SSAT, ASR #15).
+// Return: int16_t
+static inline int16_t TetrisDSP_SatQ15(int32_t acc) {
+#if defined(__TI_ARM_V7M4__)
+    return (int16_t)_ssata(acc, 15, 16);
+#else
+    acc >>= 15;
+    return (int16_t)((acc > INT16_MAX) ? INT16_MAX : ((acc < INT16_MIN) ? INT16_MIN : acc));
+#endif
+}
+
+// TetrisDSP_CyclesInit
+// Starts the cycle counter, other targets have none.
+// Return: void
+static inline void TetrisDSP_CyclesInit(void) {
+#if defined(__TI_ARM_V7M4__)
+    DSP_DEMCR |= DSP_DEMCR_TRCENA;
+    DSP_DWT_CTRL |= DSP_DWT_CYCCNTENA;
+#endif
+}
+
+// TetrisDSP_Cycles
+// Return: uint32_t, core clock cycles, wrapping; 0 off the board
+static inline uint32_t TetrisDSP_Cycles(void) {
+#if defined(__TI_ARM_V7M4__)
+    return DSP_DWT_CYCCNT;
+#else
+    return 0;
+#endif
+}
+
+/********************************Public Functions***********************************/
+
+#endif /* TETRIS_DSP_H_ */
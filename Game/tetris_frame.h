@@ -0,0 +1,55 @@
+// tetris_frame.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Byte stuffed frames with a CRC-16, shared by the telemetry stream and
+// the link between boards. A frame is a 0 byte, then COBS of the data and
+// its CRC (little endian), then a 0 byte, so a reader can find frame
+// boundaries anywhere in a stream and drop damaged frames.
+
+#ifndef TETRIS_FRAME_H_
+#define TETRIS_FRAME_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define FRAME_DELIMITER             0
+#define FRAME_CRC_BYTES             2
+
+// Encoded size of raw bytes, CRC included: one code byte per 254 bytes
+// and the two delimiters
+#define FRAME_MAX_ENCODED(raw)      ((raw) + (raw) / 254 + 3)
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+uint16_t TetrisFrame_Encode(uint8_t* raw, uint16_t length, uint8_t* out);
+int16_t TetrisFrame_Decode(const uint8_t* data, uint16_t length, uint8_t* out, uint16_t size);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_FRAME_H_ */
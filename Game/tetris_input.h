@@ -0,0 +1,145 @@
+// tetris_input.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Delayed auto-shift, auto-repeat and lock delay timing for Tetris, and
+// the joystick classifier and button debouncer producing input events
+
+#ifndef TETRIS_INPUT_H_
+#define TETRIS_INPUT_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Default timing, in milliseconds
+#define INPUT_DAS_MS            150     // delay before a held direction repeats
+#define INPUT_ARR_MS            40      // repeat period once DAS has elapsed, 0 = instant
+#define INPUT_LOCK_DELAY_MS     500     // time a grounded piece may still move
+#define INPUT_LOCK_RESETS       15      // moves/rotations that may restart lock delay
+
+// Longest shift a single update can produce
+#define INPUT_MAX_SHIFT         16
+
+// Default stick thresholds, in ADC counts from the calibrated center
+#define INPUT_STICK_PRESS       640     // offset that presses a direction
+#define INPUT_STICK_RELEASE     384     // offset below which it is released
+
+// Buttons SW1..SW4, bits 1..4 of the PCA9555 port
+#define INPUT_BUTTONS           4
+#define INPUT_BUTTON_MASK(b)    (0x02 << (b))
+#define INPUT_DEBOUNCE_MS       10      // changes ignored after a press / release
+
+// Most events one classifier or debouncer update can produce
+#define INPUT_MAX_EVENTS        4
+
+// Latency histogram, bucket n counts latencies under 2^n ms, the last
+// bucket everything longer
+#define INPUT_LATENCY_BUCKETS   8
+
+// Input events are packed in one FIFO word:
+// [31:28] source, [27:24] kind, [23:20] code, [19:16] count, [15:0] time in ms
+#define INPUT_EVENT_MAX_COUNT   15
+#define INPUT_EVENT(source, kind, code, count, time) \
+    (((uint32_t)(source) << 28) | ((uint32_t)(kind) << 24) | ((uint32_t)(code) << 20) | \
+     ((uint32_t)(count) << 16) | ((uint32_t)(time) & 0xFFFF))
+#define INPUT_EVENT_SOURCE(event)   (((event) >> 28) & 0xF)
+#define INPUT_EVENT_KIND(event)     (((event) >> 24) & 0xF)
+#define INPUT_EVENT_CODE(event)     (((event) >> 20) & 0xF)
+#define INPUT_EVENT_COUNT(event)    (((event) >> 16) & 0xF)
+#define INPUT_EVENT_TIME(event)     ((event) & 0xFFFF)
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef enum {
+    INPUT_SOURCE_JOYSTICK = 0,
+    INPUT_SOURCE_BUTTON,
+    INPUT_SOURCE_MOTION,
+    INPUT_SOURCE_MIC,
+    INPUT_SOURCES
+} inputSource_t;
+
+typedef enum {
+    INPUT_PRESS = 0,
+    INPUT_REPEAT,               // held past DAS, count is cells to shift
+    INPUT_RELEASE
+} inputKind_t;
+
+typedef enum {
+    INPUT_LEFT = 0,
+    INPUT_RIGHT,
+    INPUT_DOWN,
+    INPUT_UP
+} inputCode_t;
+
+// Codes of button events
+typedef enum {
+    INPUT_SW1 = 0,
+    INPUT_SW2,
+    INPUT_SW3,
+    INPUT_SW4
+} inputButton_t;
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Tunable timing
+typedef struct {
+    uint16_t dasMS;
+    uint16_t arrMS;
+    uint16_t lockDelayMS;
+    uint8_t lockResets;
+    uint16_t stickPress;
+    uint16_t stickRelease;
+    uint16_t debounceMS;
+} inputConfig_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisInput_Init(void);
+void TetrisInput_SetConfig(inputConfig_t* config);
+void TetrisInput_GetConfig(inputConfig_t* config);
+
+int8_t TetrisInput_Shift(int8_t direction, uint32_t now);
+uint8_t TetrisInput_Stick(int16_t x, int16_t y, uint32_t now, uint32_t* events);
+
+void TetrisInput_ButtonEdge(uint32_t now);
+void TetrisInput_ButtonSample(uint8_t pressed);
+uint8_t TetrisInput_Buttons(uint32_t now, uint32_t* events);
+
+void TetrisInput_RecordLatency(uint32_t event, uint32_t now);
+void TetrisInput_GetLatency(uint8_t source, uint32_t* histogram);
+void TetrisInput_ResetLatency(void);
+
+void TetrisInput_NewPiece(void);
+void TetrisInput_Airborne(void);
+void TetrisInput_Grounded(uint32_t now, int32_t row);
+void TetrisInput_LockReset(uint32_t now);
+bool TetrisInput_IsGrounded(void);
+bool TetrisInput_LockDue(uint32_t now);
+uint32_t TetrisInput_LockDeadline(void);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_INPUT_H_ */
@@ -0,0 +1,76 @@
+// tetris_leds.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// LED matrix animations on the PCA9956b for Tetris
+
+#ifndef TETRIS_LEDS_H_
+#define TETRIS_LEDS_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Frame period of TetrisLEDs_Update, ms
+#define LEDS_FRAME_PERIOD       20
+
+// 4x4 matrix, cell (row, col) is channel LEDS_FIRST_CHANNEL + row + 4 * col
+#define LEDS_SIZE               4
+#define LEDS_FIRST_CHANNEL      4
+#define LEDS_CHANNEL(row, col)  (LEDS_FIRST_CHANNEL + (row) + (LEDS_SIZE * (col)))
+
+#define LEDS_IREF               0xFF    // default output current
+
+// Brightness change per frame when a cell fades in or out
+#define LEDS_FADE_STEP          32
+
+// Line clear flash, hardware blink at 50 % duty, ~4 Hz
+#define LEDS_FLASH_FREQ         3       // (3 + 1) / 15.26 s period
+#define LEDS_FLASH_DUTY         0x80
+#define LEDS_FLASH_FRAMES       25      // per cleared line
+
+// Level up sweep, frames each column stays lit
+#define LEDS_SWEEP_FRAMES       4
+#define LEDS_SWEEP_PASSES       3
+
+// Game over fade, group dimming step per frame
+#define LEDS_DIM_STEP           8
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisLEDs_Init(void);
+void TetrisLEDs_ShowPattern(const uint8_t pattern[LEDS_SIZE][LEDS_SIZE]);
+void TetrisLEDs_LineClear(uint8_t lines);
+void TetrisLEDs_LevelUp(void);
+void TetrisLEDs_Off(void);
+void TetrisLEDs_SetIREF(uint8_t iref);
+
+void TetrisLEDs_Update(void);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_LEDS_H_ */
@@ -0,0 +1,76 @@
+// tetris_level.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-19
+// Level progression, gravity curve and scoring for Tetris
+
+#ifndef TETRIS_LEVEL_H_
+#define TETRIS_LEVEL_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define LEVEL_START             1
+#define LEVEL_MAX               20      // gravity stops increasing past this level
+#define LEVEL_LINES_PER_LEVEL   10
+
+// Gravity runs at this percentage of the level table's speed
+#define LEVEL_SPEED_PERCENT     100
+
+// Soft drop falls this many times faster than the level gravity
+#define LEVEL_SOFT_DROP_FACTOR  20
+
+// Most rows gravity can move a piece in one update
+#define LEVEL_MAX_ROWS          16
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Tunable drop speeds
+typedef struct {
+    uint16_t speedPercent;
+    uint8_t softDropFactor;
+} levelConfig_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisLevel_Init(uint8_t startLevel);
+void TetrisLevel_SetLevel(uint8_t level);
+void TetrisLevel_SetConfig(levelConfig_t* config);
+void TetrisLevel_GetConfig(levelConfig_t* config);
+
+uint32_t TetrisLevel_AddLines(uint8_t lines);
+uint8_t TetrisLevel_GetLevel(void);
+uint32_t TetrisLevel_GetLines(void);
+uint32_t TetrisLevel_GetRowTimeUS(bool softDrop);
+
+void TetrisLevel_ResetGravity(void);
+uint8_t TetrisLevel_Gravity(uint32_t elapsedUS, bool softDrop);
+uint32_t TetrisLevel_NextRowUS(bool softDrop);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_LEVEL_H_ */
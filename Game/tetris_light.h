@@ -0,0 +1,64 @@
+// tetris_light.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Ambient light auto-brightness for the display and LED matrix
+
+#ifndef TETRIS_LIGHT_H_
+#define TETRIS_LIGHT_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../MultimodDrivers/multimod_OPT3001.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Auto range, 100 ms continuous conversions, latched window, INT after
+// four conversions outside the window
+#define LIGHT_CONFIG            ((OPT3001_CONFIG_AUTOFS << OPT3001_CONFIG_RANGE_S) | OPT3001_CONFIG_M | \
+                                 OPT3001_CONFIG_L | OPT3001_CONFIG_FC_4)
+
+// Window around the last level, +-1/4 of it but never narrower than the minimum
+#define LIGHT_WINDOW_SHIFT      2
+#define LIGHT_MIN_WINDOW        500     // hundredths of a lux
+
+// Brightness follows log2 of the light level
+#define LIGHT_DARK_OCTAVE       8       // 2.56 lux and below is darkest
+#define LIGHT_LEVEL_PER_OCTAVE  32
+#define LIGHT_BACKLIGHT_MIN     32
+#define LIGHT_IREF_MIN          0x20
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisLight_Init(void);
+void TetrisLight_Handler(void);
+bool TetrisLight_TakeBacklight(uint8_t* level);
+uint32_t TetrisLight_GetLux(void);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_LIGHT_H_ */
@@ -0,0 +1,106 @@
+// tetris_link.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Message link between two boards over a byte stream. Messages travel in
+// CRC checked frames (tetris_frame.h). Reliable messages are numbered,
+// acknowledged by the peer and resent until they are; the others are sent
+// once and may be lost. Nothing here knows the transport, so the same code
+// runs on a UART and in the host simulation.
+
+#ifndef TETRIS_LINK_H_
+#define TETRIS_LINK_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "tetris_frame.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Header: type, session, sequence, acknowledgement. The sequence of a
+// reliable message is its own number; any other frame carries the oldest
+// number still unacknowledged, so a new peer learns where to start. The
+// acknowledgement is the next reliable number expected from the peer, so
+// every frame acknowledges everything before it.
+#define LINK_HEADER_BYTES       4
+#define LINK_MAX_PAYLOAD        96
+#define LINK_MAX_RAW            (LINK_HEADER_BYTES + LINK_MAX_PAYLOAD + FRAME_CRC_BYTES)
+#define LINK_MAX_FRAME          FRAME_MAX_ENCODED(LINK_MAX_RAW)
+
+// Message types are 1 to 63. Set LINK_RELIABLE for messages that must
+// arrive, in order and once. Type 0 is the link's own acknowledgement and
+// keepalive. LINK_ACK_VALID marks frames from a sender that knows where
+// our numbering is, only their acknowledgements count.
+#define LINK_RELIABLE           0x80
+#define LINK_ACK_VALID          0x40
+#define LINK_TYPE_MASK          0x3F
+#define LINK_TYPE_ACK           0x00
+
+// Reliable messages in flight, power of two. A full window refuses sends.
+#define LINK_WINDOW             4
+
+// Timing, ms
+#define LINK_RETRANSMIT_MS      120     // unacknowledged messages are resent after
+#define LINK_KEEPALIVE_MS       250     // an idle link sends an acknowledgement this often
+#define LINK_TIMEOUT_MS         1000    // a peer silent this long is gone
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+// Sends one encoded frame, all of it or none of it
+typedef bool (*linkWrite_t)(const uint8_t* frame, uint16_t length);
+
+// Hands a received message up. Reliable messages come in order, once.
+typedef void (*linkDeliver_t)(uint8_t type, const uint8_t* payload, uint16_t length, uint32_t now);
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+typedef struct {
+    uint32_t framesSent;
+    uint32_t bytesSent;
+    uint32_t framesReceived;
+    uint32_t badFrames;         // CRC, length or header errors
+    uint32_t retransmits;       // frames sent again
+    uint32_t duplicates;        // reliable frames already delivered, or ahead of a loss
+    uint32_t windowFull;        // reliable sends refused
+    uint32_t writeFailures;     // frames the transport had no room for
+    uint32_t peers;             // sessions seen, more than 1 means the peer restarted
+    uint32_t rttMS;             // last round trip of a message sent once
+} linkStats_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisLink_Init(linkWrite_t write, linkDeliver_t deliver, uint8_t session);
+void TetrisLink_GetStats(linkStats_t* stats);
+
+bool TetrisLink_Send(uint8_t type, const void* payload, uint16_t length, uint32_t now);
+void TetrisLink_Receive(const uint8_t* data, uint32_t length, uint32_t now);
+void TetrisLink_Update(uint32_t now);
+
+bool TetrisLink_IsConnected(uint32_t now);
+uint8_t TetrisLink_Pending(void);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_LINK_H_ */
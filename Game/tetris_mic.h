@@ -0,0 +1,90 @@
+// tetris_mic.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Clap-to-drop and whistle-to-fall control from blocks of mic samples,
+// with the level of each block for display
+
+#ifndef TETRIS_MIC_H_
+#define TETRIS_MIC_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Levels are in ADC counts from the tracked DC offset
+#define MIC_DC_SHIFT            3       // DC follows block means with weight 1/8
+#define MIC_FLOOR_SHIFT         4       // background RMS weight 1/16 per quiet block
+
+// Clap, a short sharp peak well over the background
+#define MIC_CLAP_PEAK           1200    // counts
+#define MIC_CLAP_CREST          4       // peak at least this times the block RMS
+#define MIC_CLAP_RISE           6       // and this times the background RMS
+#define MIC_CLAP_HOLDOFF_MS     300     // one hard drop per clap
+
+// Whistle, Goertzel power in one bin as a share of the block, Q8. 0 Hz
+// turns the detector off.
+#define MIC_TONE_HZ             0
+#define MIC_TONE_SHARE          128     // half the block's energy
+#define MIC_TONE_MIN_RMS        60      // counts
+#define MIC_TONE_BLOCKS         3       // consecutive blocks to press
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Tunable thresholds
+typedef struct {
+    bool enabled;
+    uint16_t clapPeak;
+    uint8_t clapCrest;
+    uint8_t clapRise;
+    uint16_t clapHoldoffMS;
+    uint16_t toneHz;
+    uint16_t toneShare;             // Q8
+    uint16_t toneMinRMS;
+} micConfig_t;
+
+// Measurements of the last block
+typedef struct {
+    uint16_t rms;
+    uint16_t peak;
+    uint16_t background;            // slow RMS of quiet blocks
+    uint16_t toneShare;             // Q8, 0 with the detector off
+    uint32_t claps;
+    uint32_t blocks;
+} micLevel_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisMic_Init(uint32_t rate);
+void TetrisMic_SetConfig(micConfig_t* config);
+void TetrisMic_GetConfig(micConfig_t* config);
+void TetrisMic_GetLevel(micLevel_t* level);
+
+uint8_t TetrisMic_Update(const uint16_t* samples, uint16_t count, uint32_t now, uint32_t* events);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_MIC_H_ */
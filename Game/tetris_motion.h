@@ -0,0 +1,85 @@
+// tetris_motion.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Tilt-to-move and shake-to-drop control from BMI160 accelerometer frames
+
+#ifndef TETRIS_MOTION_H_
+#define TETRIS_MOTION_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "../MultimodDrivers/multimod_BMI160.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Sensor setup
+#define MOTION_ODR              BMI160_ACC_ODR_200HZ
+#define MOTION_BWP              BMI160_ACC_BWP_NORMAL
+#define MOTION_RANGE            BMI160_ACC_RANGE_4G
+#define MOTION_ONE_G            8192    // LSB per g at +-4 g
+#define MOTION_WATERMARK        4       // frames per interrupt, 20 ms at 200 Hz
+
+// Most frames handled per FIFO burst
+#define MOTION_MAX_FRAMES       (BMI160_FIFO_MAX_BURST / BMI160_FIFO_FRAME_BYTES)
+
+// Tilt, on the low-passed X axis
+#define MOTION_FILTER_SHIFT     3       // low-pass weight 1/8 per frame
+#define MOTION_TILT_PRESS       2800    // about 20 degrees
+#define MOTION_TILT_RELEASE     2100    // about 15 degrees
+#define MOTION_REPEAT_MS        120     // shift period while tilted
+
+// Shake, summed deviation of all axes from the slowly tracked gravity vector
+#define MOTION_GRAVITY_SHIFT    6
+#define MOTION_SHAKE_THRESHOLD  12288   // 1.5 g
+#define MOTION_SHAKE_HOLDOFF_MS 400     // one hard drop per shake
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Tunable sensor setup and thresholds
+typedef struct {
+    bool enabled;
+    uint8_t odr;                // BMI160_ACC_ODR_x
+    uint8_t bwp;                // BMI160_ACC_BWP_x
+    uint8_t watermark;          // frames per interrupt
+    uint8_t filterShift;
+    uint16_t tiltPress;
+    uint16_t tiltRelease;
+    uint16_t repeatMS;
+    uint16_t shakeThreshold;
+    uint16_t shakeHoldoffMS;
+} motionConfig_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisMotion_Init(void);
+void TetrisMotion_SetConfig(motionConfig_t* config);
+void TetrisMotion_GetConfig(motionConfig_t* config);
+uint8_t TetrisMotion_Update(const int16_t* frames, uint8_t count, uint32_t now, uint32_t* events);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_MOTION_H_ */
@@ -0,0 +1,86 @@
+// tetris_music.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Note sequencer playing the Tetris theme on the synthesizer, with a tempo
+// that follows the game level
+
+#ifndef TETRIS_MUSIC_H_
+#define TETRIS_MUSIC_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "tetris_synth.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Ticks are sixteenth notes
+#define MUSIC_TICKS_PER_BEAT    4
+
+// Synth voices 0 .. MUSIC_TRACKS - 1 belong to the music
+#define MUSIC_TRACKS            2
+
+// Tempo in beats per minute, rising with the level
+#define MUSIC_BPM_START         144
+#define MUSIC_BPM_PER_LEVEL     6
+#define MUSIC_BPM_MAX           240
+
+// Notes are held for this many eighths of their length, then released
+#define MUSIC_GATE_EIGHTHS      7
+
+// Note value of a rest
+#define MUSIC_REST              0
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// One note of a track, two bytes in flash
+typedef struct {
+    uint8_t note;                   // MIDI note, MUSIC_REST for silence
+    uint8_t ticks;                  // length in ticks
+} musicNote_t;
+
+// Notes played on one voice, looped
+typedef struct {
+    const musicNote_t* notes;
+    uint16_t length;
+    const synthInstrument_t* instrument;
+} musicTrack_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisMusic_Init(uint32_t rate);
+
+void TetrisMusic_Play(void);
+void TetrisMusic_Stop(void);
+void TetrisMusic_Pause(bool pause);
+void TetrisMusic_SetLevel(uint8_t level);
+bool TetrisMusic_IsPlaying(void);
+
+void TetrisMusic_Render(int16_t* samples, uint16_t count);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_MUSIC_H_ */
@@ -0,0 +1,100 @@
+// tetris_sfx.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Sound effect mixer layering short clips from flash over the music, with
+// a fixed number of voices shared by priority
+
+#ifndef TETRIS_SFX_H_
+#define TETRIS_SFX_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "tetris_adpcm.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Clips playing at once, a new clip takes over the lowest priority one
+#define SFX_VOICES              3
+
+// Rate the clips are stored at, resampled to the output rate while mixing
+#define SFX_CLIP_RATE           8000
+
+// Clip samples each voice decodes at a time
+#define SFX_CHUNK_SAMPLES       32
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+// In order of priority, posts in the same block are taken highest first
+typedef enum {
+    SFX_ROTATE = 0,
+    SFX_LOCK,
+    SFX_LINE,
+    SFX_LEVEL,
+    SFX_TETRIS,
+    SFX_GAME_OVER,
+    SFX_CLIPS
+} sfxId_t;
+
+typedef enum {
+    SFX_FORMAT_PCM8 = 0,            // signed 8 bit samples
+    SFX_FORMAT_ADPCM                // IMA-ADPCM blocks, see tetris_adpcm.h
+} sfxFormat_t;
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Clip data in flash
+typedef struct {
+    const void* data;
+    uint32_t length;                // samples
+    uint16_t rate;                  // Hz
+    sfxFormat_t format;
+} sfxClip_t;
+
+typedef struct {
+    uint32_t triggers;
+    uint32_t steals;                // clips cut short by a new one
+    uint32_t drops;                 // triggers refused, every voice outranked them
+    uint32_t decoded;               // ADPCM samples decoded
+    uint32_t decodeCycles;          // spent decoding them, 0 off the board
+} sfxStats_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+
+// Generated by tools/sfx_build.c into tetris_sfx_clips.c
+extern const sfxClip_t sfxClips[SFX_CLIPS];
+
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisSFX_Init(uint32_t rate);
+
+void TetrisSFX_Play(sfxId_t id);
+void TetrisSFX_StopAll(void);
+void TetrisSFX_GetStats(sfxStats_t* stats);
+
+void TetrisSFX_Mix(int16_t* samples, uint16_t count);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_SFX_H_ */
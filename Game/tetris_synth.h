@@ -0,0 +1,88 @@
+// tetris_synth.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Fixed-point wavetable synthesizer with ADSR envelopes for Tetris audio
+
+#ifndef TETRIS_SYNTH_H_
+#define TETRIS_SYNTH_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Voices are mixed in pairs, keep this even
+#define SYNTH_VOICES            4
+
+// One cycle per table, indexed by the top 8 bits of the phase
+#define SYNTH_WAVE_BITS         8
+#define SYNTH_WAVE_SIZE         (1 << SYNTH_WAVE_BITS)
+
+// Envelopes advance once per control period. Render counts must be a
+// multiple of it.
+#define SYNTH_CONTROL_SAMPLES   16
+
+// Envelope level, Q24
+#define SYNTH_LEVEL_FULL        (1 << 24)
+
+// Highest MIDI note with its own pitch, higher notes play this one
+#define SYNTH_NOTE_MAX          119
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef enum {
+    SYNTH_WAVE_SINE = 0,
+    SYNTH_WAVE_TRIANGLE,
+    SYNTH_WAVE_SQUARE,
+    SYNTH_WAVE_SAW,
+    SYNTH_WAVES
+} synthWave_t;
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Sound of a note, kept in flash
+typedef struct {
+    synthWave_t wave;
+    uint16_t attackMS;
+    uint16_t decayMS;
+    uint16_t sustain;               // level held after decay, Q15
+    uint16_t releaseMS;
+    uint16_t volume;                // peak gain, Q15
+} synthInstrument_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisSynth_Init(uint32_t rate);
+
+void TetrisSynth_NoteOn(uint8_t voice, uint8_t note, const synthInstrument_t* instrument);
+void TetrisSynth_NoteOff(uint8_t voice);
+void TetrisSynth_Silence(void);
+bool TetrisSynth_IsActive(uint8_t voice);
+
+void TetrisSynth_Render(int16_t* samples, uint16_t count);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_SYNTH_H_ */
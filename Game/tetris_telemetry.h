@@ -0,0 +1,141 @@
+// tetris_telemetry.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Binary telemetry frames for a host to follow the game: score, board
+// deltas, thread statistics and input events. Frames are COBS encoded with
+// a CRC-16, so a host can find frame boundaries in the console output and
+// drop damaged ones. The decoder is shared with the host tool.
+
+#ifndef TETRIS_TELEMETRY_H_
+#define TETRIS_TELEMETRY_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "tetris_frame.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define TELEMETRY_ENABLED           1       // frames are sent from startup
+
+// A frame is a 0 byte, then COBS of the header, payload and CRC-16 (little
+// endian), then a 0 byte, see tetris_frame.h. The leading 0 ends any
+// console text written since the last frame.
+#define TELEMETRY_HEADER_BYTES      4       // type, sequence, time in ms (16 bit)
+#define TELEMETRY_CRC_BYTES         FRAME_CRC_BYTES
+#define TELEMETRY_MAX_PAYLOAD       160
+#define TELEMETRY_MAX_RAW           (TELEMETRY_HEADER_BYTES + TELEMETRY_MAX_PAYLOAD + TELEMETRY_CRC_BYTES)
+#define TELEMETRY_MAX_FRAME         FRAME_MAX_ENCODED(TELEMETRY_MAX_RAW)
+
+// Board cells are 4 bits, low nibble first, so a row is 5 bytes
+#define TELEMETRY_BOARD_ROWS        16
+#define TELEMETRY_BOARD_COLUMNS     10
+#define TELEMETRY_ROW_BYTES         (TELEMETRY_BOARD_COLUMNS / 2)
+#define TELEMETRY_KEYFRAME_MS       1000    // whole board at least this often
+
+// Input events are queued by one thread and sent in batches
+#define TELEMETRY_INPUT_QUEUE       64      // power of two
+#define TELEMETRY_INPUT_BATCH       16
+
+#define TELEMETRY_MAX_THREADS       8
+#define TELEMETRY_NAME_LENGTH       8
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef enum {
+    TELEMETRY_SCORE = 1,
+    TELEMETRY_BOARD,
+    TELEMETRY_THREADS,
+    TELEMETRY_INPUT
+} telemetryType_t;
+
+// Sends one encoded frame, all of it or none of it
+typedef bool (*telemetryWrite_t)(const uint8_t* frame, uint16_t length);
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Payloads are copied as they sit in memory, fields are laid out without
+// padding and little endian on both the board and the host.
+
+// TELEMETRY_SCORE flags
+#define TELEMETRY_FLAG_GAME_OVER    0x01
+#define TELEMETRY_FLAG_PAUSED       0x02
+#define TELEMETRY_FLAG_AUTOPLAY     0x04
+
+// TELEMETRY_SCORE, sent when any field changes
+typedef struct {
+    uint32_t score;
+    uint32_t lines;
+    uint32_t pieces;
+    uint8_t level;
+    uint8_t flags;
+    uint16_t reserved;
+} telemetryScore_t;
+
+// TELEMETRY_BOARD is a 16 bit mask of the rows that follow, top row in
+// bit 0, then TELEMETRY_ROW_BYTES per row. The falling piece is drawn in.
+
+// TELEMETRY_THREADS, one entry per live thread, counters since startup
+typedef struct {
+    uint32_t runTimeUS;
+    uint32_t switches;
+    uint8_t id;
+    uint8_t priority;
+    uint8_t state;                  // 0 ready, 1 asleep, 2 blocked
+    uint8_t reserved;
+    char name[TELEMETRY_NAME_LENGTH];
+} telemetryThread_t;
+
+// TELEMETRY_INPUT is up to TELEMETRY_INPUT_BATCH input event words in the
+// order they were handled
+
+typedef struct {
+    uint32_t frames;
+    uint32_t bytes;
+    uint32_t dropped;               // frames the transport had no room for
+    uint32_t inputsLost;            // events that found the queue full
+} telemetryStats_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisTelemetry_Init(telemetryWrite_t write);
+void TetrisTelemetry_SetEnabled(bool enabled);
+bool TetrisTelemetry_IsEnabled(void);
+void TetrisTelemetry_GetStats(telemetryStats_t* stats);
+
+bool TetrisTelemetry_Send(telemetryType_t type, const void* payload, uint16_t length, uint32_t now);
+void TetrisTelemetry_Score(const telemetryScore_t* score, uint32_t now);
+void TetrisTelemetry_Board(const uint8_t board[TELEMETRY_BOARD_ROWS][TELEMETRY_BOARD_COLUMNS], uint32_t now);
+void TetrisTelemetry_Keyframe(void);
+void TetrisTelemetry_Input(uint32_t event);
+void TetrisTelemetry_FlushInput(uint32_t now);
+
+uint16_t TetrisTelemetry_Encode(telemetryType_t type, uint8_t sequence, uint16_t time,
+                                const void* payload, uint16_t length, uint8_t* frame);
+int16_t TetrisTelemetry_Decode(const uint8_t* data, uint16_t length, uint8_t* raw);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_TELEMETRY_H_ */
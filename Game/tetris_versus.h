@@ -0,0 +1,134 @@
+// tetris_versus.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Two player versus over the board link. Both boards play the same piece
+// sequence, cleared lines are sent as garbage to the other board, and each
+// board sends its own state at a fixed tick so the other can show it. The
+// peer's falling piece is moved on between states from its gravity and
+// held shift, hiding the link's latency.
+
+#ifndef TETRIS_VERSUS_H_
+#define TETRIS_VERSUS_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "tetris_link.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Board cells are 4 bits, low nibble first, so a row is 5 bytes
+#define VERSUS_ROWS                 16
+#define VERSUS_COLUMNS              10
+#define VERSUS_ROW_BYTES            (VERSUS_COLUMNS / 2)
+#define VERSUS_PIECE_SIZE           4
+#define VERSUS_NO_PIECE             0xFF
+#define VERSUS_CELL_GARBAGE         9
+
+// State frames, ms
+#define VERSUS_TICK_MS              50
+#define VERSUS_STALE_TICKS          20      // older ticks than this are a restarted peer
+
+// Both boards starting within this many ms pick the lower seed
+#define VERSUS_START_WINDOW_MS      500
+
+// Garbage waiting on a board is capped
+#define VERSUS_MAX_PENDING          12
+
+// Messages
+#define VERSUS_START                (LINK_RELIABLE | 1)     // uint32_t seed
+#define VERSUS_GARBAGE              (LINK_RELIABLE | 2)     // lines, hole column
+#define VERSUS_OVER                 (LINK_RELIABLE | 3)     // sender topped out
+#define VERSUS_STATE                4                       // versusState_t
+
+// versusState_t flags
+#define VERSUS_FLAG_PLAYING         0x01
+#define VERSUS_FLAG_FAST_DROP       0x02
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+
+typedef enum {
+    VERSUS_IDLE = 0,        // no peer when the game started
+    VERSUS_JOINING,         // the peer started a game, ours restarts with its seed
+    VERSUS_PLAYING,
+    VERSUS_WON,
+    VERSUS_LOST
+} versusPhase_t;
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// VERSUS_STATE, copied as it sits in memory like telemetry payloads. Rows
+// hold the placed cells only, the falling piece is sent apart so the
+// receiver can move it on.
+typedef struct {
+    uint16_t tick;              // set by TetrisVersus_Update
+    uint8_t flags;
+    uint8_t pieceType;          // 0 to 6, VERSUS_NO_PIECE for none
+    int8_t pieceX;
+    int8_t pieceY;
+    uint16_t pieceMask;         // piece as turned, bit 4 * row + column
+    int8_t shift;               // stick held left (-1) or right (1)
+    uint8_t pending;            // set by TetrisVersus_Update
+    uint16_t repeatMS;          // shift repeat while held
+    uint32_t rowTimeUS;         // gravity, fast drop included
+    uint8_t rows[VERSUS_ROWS][VERSUS_ROW_BYTES];
+} versusState_t;
+
+typedef struct {
+    uint32_t games;
+    uint32_t wins;
+    uint32_t losses;
+    uint32_t linesSent;
+    uint32_t linesReceived;
+    uint32_t linesCancelled;    // incoming garbage cancelled by clears
+    uint32_t states;
+    uint32_t staleStates;
+    uint32_t predictions;       // states that checked the last prediction
+    uint32_t mispredictions;    // piece not where it was predicted
+} versusStats_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void TetrisVersus_Init(linkWrite_t write, uint8_t session);
+void TetrisVersus_GetStats(versusStats_t* stats);
+
+void TetrisVersus_Receive(const uint8_t* data, uint32_t length, uint32_t now);
+void TetrisVersus_Update(versusState_t* local, uint32_t now);
+bool TetrisVersus_IsConnected(uint32_t now);
+
+void TetrisVersus_NewGame(uint32_t seed, uint32_t now);
+bool TetrisVersus_TakeStart(uint32_t* seed);
+void TetrisVersus_LinesCleared(uint8_t lines, uint32_t now);
+uint8_t TetrisVersus_TakeGarbage(uint8_t* hole);
+void TetrisVersus_Lost(uint32_t now);
+versusPhase_t TetrisVersus_GetPhase(void);
+
+void TetrisVersus_PackBoard(const uint8_t board[VERSUS_ROWS][VERSUS_COLUMNS], versusState_t* state);
+uint16_t TetrisVersus_PieceMask(const uint8_t piece[VERSUS_PIECE_SIZE][VERSUS_PIECE_SIZE]);
+bool TetrisVersus_PeerBoard(uint32_t now, uint8_t board[VERSUS_ROWS][VERSUS_COLUMNS]);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* TETRIS_VERSUS_H_ */
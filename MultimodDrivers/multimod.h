@@ -11,14 +11,20 @@
 #include "multimod_spi.h"
 #include "multimod_buttons.h"
 #include "multimod_PCA9555.h"
+#include "multimod_audio.h"
 
 static void multimod_init() {
     ST7789_Init();
     PCA9956b_Init();
     UART_Init();
+    UART_BeagleBone_Init();
     MultimodButtons_Init();
     JOYSTICK_Init();
     JOYSTICK_IntEnable();
+    BMI160_Init();
+    OPT3001_Init();
+    AudioOutput_Init();
+    AudioInput_Init();
 }
 
 #endif /* MULTIMOD_H_ */
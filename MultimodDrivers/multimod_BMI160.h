@@ -1,6 +1,6 @@
 // multimod_BMI160.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-19
 // Declarations for BMI160 functions
 
 #ifndef MULTIMOD_BMI160_H_
@@ -28,8 +28,14 @@
 
 // BMI160 Defines
 #define BMI160_ADDR                 0x69
+#define BMI160_SPEED                I2C_SPEED_400K
 #define BMI160_DEVICEID             0xD1
 
+// INT1 of the BMI160
+#define BMI160_INT_GPIO_BASE        GPIO_PORTC_BASE
+#define BMI160_INT_PIN              GPIO_PIN_6
+#define BMI160_INTERRUPT            INT_GPIOC
+
 // BMI160 Addresses
 #define BMI160_CHIPID_ADDR          0x00
 #define BMI160_ERRREG_ADDR          0x02
@@ -90,6 +96,47 @@
 #define BMI160_STATUS_DRDY_GYR      0x40
 #define BMI160_STATUS_DRDY_MAG      0x20
 
+// BMI160 Commands
+#define BMI160_CMD_ACC_NORMAL       0x11
+#define BMI160_CMD_GYR_NORMAL       0x15
+#define BMI160_CMD_FIFO_FLUSH       0xB0
+
+// Accelerometer output data rate (ACC_CONF acc_odr)
+#define BMI160_ACC_ODR_25HZ         0x06
+#define BMI160_ACC_ODR_50HZ         0x07
+#define BMI160_ACC_ODR_100HZ        0x08
+#define BMI160_ACC_ODR_200HZ        0x09
+#define BMI160_ACC_ODR_400HZ        0x0A
+#define BMI160_ACC_ODR_800HZ        0x0B
+#define BMI160_ACC_ODR_1600HZ       0x0C
+
+// Accelerometer filter bandwidth (ACC_CONF acc_bwp)
+#define BMI160_ACC_BWP_OSR4         0x00
+#define BMI160_ACC_BWP_OSR2         0x10
+#define BMI160_ACC_BWP_NORMAL       0x20
+
+// Accelerometer range (ACC_RANGE)
+#define BMI160_ACC_RANGE_2G         0x03
+#define BMI160_ACC_RANGE_4G         0x05
+#define BMI160_ACC_RANGE_8G         0x08
+#define BMI160_ACC_RANGE_16G        0x0C
+
+// FIFO, headerless accelerometer frames
+#define BMI160_FIFO_ACC_EN          0x40    // FIFO_CONFIG_1
+#define BMI160_FIFO_FRAME_BYTES     6
+#define BMI160_FIFO_LENGTH_M        0x07FF
+#define BMI160_FIFO_MAX_BURST       252     // whole frames fitting an 8-bit transfer length
+
+// Interrupt sources (INT_EN_1 bits)
+#define BMI160_INT_DATA_READY       0x10
+#define BMI160_INT_FIFO_WATERMARK   0x40
+
+// INT1 routing (INT_MAP_1) and output (INT_OUT_CTRL)
+#define BMI160_INTMAP1_DRDY         0x80
+#define BMI160_INTMAP1_FWM          0x40
+#define BMI160_INTOUT_INT1_EN       0x08
+#define BMI160_INTOUT_INT1_HIGH     0x02
+
 /*************************************Defines***************************************/
 
 /******************************Data Type Definitions********************************/
@@ -124,6 +171,14 @@ void BMI160_GyroXYZGetResult(uint16_t* data);
 void BMI160_MagXYZGetResult(uint16_t* data);
 uint8_t BMI160_GetDataStatus();
 
+void BMI160_ConfigureAccel(uint8_t odr, uint8_t bwp, uint8_t range);
+void BMI160_EnableFIFO(uint8_t watermarkFrames);
+void BMI160_SetInterrupt(uint8_t source);
+void BMI160_IntEnable(void);
+void BMI160_FlushFIFO(void);
+uint16_t BMI160_GetFIFOLength(void);
+uint8_t BMI160_ReadFIFO(int16_t* data, uint8_t maxFrames);
+
 /********************************Public Functions***********************************/
 
 /*******************************Private Variables***********************************/
@@ -1,6 +1,6 @@
 // multimod_OPT3001.h
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-18
 // Defines for OPT3001 on sensorpack
 
 #ifndef MULTIMOD_OPT3001_H_
@@ -21,15 +21,23 @@
 #include <driverlib/sysctl.h>
 #include <driverlib/uart.h>
 
+#include "multimod_i2c.h"
+
 /************************************Includes***************************************/
 
 /*************************************Defines***************************************/
 
 // OPT3001 Defines
 #define OPT3001_ADDR                0x47
+#define OPT3001_SPEED               I2C_SPEED_400K
 #define OPT3001_MANUID              0x5449
 #define OPT3001_DEVICEID            0x3001
 
+// INT of the OPT3001, open drain, active low
+#define OPT3001_INT_GPIO_BASE       GPIO_PORTC_BASE
+#define OPT3001_INT_PIN             GPIO_PIN_5
+#define OPT3001_INTERRUPT           INT_GPIOC
+
 // OPT3001 Register Addresses
 #define OPT3001_RESULT_ADDR         0x00
 #define OPT3001_CONFIG_ADDR         0x01
@@ -74,8 +82,16 @@
 
 // OPT3001 Range Shifts
 #define OPT3001_RESULT_E_S          12
+#define OPT3001_RESULT_R_M          0x0FFF
+#define OPT3001_RESULT_E_MAX        11
 #define OPT3001_CONFIG_AUTOFS       0b1100
 
+// Fault count field, conversions out of the window before INT asserts
+#define OPT3001_CONFIG_FC_1         0x0000
+#define OPT3001_CONFIG_FC_2         0x0001
+#define OPT3001_CONFIG_FC_4         0x0002
+#define OPT3001_CONFIG_FC_8         0x0003
+
 // OPT3001 Macro
 #define LUX(E, R)                   0.01 * (2 << E) * R
 
@@ -105,6 +121,12 @@ void OPT3001_SetLowLimit(uint16_t exp, uint16_t result);
 void OPT3001_SetHighLimit(uint16_t exp, uint16_t result);
 uint16_t OPT3001_GetChipID(void);
 
+void OPT3001_IntEnable(void);
+bool OPT3001_ReadAsync(uint16_t* result, i2cCallback_t callback);
+bool OPT3001_SetLimitsAsync(uint16_t low, uint16_t high);
+uint32_t OPT3001_ToCentiLux(uint16_t result);
+uint16_t OPT3001_FromCentiLux(uint32_t centiLux);
+
 /********************************Public Functions***********************************/
 
 /*******************************Private Variables***********************************/
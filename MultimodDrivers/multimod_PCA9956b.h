@@ -1,6 +1,6 @@
 // multimod_PCA9956b.h
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-18
 // LED driver header file
 
 #ifndef MULTIMOD_PCA9956B_H_
@@ -22,15 +22,21 @@
 /*************************************Defines***************************************/
 
 #define PCA9956B_ADDR   0x01
+#define PCA9956B_SPEED  I2C_SPEED_1M        // fast mode plus capable
+#define PCA9555_SPEED   I2C_SPEED_400K
 #define I2C_SCL_PIN     GPIO_PIN_6
 #define I2C_SDA_PIN     GPIO_PIN_7
 #define OE_PIN          GPIO_PIN_5
 #define LEDOUT0         0x02
 #define LEDOUT5         0x07
+#define GRPPWM          0x08
+#define GRPFREQ         0x09
 #define PWM0            0x0A
 #define PWM11           0x15
+#define PWM23           0x21
 #define IREF0           0x22
 #define IREF11          0x2D
+#define IREF23          0x39
 #define MODE2           0x01
 #define EFLAG0          0x41
 #define EFLAG2          0x43
@@ -39,6 +45,21 @@
 
 #define AI_BIT          0x80
 
+#define PCA9956B_CHANNELS       24
+
+// MODE2 group control
+#define MODE2_DMBLNK    0x20    // GRPPWM/GRPFREQ blink instead of dim
+
+// LEDOUT states, two bits per channel
+#define LEDOUT_OFF          0x00
+#define LEDOUT_ON           0x01
+#define LEDOUT_PWM          0x02    // individual PWM, reset default
+#define LEDOUT_PWM_GROUP    0x03    // individual PWM and group dim/blink
+
+// Shadow image of the contiguous MODE2..IREF23 block, sent with auto-increment
+#define PCA9956B_SHADOW_FIRST   MODE2
+#define PCA9956B_SHADOW_SIZE    (IREF23 - MODE2 + 1)
+
 // Connected PCA9555
 #define LED_PCA9555_GPIO_ADDR   0x23
 #define LED_PCA9555_RST_PIN     0x00
@@ -66,6 +87,13 @@ void PCA9956b_EnableOutput(void);
 void PCA9956b_DisableOutput(void);
 void PCA9556b_ReadAll();
 void PCA9556b_SetLED(uint8_t LED, uint8_t PWM, uint8_t IREF);
+void PCA9956b_SetChannel(uint8_t LED, uint8_t PWM, uint8_t IREF);
+void PCA9956b_SetPWM(uint8_t LED, uint8_t PWM);
+void PCA9956b_SetIREF(uint8_t LED, uint8_t IREF);
+void PCA9956b_SetOutputMode(uint8_t LED, uint8_t mode);
+void PCA9956b_SetGroup(uint8_t PWM, uint8_t freq, bool blink);
+void PCA9956b_Flush(void);
+bool PCA9956b_FlushAsync(void);
 uint8_t PCA9956b_GetChipID(void);
 
 /********************************Public Functions***********************************/
@@ -1,6 +1,6 @@
 // multimod_ST7789.h
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-18
 // Defines for OPT3001 on sensorpack
 
 #ifndef MULTIMOD_ST7789_H_
@@ -74,6 +74,10 @@
 #define ST7789_RDID2_ADDR           0xDB
 #define ST7789_RDID3_ADDR           0xDC
 
+// WRCTRLD bits
+#define ST7789_CTRLD_BCTRL          0x20    // brightness control on
+#define ST7789_CTRLD_BL             0x04    // backlight on
+
 
 // ST7789 Boundaries
 #define X_MAX                       240
@@ -110,6 +114,7 @@ void ST7789_Fill(uint16_t color);
 void ST7789_DrawPixel(uint16_t x, uint16_t y, uint16_t color);
 void ST7789_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 void ST7789_DrawRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+void ST7789_SetBrightness(uint8_t level);
 
 /********************************Public Functions***********************************/
 
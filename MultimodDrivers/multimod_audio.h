@@ -1,7 +1,7 @@
-// multimod_joystick.h
+// multimod_audio.h
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
-// Declarations for multimod joystick functions
+// Date Updated: 2026-10-19
+// Declarations for multimod audio functions
 
 #ifndef MULTIMOD_AUDIO_H_
 #define MULTIMOD_AUDIO_H_
@@ -16,6 +16,7 @@
 /*************************************Defines***************************************/
 
 #define AUDIO_PCA9555_GPIO_ADDR     0x22
+#define AUDIO_PCA9555_SPEED         I2C_SPEED_400K
 
 #define DAC_WRITE_CMD               0x03
 #define DAC_READ_CMD                0x00
@@ -24,12 +25,57 @@
 #define WAVEFORM_AMPLITUDE 2047 // half of 4095 (12 bit DAC)
 #define WAVEFORM_OFFSET 2048 // middle of 4095 (12 bit DAC)
 
+// DAC packets are 24 bits, sent as two 12 bit SSI2 frames
+#define DAC_PACKET(address, cmd, data)  ((((address) & 0x1F) << 19) | (((cmd) & 0x03) << 17) | ((data) & 0xFFFF))
+
+// Streaming output. TIMER0A paces uDMA into SSI2, one packet per sample,
+// and TIMER0B drives DAC_CS (PF1, T0CCP1) low around each packet.
+#define AUDIO_SAMPLE_RATE           24000       // Hz, 16 to 32 kHz
+// A block takes requests made before its refill, which plays after the half
+// already queued: worst case two blocks from request to sound
+#define AUDIO_BLOCK_SAMPLES         48          // per buffer half, 2 ms at 24 kHz
+#define AUDIO_DAC_ADDRESS           0x00        // DAC register the stream writes
+#define AUDIO_CS_LOW_CYCLES         240         // covers the DMA request and 24 bits at 20 MHz
+#define AUDIO_INT_PRIORITY          0x60
+
+// Capture. ADC1 sequence 3 converts the mic (PE1/AIN2) at every load of
+// PWM0 generator 0, and uDMA moves each result into a ping-pong buffer.
+// Timer ADC triggers share one line that already paces the joystick on
+// ADC0, so a PWM generator with no pins paces the mic instead.
+#define AUDIO_CAPTURE_RATE          8000        // Hz
+#define AUDIO_CAPTURE_SAMPLES       128         // per buffer half, 16 ms at 8 kHz
+#define AUDIO_CAPTURE_OVERSAMPLE    4           // hardware averaging, ADC1 wide
+#define AUDIO_CAPTURE_PRIORITY      0x80
+
 /*************************************Defines***************************************/
 
 /******************************Data Type Definitions********************************/
+
+// Fills a word aligned block of signed 16 bit samples. Runs in the audio
+// interrupt while the other half of the buffer plays, so it must finish
+// within a block.
+typedef void (*audioRefill_t)(int16_t* samples, uint16_t count);
+
+// Takes a block of 12 bit mic samples. Runs in the capture interrupt while
+// the other half of the buffer fills, so it must finish within a block.
+typedef void (*audioCapture_t)(const uint16_t* samples, uint16_t count);
+
 /******************************Data Type Definitions********************************/
 
 /****************************Data Structure Definitions*****************************/
+
+typedef struct {
+    uint32_t blocks;                // buffer halves refilled
+    uint32_t underruns;             // both halves played out before a refill
+    uint32_t refillUS;              // time spent refilling
+} audioStreamStats_t;
+
+typedef struct {
+    uint32_t blocks;                // buffer halves delivered
+    uint32_t overruns;              // both halves filled before one was taken
+    uint32_t processUS;             // time spent in the capture callback
+} audioCaptureStats_t;
+
 /****************************Data Structure Definitions*****************************/
 
 /***********************************Externs*****************************************/
@@ -42,14 +88,24 @@
 
 void AudioInput_Init(void);
 void AudioOutput_Init(void);
-void AudioConversionTimer_Enable(uint32_t frequency);
-void AudioConversionTimer_Disable();
 void AudioDAC_Write(uint32_t address, uint32_t data);
 uint32_t AudioDAC_Read(uint32_t address);
 
 void AudioDAC_Select(void);
 void AudioDAC_Deselect(void);
 
+void AudioStream_Start(uint32_t rate, audioRefill_t refill);
+void AudioStream_Stop(void);
+bool AudioStream_IsRunning(void);
+void AudioStream_GetStats(audioStreamStats_t* stats);
+void AudioStream_Handler(void);
+
+void AudioCapture_Start(uint32_t rate, audioCapture_t capture);
+void AudioCapture_Stop(void);
+bool AudioCapture_IsRunning(void);
+void AudioCapture_GetStats(audioCaptureStats_t* stats);
+void AudioCapture_Handler(void);
+
 void Audio_PCA9555_Write(uint8_t reg, uint8_t data);
 uint8_t Audio_PCA9555_Read(uint8_t reg);
 
@@ -1,6 +1,6 @@
 // multimod_buttons.h
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-18
 // buttons header file
 
 #ifndef MULTIMOD_BUTTONS_H_
@@ -14,11 +14,14 @@
 #include <inc/hw_memmap.h>
 #include <inc/hw_gpio.h>
 
+#include "multimod_i2c.h"
+
 /************************************Includes***************************************/
 
 /*************************************Defines***************************************/
 
 #define BUTTONS_PCA9555_GPIO_ADDR   0x23
+#define BUTTONS_PCA9555_SPEED       I2C_SPEED_400K
 #define BUTTONS_INT_GPIO_BASE       GPIO_PORTE_BASE
 #define BUTTONS_INT_PIN             GPIO_PIN_4
 #define BUTTON_INTERRUPT            INT_GPIOE
@@ -48,6 +51,7 @@
 
 void MultimodButtons_Init();
 uint8_t MultimodButtons_Get();
+bool MultimodButtons_GetAsync(uint8_t* result, i2cCallback_t callback);
 
 /********************************Public Functions***********************************/
 
@@ -0,0 +1,52 @@
+// multimod_dma.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Declarations for the shared uDMA controller
+
+#ifndef MULTIMOD_DMA_H_
+#define MULTIMOD_DMA_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <driverlib/udma.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Primary and alternate structures of all 32 channels, 16 bytes each
+#define DMA_CONTROL_TABLE_SIZE      1024
+
+/*************************************Defines***************************************/
+
+/******************************Data Type Definitions********************************/
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+/****************************Data Structure Definitions*****************************/
+
+/***********************************Externs*****************************************/
+/***********************************Externs*****************************************/
+
+/********************************Public Variables***********************************/
+/********************************Public Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+void DMA_Init(void);
+uint32_t DMA_GetErrors(void);
+
+void DMA_Error_Handler(void);
+
+/********************************Public Functions***********************************/
+
+/*******************************Private Variables***********************************/
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+/*******************************Private Functions***********************************/
+
+#endif /* MULTIMOD_DMA_H_ */
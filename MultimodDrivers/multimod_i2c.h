@@ -1,6 +1,6 @@
 // multimod_i2c.h
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-18
 // i2c header file
 
 #ifndef MULTIMOD_I2C_H_
@@ -16,6 +16,8 @@
 
 #include <driverlib/i2c.h>
 
+#include "../G8RTOS/G8RTOS_Semaphores.h"
+
 /************************************Includes***************************************/
 
 /*************************************Defines***************************************/
@@ -30,12 +32,90 @@
 #define I2C_B_PIN_SCL       GPIO_PIN_2
 #define I2C_B_PIN_SDA       GPIO_PIN_3
 
+#define I2C_BUS_COUNT       2
+
+// Bus clock rates, in Hz
+#define I2C_SPEED_100K      100000      // standard mode
+#define I2C_SPEED_400K      400000      // fast mode
+#define I2C_SPEED_1M        1000000     // fast mode plus
+
+// Default rate of each module, devices can override it per transaction
+#define I2C_A_SPEED         I2C_SPEED_400K
+#define I2C_B_SPEED         I2C_SPEED_400K
+
+// Devices with a clock profile / statistics per module
+#define I2C_MAX_DEVICES     8
+
+// Above SysTick/PendSV (0xE0) so transfers advance while threads are switched
+#define I2C_INT_PRIORITY    0x20
+
+// Longest run of registers I2C_WriteRegisters merges into one burst
+#define I2C_MAX_MERGE       16
+
 /*************************************Defines***************************************/
 
 /******************************Data Type Definitions********************************/
+
+// Transaction status
+typedef enum {
+    I2C_PENDING = 0,
+    I2C_DONE,
+    I2C_ERROR
+} i2cStatus_t;
+
+// Queue order of a device's transactions, lower runs first. Transactions
+// of one priority run in the order they were submitted.
+typedef enum {
+    I2C_PRIORITY_HIGH = 0,      // input, waits for nothing but the active transfer
+    I2C_PRIORITY_NORMAL,
+    I2C_PRIORITY_LOW            // bulk updates such as LED bursts
+} i2cPriority_t;
+
 /******************************Data Type Definitions********************************/
 
 /****************************Data Structure Definitions*****************************/
+
+struct i2cTransaction;
+
+// Called from the I2C interrupt when a transaction finishes
+typedef void (*i2cCallback_t)(struct i2cTransaction* transaction);
+
+// Transaction descriptor. Bytes are written first, then read after a
+// repeated start. Either length may be 0. The descriptor and its buffers
+// must stay valid until status leaves I2C_PENDING.
+typedef struct i2cTransaction {
+    uint8_t addr;
+    const uint8_t* writeData;
+    uint8_t writeLength;
+    uint8_t* readData;
+    uint8_t readLength;
+
+    i2cCallback_t callback;         // optional, runs in the I2C interrupt
+    semaphore_t* done;              // optional, signaled on completion
+
+    volatile i2cStatus_t status;
+    i2cPriority_t priority;         // set by I2C_Submit from the device profile
+    uint32_t submitUS;
+    struct i2cTransaction* next;
+} i2cTransaction_t;
+
+// Clock profile and traffic of one device
+typedef struct {
+    uint8_t addr;
+    const char* name;
+    uint32_t speed;                 // Hz, 0 runs at the module default
+    i2cPriority_t priority;
+    bool autoIncrement;             // consecutive registers can share a burst
+    uint8_t incrementFlag;          // ORed into the first register of a burst
+    uint32_t transactions;
+    uint32_t errors;
+    uint32_t bytes;                 // address and data bytes on the wire
+    uint32_t busyUS;                // time spent on its transactions
+    uint32_t waitUS;                // time its transactions sat in the queue
+    uint32_t maxWaitUS;
+    uint32_t elapsedUS;             // time since the counters were cleared
+} i2cDeviceStats_t;
+
 /****************************Data Structure Definitions*****************************/
 
 /***********************************Externs*****************************************/
@@ -52,6 +132,27 @@ void I2C_WriteSingle(uint32_t mod, uint8_t addr, uint8_t byte);
 uint8_t I2C_ReadSingle(uint32_t mod, uint8_t addr);
 void I2C_WriteMultiple(uint32_t mod, uint8_t addr, uint8_t* data, uint8_t num_bytes);
 void I2C_ReadMultiple(uint32_t mod, uint8_t addr, uint8_t* data, uint8_t num_bytes);
+bool I2C_WriteRead(uint32_t mod, uint8_t addr, const uint8_t* wr, uint8_t wr_bytes, uint8_t* rd, uint8_t rd_bytes);
+bool I2C_WriteRegisters(uint32_t mod, uint8_t addr, const uint8_t* regs, const uint8_t* values, uint8_t count);
+
+void I2C_SetSpeed(uint32_t mod, uint32_t speed);
+uint32_t I2C_GetSpeed(uint32_t mod);
+void I2C_SetDeviceProfile(uint32_t mod, uint8_t addr, uint32_t speed, const char* name);
+void I2C_SetDevicePriority(uint32_t mod, uint8_t addr, i2cPriority_t priority);
+void I2C_SetDeviceIncrement(uint32_t mod, uint8_t addr, uint8_t flag);
+
+uint8_t I2C_GetDeviceCount(uint32_t mod);
+bool I2C_GetDeviceStats(uint32_t mod, uint8_t index, i2cDeviceStats_t* stats);
+uint32_t I2C_GetThroughput(i2cDeviceStats_t* stats);
+uint16_t I2C_GetOccupancy(i2cDeviceStats_t* stats);
+uint32_t I2C_GetAverageWait(i2cDeviceStats_t* stats);
+void I2C_ResetStats(void);
+
+void I2C_Submit(uint32_t mod, i2cTransaction_t* transaction);
+bool I2C_Transfer(uint32_t mod, i2cTransaction_t* transaction);
+
+void I2C_A_Handler(void);
+void I2C_B_Handler(void);
 
 /********************************Public Functions***********************************/
 
@@ -1,6 +1,6 @@
 // multimod_joystick.h
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-18
 // Declarations for multimod joystick functions
 
 #ifndef MULTIMOD_JOYSTICK_H_
@@ -18,12 +18,42 @@
 #define JOYSTICK_INT_GPIO_BASE       GPIO_PORTD_BASE
 #define JOYSTICK_INT_PIN             GPIO_PIN_2
 
+// Timer triggered sampling, ADC0 sequence 2 paced by TIMER1A
+#define JOYSTICK_SAMPLE_RATE         500         // Hz
+#define JOYSTICK_OVERSAMPLE          16          // hardware averaging, ADC0 wide
+#define JOYSTICK_INT_PRIORITY        0x40
+
+#define JOYSTICK_CENTER              2048
+#define JOYSTICK_IIR_SHIFT           2           // filter weight 1/4 per sample
+#define JOYSTICK_FRAC_BITS           4           // fraction bits of filter state
+
+// Center tracks slowly while the stick rests within this window of it
+#define JOYSTICK_CAL_WINDOW          160
+#define JOYSTICK_CAL_SHIFT           8
+
+// Deadzone grows with measured noise, never below the minimum
+#define JOYSTICK_DEADZONE_MIN        64
+#define JOYSTICK_DEADZONE_NOISE      6           // deadzone = noise * this
+#define JOYSTICK_NOISE_SHIFT         5
+
 /*************************************Defines***************************************/
 
 /******************************Data Type Definitions********************************/
 /******************************Data Type Definitions********************************/
 
 /****************************Data Structure Definitions*****************************/
+
+// Filtered axis, offsets are relative to the calibrated center
+typedef struct {
+    int16_t x;                  // 0 inside the deadzone
+    int16_t y;
+    uint16_t centerX;
+    uint16_t centerY;
+    uint16_t deadzoneX;
+    uint16_t deadzoneY;
+    uint32_t samples;
+} joystickState_t;
+
 /****************************Data Structure Definitions*****************************/
 
 /***********************************Externs*****************************************/
@@ -41,6 +71,10 @@ uint16_t JOYSTICK_GetX(void);
 uint16_t JOYSTICK_GetY(void);
 uint32_t JOYSTICK_GetXY(void);
 
+void JOYSTICK_StartSampling(uint32_t rate);
+void JOYSTICK_GetState(joystickState_t* state);
+void JOYSTICK_ADC_Handler(void);
+
 /********************************Public Functions***********************************/
 
 /*******************************Private Variables***********************************/
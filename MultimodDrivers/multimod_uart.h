@@ -1,7 +1,10 @@
 // multimod_uart.h
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
-// UART header file
+// Date Updated: 2026-10-18
+// UART header file. The console is built with UART_BUFFERED, so UARTprintf
+// copies into a ring drained by the UART interrupt instead of waiting on
+// the line. Large buffers go straight from memory to the FIFO by uDMA. A
+// second UART links to another board or a BeagleBone.
 
 #ifndef MULTIMOD_UART_H_
 #define MULTIMOD_UART_H_
@@ -13,15 +16,63 @@
 
 #include <driverlib/uartstdio.h>
 
+#include "../G8RTOS/G8RTOS_Semaphores.h"
+
 /************************************Includes***************************************/
 
 /*************************************Defines***************************************/
+
+// Console baud at startup. The UART divides the 80 MHz clock by 8 at
+// most, USB bridges commonly take 921600 to 3M.
+#define UART_BAUD               115200
+#define UART_MAX_BAUD_DIVISOR   8
+
+// A uDMA transfer moves at most 1024 bytes, longer streams are re-armed
+// from the completion interrupt
+#define UART_DMA_CHUNK          1024
+
+// Throughput self-test: a header line, then a pattern repeating every
+// 256 bytes that a host can check at any offset
+#define UART_TEST_BLOCK         256
+#define UART_TEST_BYTE(i)       ((uint8_t)((i) * 167 + 13))
+
+// Below the audio stream and capture, the console only refills its FIFO
+#define UART_INT_PRIORITY       0xA0
+
+// Board link. UART4's only TX pin, PC5, is the OPT3001 interrupt line, so
+// the link is UART1 on PB0 (RX) and PB1 (TX), which the BoosterPack leaves
+// free. Cross RX and TX between boards and join grounds.
+#define LINK_BAUD               115200
+#define LINK_RING_SIZE          256     // each direction, power of two
+#define LINK_INT_PRIORITY       0xA0
+
 /*************************************Defines***************************************/
 
 /******************************Data Type Definitions********************************/
 /******************************Data Type Definitions********************************/
 
 /****************************Data Structure Definitions*****************************/
+
+typedef struct {
+    uint32_t streams;
+    uint32_t bytes;
+    uint32_t interrupts;            // completion interrupts, one per chunk
+} uartStreamStats_t;
+
+typedef struct {
+    uint32_t baud;
+    uint32_t bytes;
+    uint32_t elapsedUS;             // first byte queued to last bit sent
+    uint32_t interrupts;
+} uartTestResult_t;
+
+typedef struct {
+    uint32_t txBytes;
+    uint32_t rxBytes;
+    uint32_t rxDropped;             // received with the ring full
+    uint32_t rxErrors;              // framing, parity, overrun or break
+} uartLinkStats_t;
+
 /****************************Data Structure Definitions*****************************/
 
 /***********************************Externs*****************************************/
@@ -33,7 +84,24 @@
 /********************************Public Functions***********************************/
 
 void UART_Init();
-void UART_BeagleBone_Init();
+bool UART_SetBaud(uint32_t baud);
+uint32_t UART_GetBaud(void);
+uint32_t UART_GetDropped(void);
+bool UART_WriteFrame(const uint8_t* frame, uint16_t length);
+void UART_SetRxSemaphore(semaphore_t* ready);
+
+bool UART_StreamStart(const uint8_t* data, uint32_t length, semaphore_t* done);
+bool UART_StreamBusy(void);
+void UART_GetStreamStats(uartStreamStats_t* stats);
+void UART_StreamTest(uint32_t bytes, uartTestResult_t* result);
+
+void UART_BeagleBone_Init(void);
+bool UART_LinkWrite(const uint8_t* data, uint16_t length);
+uint32_t UART_LinkRead(uint8_t* data, uint32_t size);
+void UART_GetLinkStats(uartLinkStats_t* stats);
+
+void UART_Handler(void);
+void UART_Link_Handler(void);
 
 /********************************Public Functions***********************************/
 
@@ -1,7 +1,9 @@
 // multimod_BMI160.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
-// Defines for BMI160 functions
+// Date Updated: 2026-10-19
+// Defines for BMI160 functions. The FIFO functions let the sensor buffer
+// accelerometer frames and raise INT1 at a watermark, so frames are taken
+// a burst at a time instead of polling the status register per sample.
 
 /************************************Includes***************************************/
 
@@ -12,6 +14,13 @@
 
 /************************************Includes***************************************/
 
+/*******************************Private Variables***********************************/
+
+// Raw bytes of one FIFO burst
+static uint8_t fifoBurst[BMI160_FIFO_MAX_BURST];
+
+/*******************************Private Variables***********************************/
+
 /********************************Public Functions***********************************/
 
 // BMI160_Init
@@ -20,9 +29,11 @@
 // Return: void
 void BMI160_Init() {
     I2C_Init(I2C_A_BASE);
-    // Power on accelerometer
-    BMI160_WriteRegister(BMI160_CMD_ADDR, 0x11);
-    BMI160_WriteRegister(BMI160_CMD_ADDR, 0x15);
+    I2C_SetDeviceProfile(I2C_A_BASE, BMI160_ADDR, BMI160_SPEED, "BMI160");
+    I2C_SetDeviceIncrement(I2C_A_BASE, BMI160_ADDR, 0);
+    // Power on accelerometer and gyroscope
+    BMI160_WriteRegister(BMI160_CMD_ADDR, BMI160_CMD_ACC_NORMAL);
+    BMI160_WriteRegister(BMI160_CMD_ADDR, BMI160_CMD_GYR_NORMAL);
     return;
 }
 
@@ -42,8 +53,10 @@ void BMI160_WriteRegister(uint8_t addr, uint8_t data) {
 // Param uint8_t "addr": Register address
 // Return: void
 uint8_t BMI160_ReadRegister(uint8_t addr) {
-    I2C_WriteSingle(I2C_A_BASE, BMI160_ADDR, addr);
-    return I2C_ReadSingle(I2C_A_BASE, BMI160_ADDR);
+    uint8_t data = 0;
+
+    I2C_WriteRead(I2C_A_BASE, BMI160_ADDR, &addr, 1, &data, 1);
+    return data;
 }
 
 // BMI160_MultiReadRegister
@@ -53,8 +66,8 @@ uint8_t BMI160_ReadRegister(uint8_t addr) {
 // Param uint8_t "num_bytes": number of bytes to read
 // Return: void
 void BMI160_MultiReadRegister(uint8_t addr, uint8_t* data, uint8_t num_bytes) {
-    I2C_WriteSingle(I2C_A_BASE, BMI160_ADDR, addr);
-    I2C_ReadMultiple(I2C_A_BASE, BMI160_ADDR, data, num_bytes);
+    // Register address and data in one transaction, joined by a repeated start
+    I2C_WriteRead(I2C_A_BASE, BMI160_ADDR, &addr, 1, data, num_bytes);
     return;
 }
 
@@ -235,4 +248,102 @@ uint8_t BMI160_GetDataStatus() {
     return BMI160_ReadRegister(BMI160_STATUS_ADDR);
 }
 
+// BMI160_ConfigureAccel
+// Sets accelerometer output data rate, filter and range.
+// Param uint8_t "odr": BMI160_ACC_ODR_x
+// Param uint8_t "bwp": BMI160_ACC_BWP_x
+// Param uint8_t "range": BMI160_ACC_RANGE_x
+// Return: void
+void BMI160_ConfigureAccel(uint8_t odr, uint8_t bwp, uint8_t range) {
+    const uint8_t regs[] = {BMI160_ACCCONF_ADDR, BMI160_ACCRANGE_ADDR};
+    uint8_t values[] = {bwp | odr, range};
+
+    I2C_WriteRegisters(I2C_A_BASE, BMI160_ADDR, regs, values, 2);
+}
+
+// BMI160_EnableFIFO
+// Buffers accelerometer frames without headers and sets the watermark.
+// Param uint8_t "watermarkFrames": frames that raise the watermark interrupt
+// Return: void
+void BMI160_EnableFIFO(uint8_t watermarkFrames) {
+    const uint8_t regs[] = {BMI160_FIFOCONFIG_O, BMI160_FIFOCONFIG_O + 1};
+    // Watermark is counted in 4 byte units
+    uint8_t values[] = {(watermarkFrames * BMI160_FIFO_FRAME_BYTES + 3) / 4, BMI160_FIFO_ACC_EN};
+
+    I2C_WriteRegisters(I2C_A_BASE, BMI160_ADDR, regs, values, 2);
+    BMI160_FlushFIFO();
+}
+
+// BMI160_SetInterrupt
+// Routes one interrupt source to INT1, active high and not latched.
+// Param uint8_t "source": BMI160_INT_FIFO_WATERMARK or BMI160_INT_DATA_READY
+// Return: void
+void BMI160_SetInterrupt(uint8_t source) {
+    const uint8_t regs[] = {BMI160_INTOUTCTRL_ADDR, BMI160_INTLATCH_ADDR, BMI160_INTMAP_O + 1, BMI160_INTEN_O + 1};
+    uint8_t values[] = {BMI160_INTOUT_INT1_EN | BMI160_INTOUT_INT1_HIGH,
+                        0x00,
+                        (source == BMI160_INT_DATA_READY) ? BMI160_INTMAP1_DRDY : BMI160_INTMAP1_FWM,
+                        source};
+
+    // Output control and latch are neighbours and share a burst
+    I2C_WriteRegisters(I2C_A_BASE, BMI160_ADDR, regs, values, 4);
+}
+
+// BMI160_IntEnable
+// Configures the INT1 pin as a rising edge interrupt.
+// Return: void
+void BMI160_IntEnable(void) {
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOC);
+    GPIOPinTypeGPIOInput(BMI160_INT_GPIO_BASE, BMI160_INT_PIN);
+    GPIOIntTypeSet(BMI160_INT_GPIO_BASE, BMI160_INT_PIN, GPIO_RISING_EDGE);
+    GPIOIntClear(BMI160_INT_GPIO_BASE, BMI160_INT_PIN);
+    GPIOIntEnable(BMI160_INT_GPIO_BASE, BMI160_INT_PIN);
+}
+
+// BMI160_FlushFIFO
+// Discards everything in the FIFO.
+// Return: void
+void BMI160_FlushFIFO(void) {
+    BMI160_WriteRegister(BMI160_CMD_ADDR, BMI160_CMD_FIFO_FLUSH);
+}
+
+// BMI160_GetFIFOLength
+// Gets the number of bytes in the FIFO.
+// Return: uint16_t
+uint16_t BMI160_GetFIFOLength(void) {
+    uint8_t bytes[2];
+
+    BMI160_MultiReadRegister(BMI160_FIFOLENGTH_O, bytes, 2);
+
+    return (bytes[1] << 8 | bytes[0]) & BMI160_FIFO_LENGTH_M;
+}
+
+// BMI160_ReadFIFO
+// Drains whole accelerometer frames from the FIFO in one burst.
+// Param int16_t* "data": X, Y, Z per frame
+// Param uint8_t "maxFrames": room in data, in frames
+// Return: uint8_t, frames read
+uint8_t BMI160_ReadFIFO(int16_t* data, uint8_t maxFrames) {
+    uint16_t frames = BMI160_GetFIFOLength() / BMI160_FIFO_FRAME_BYTES;
+    uint16_t i = 0;
+
+    if (frames > maxFrames) {
+        frames = maxFrames;
+    }
+    if (frames > BMI160_FIFO_MAX_BURST / BMI160_FIFO_FRAME_BYTES) {
+        frames = BMI160_FIFO_MAX_BURST / BMI160_FIFO_FRAME_BYTES;
+    }
+    if (frames == 0) {
+        return 0;
+    }
+
+    BMI160_MultiReadRegister(BMI160_FIFODATA_ADDR, fifoBurst, frames * BMI160_FIFO_FRAME_BYTES);
+
+    for (i = 0; i < frames * 3; i++) {
+        *(data++) = (int16_t)(fifoBurst[2 * i + 1] << 8 | fifoBurst[2 * i]);
+    }
+
+    return frames;
+}
+
 /********************************Public Functions***********************************/
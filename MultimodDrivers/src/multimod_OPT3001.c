@@ -1,7 +1,10 @@
 // multimod_OPT3001.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
-// Defines for OPT3001 functions
+// Date Updated: 2026-10-18
+// Defines for OPT3001 functions. The async functions are for interrupt
+// driven use: in latched window mode the sensor only pulls INT low when a
+// conversion falls outside the limits, and reading the config register
+// releases it.
 
 /************************************Includes***************************************/
 
@@ -12,6 +15,39 @@
 
 /************************************Includes***************************************/
 
+/*******************************Private Variables***********************************/
+
+// Transfers queued by the async functions, must outlive the calls
+static const uint8_t configReg = OPT3001_CONFIG_ADDR;
+static const uint8_t resultReg = OPT3001_RESULT_ADDR;
+static uint8_t configBytes[2];
+static uint8_t resultBytes[2];
+static uint16_t* resultDestination;
+static i2cCallback_t resultCallback;
+static i2cTransaction_t configRead;
+static i2cTransaction_t resultRead;
+static bool readSubmitted = false;
+
+static uint8_t lowLimitBytes[3];
+static uint8_t highLimitBytes[3];
+static i2cTransaction_t lowLimitWrite;
+static i2cTransaction_t highLimitWrite;
+static bool limitsSubmitted = false;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// OPT3001_ResultRead
+// Completes OPT3001_ReadAsync. Runs in the I2C interrupt.
+// Return: void
+static void OPT3001_ResultRead(i2cTransaction_t* transaction) {
+    *resultDestination = (resultBytes[0] << 8 | resultBytes[1]);
+    resultCallback(transaction);
+}
+
+/*******************************Private Functions***********************************/
+
 /********************************Public Functions***********************************/
 
 // OPT3001_Init
@@ -19,6 +55,9 @@
 // Return: void
 void OPT3001_Init(void) {
     I2C_Init(I2C_A_BASE);
+    I2C_SetDeviceProfile(I2C_A_BASE, OPT3001_ADDR, OPT3001_SPEED, "OPT3001");
+    // Light level changes slowly, it can wait behind input reads
+    I2C_SetDevicePriority(I2C_A_BASE, OPT3001_ADDR, I2C_PRIORITY_LOW);
 
     // normally would add a software reset here, however,
     // opt3001 does not support software resets.
@@ -115,4 +154,112 @@ uint16_t OPT3001_GetChipID(void) {
     return OPT3001_ReadRegister(OPT3001_DEVICEID_ADDR);
 }
 
+// OPT3001_IntEnable
+// Configures the INT pin as a falling edge interrupt.
+// Return: void
+void OPT3001_IntEnable(void) {
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOC);
+    GPIOPinTypeGPIOInput(OPT3001_INT_GPIO_BASE, OPT3001_INT_PIN);
+    GPIOPadConfigSet(OPT3001_INT_GPIO_BASE, OPT3001_INT_PIN, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+    GPIOIntTypeSet(OPT3001_INT_GPIO_BASE, OPT3001_INT_PIN, GPIO_FALLING_EDGE);
+    GPIOIntClear(OPT3001_INT_GPIO_BASE, OPT3001_INT_PIN);
+    GPIOIntEnable(OPT3001_INT_GPIO_BASE, OPT3001_INT_PIN);
+}
+
+// OPT3001_ReadAsync
+// Queues a read of the config register, which releases a latched INT,
+// followed by a read of the result, and returns without waiting.
+// Param uint16_t* "result": result register, valid once the callback runs
+// Param i2cCallback_t "callback": runs in the I2C interrupt after the result read
+// Return: bool, false if the previous read is still running
+bool OPT3001_ReadAsync(uint16_t* result, i2cCallback_t callback) {
+    if (readSubmitted && resultRead.status == I2C_PENDING) {
+        return false;
+    }
+
+    resultDestination = result;
+    resultCallback = callback;
+
+    configRead.addr = OPT3001_ADDR;
+    configRead.writeData = &configReg;
+    configRead.writeLength = 1;
+    configRead.readData = configBytes;
+    configRead.readLength = 2;
+    configRead.callback = 0;
+    configRead.done = 0;
+
+    resultRead = configRead;
+    resultRead.writeData = &resultReg;
+    resultRead.readData = resultBytes;
+    resultRead.callback = OPT3001_ResultRead;
+    readSubmitted = true;
+
+    I2C_Submit(I2C_A_BASE, &configRead);
+    I2C_Submit(I2C_A_BASE, &resultRead);
+
+    return true;
+}
+
+// OPT3001_SetLimitsAsync
+// Queues writes of both limit registers and returns without waiting.
+// Param uint16_t "low": low limit, in result register format
+// Param uint16_t "high": high limit, in result register format
+// Return: bool, false if the previous writes are still running
+bool OPT3001_SetLimitsAsync(uint16_t low, uint16_t high) {
+    if (limitsSubmitted && highLimitWrite.status == I2C_PENDING) {
+        return false;
+    }
+
+    lowLimitBytes[0] = OPT3001_LOWLIMIT_ADDR;
+    lowLimitBytes[1] = low >> 8;
+    lowLimitBytes[2] = low & 0xFF;
+    highLimitBytes[0] = OPT3001_HIGHLIMIT_ADDR;
+    highLimitBytes[1] = high >> 8;
+    highLimitBytes[2] = high & 0xFF;
+
+    lowLimitWrite.addr = OPT3001_ADDR;
+    lowLimitWrite.writeData = lowLimitBytes;
+    lowLimitWrite.writeLength = 3;
+    lowLimitWrite.readData = 0;
+    lowLimitWrite.readLength = 0;
+    lowLimitWrite.callback = 0;
+    lowLimitWrite.done = 0;
+
+    highLimitWrite = lowLimitWrite;
+    highLimitWrite.writeData = highLimitBytes;
+    limitsSubmitted = true;
+
+    I2C_Submit(I2C_A_BASE, &lowLimitWrite);
+    I2C_Submit(I2C_A_BASE, &highLimitWrite);
+
+    return true;
+}
+
+// OPT3001_ToCentiLux
+// Converts a result or limit register value, lux = 0.01 * 2^E * R.
+// Param uint16_t "result": register value
+// Return: uint32_t, hundredths of a lux
+uint32_t OPT3001_ToCentiLux(uint16_t result) {
+    return (uint32_t)(result & OPT3001_RESULT_R_M) << (result >> OPT3001_RESULT_E_S);
+}
+
+// OPT3001_FromCentiLux
+// Converts a light level to register format with the smallest exponent
+// that holds it.
+// Param uint32_t "centiLux": hundredths of a lux
+// Return: uint16_t
+uint16_t OPT3001_FromCentiLux(uint32_t centiLux) {
+    uint16_t exp = 0;
+
+    while (centiLux > OPT3001_RESULT_R_M && exp < OPT3001_RESULT_E_MAX) {
+        centiLux >>= 1;
+        exp++;
+    }
+    if (centiLux > OPT3001_RESULT_R_M) {
+        centiLux = OPT3001_RESULT_R_M;
+    }
+
+    return (exp << OPT3001_RESULT_E_S) | centiLux;
+}
+
 /********************************Public Functions***********************************/
@@ -1,6 +1,6 @@
 // multimod_PCA9956b.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-18
 // Defines for PCA9956b functions
 
 /************************************Includes***************************************/
@@ -17,13 +17,99 @@
 
 /************************************Includes***************************************/
 
+/*******************************Private Variables***********************************/
+
+// Last values written to MODE2..IREF23, plus the block changed since
+static uint8_t shadow[PCA9956B_SHADOW_SIZE];
+static uint8_t dirtyFirst = PCA9956B_SHADOW_SIZE;
+static uint8_t dirtyLast = 0;
+
+// Burst sent by PCA9956b_FlushAsync, must outlive the call
+static uint8_t asyncBurst[1 + PCA9956B_SHADOW_SIZE];
+static i2cTransaction_t asyncTransfer;
+static bool asyncSubmitted = false;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// PCA9956b_ShadowSet
+// Updates one register in the shadow image, widening the dirty range if it changed.
+// Param uint8_t "reg": register address within MODE2..IREF23
+// Param uint8_t "value": new value
+// Return: void
+static void PCA9956b_ShadowSet(uint8_t reg, uint8_t value) {
+    uint8_t index = reg - PCA9956B_SHADOW_FIRST;
+
+    if (shadow[index] == value) {
+        return;
+    }
+
+    shadow[index] = value;
+    if (index < dirtyFirst) {
+        dirtyFirst = index;
+    }
+    if (index > dirtyLast) {
+        dirtyLast = index;
+    }
+}
+
+// PCA9956b_ShadowFill
+// Sets the whole shadow image after an ALL register write.
+// Param uint8_t "pwm": value written to PWMALL
+// Param uint8_t "iref": value written to IREFALL
+// Return: void
+static void PCA9956b_ShadowFill(uint8_t pwm, uint8_t iref) {
+    uint8_t i = 0;
+
+    for (i = 0; i < PCA9956B_CHANNELS; i++) {
+        shadow[(PWM0 - PCA9956B_SHADOW_FIRST) + i] = pwm;
+        shadow[(IREF0 - PCA9956B_SHADOW_FIRST) + i] = iref;
+    }
+    dirtyFirst = PCA9956B_SHADOW_SIZE;
+    dirtyLast = 0;
+}
+
+// PCA9956b_TakeBurst
+// Copies the dirty range into a command + data burst and clears it.
+// Param uint8_t* "burst": destination, 1 + PCA9956B_SHADOW_SIZE bytes
+// Return: uint8_t, bytes in the burst, 0 if nothing changed
+static uint8_t PCA9956b_TakeBurst(uint8_t* burst) {
+    uint8_t length = 0;
+    uint8_t i = 0;
+
+    if (dirtyFirst > dirtyLast) {
+        return 0;
+    }
+
+    burst[0] = AI_BIT | (PCA9956B_SHADOW_FIRST + dirtyFirst);
+    for (i = dirtyFirst; i <= dirtyLast; i++) {
+        burst[1 + i - dirtyFirst] = shadow[i];
+    }
+    length = (dirtyLast - dirtyFirst) + 2;
+
+    dirtyFirst = PCA9956B_SHADOW_SIZE;
+    dirtyLast = 0;
+
+    return length;
+}
+
+/*******************************Private Functions***********************************/
+
 /********************************Public Functions***********************************/
 
 // PCA9956b_Init
 // Initializes the PCA9956b, initializes the relevant output enable pins
 // Return: void
 void PCA9956b_Init() {
+    uint8_t i = 0;
+
     I2C_Init(I2C_A_BASE);
+    I2C_SetDeviceProfile(I2C_A_BASE, PCA9956B_ADDR, PCA9956B_SPEED, "PCA9956b");
+    I2C_SetDeviceProfile(I2C_A_BASE, LED_PCA9555_GPIO_ADDR, PCA9555_SPEED, "PCA9555");
+    // LED bursts are long and never urgent, everything else goes first
+    I2C_SetDevicePriority(I2C_A_BASE, PCA9956B_ADDR, I2C_PRIORITY_LOW);
+    I2C_SetDeviceIncrement(I2C_A_BASE, PCA9956B_ADDR, AI_BIT);
 
     // set reset pin to known value (1)
     PCA9555_SetPinDir(I2C_A_BASE, LED_PCA9555_GPIO_ADDR, ~(0x0001));
@@ -36,6 +122,18 @@ void PCA9956b_Init() {
     GPIOPinWrite(GPIO_PORTB_BASE, OE_PIN, 0x00);
 
     PCA9956b_SetAllOff();
+
+    // Start the shadow image from the reset state, then write all of it once
+    I2C_WriteSingle(I2C_A_BASE, PCA9956B_ADDR, MODE2);
+    shadow[0] = I2C_ReadSingle(I2C_A_BASE, PCA9956B_ADDR) & ~(MODE2_DMBLNK);
+    for (i = LEDOUT0; i <= LEDOUT5; i++) {
+        shadow[i - PCA9956B_SHADOW_FIRST] = 0xAA;
+    }
+    shadow[GRPPWM - PCA9956B_SHADOW_FIRST] = 0xFF;
+    shadow[GRPFREQ - PCA9956B_SHADOW_FIRST] = 0x00;
+    dirtyFirst = 0;
+    dirtyLast = PCA9956B_SHADOW_SIZE - 1;
+    PCA9956b_Flush();
     return;
 }
 
@@ -48,6 +146,8 @@ void PCA9956b_SetAllMax() {
 
     data[0] = (~(AI_BIT) & PWMALL);
     I2C_WriteMultiple(I2C_A_BASE, PCA9956B_ADDR, data, 2);
+
+    PCA9956b_ShadowFill(0xFF, 0xFF);
 }
 
 // PCA9956b_SetAllOff
@@ -59,6 +159,8 @@ void PCA9956b_SetAllOff() {
 
     data[0] = (~(AI_BIT) & PWMALL);
     I2C_WriteMultiple(I2C_A_BASE, PCA9956B_ADDR, data, 2);
+
+    PCA9956b_ShadowFill(0x00, 0x00);
 }
 
 // PCA9956b_EnableOutput
@@ -75,13 +177,132 @@ void PCA9956b_DisableOutput() {
     GPIOPinWrite(GPIO_PORTB_BASE, OE_PIN, 0xFF);
 }
 
+// PCA9556b_SetLED
+// Sets PWM and IREF of one LED and writes any pending changes.
+// Param uint8_t "LED": channel, 0 to 23
+// Param uint8_t "PWM": duty cycle
+// Param uint8_t "IREF": output current
+// Return: void
 void PCA9556b_SetLED(uint8_t LED, uint8_t PWM, uint8_t IREF) {
-    uint8_t data[] = {(~(AI_BIT) & PWM0 + LED), PWM};
-    I2C_WriteMultiple(I2C_A_BASE, PCA9956B_ADDR, data, 2);
+    PCA9956b_SetChannel(LED, PWM, IREF);
+    PCA9956b_Flush();
+}
 
-    data[0] = (~(AI_BIT) & IREF0 + LED);
-    data[1] = IREF;
-    I2C_WriteMultiple(I2C_A_BASE, PCA9956B_ADDR, data, 2);
+// PCA9956b_SetChannel
+// Sets PWM and IREF of one LED in the shadow image only, PCA9956b_Flush
+// sends it. Lets a whole pattern go out as one burst.
+// Param uint8_t "LED": channel, 0 to 23
+// Param uint8_t "PWM": duty cycle
+// Param uint8_t "IREF": output current
+// Return: void
+void PCA9956b_SetChannel(uint8_t LED, uint8_t PWM, uint8_t IREF) {
+    if (LED >= PCA9956B_CHANNELS) {
+        return;
+    }
+
+    PCA9956b_ShadowSet(PWM0 + LED, PWM);
+    PCA9956b_ShadowSet(IREF0 + LED, IREF);
+}
+
+// PCA9956b_Flush
+// Writes the registers changed since the last flush in one auto-increment
+// burst, from the first to the last changed register.
+// Return: void
+void PCA9956b_Flush(void) {
+    uint8_t burst[1 + PCA9956B_SHADOW_SIZE];
+    uint8_t length = PCA9956b_TakeBurst(burst);
+
+    if (length > 0) {
+        I2C_WriteMultiple(I2C_A_BASE, PCA9956B_ADDR, burst, length);
+    }
+}
+
+// PCA9956b_FlushAsync
+// Queues the registers changed since the last flush as one burst and
+// returns without waiting, for use from interrupts. Changes stay pending
+// if the previous burst is still on the bus. Don't mix with PCA9956b_Flush
+// from another context.
+// Return: bool, false if the previous burst is still running
+bool PCA9956b_FlushAsync(void) {
+    uint8_t length = 0;
+
+    if (asyncSubmitted && asyncTransfer.status == I2C_PENDING) {
+        return false;
+    }
+
+    length = PCA9956b_TakeBurst(asyncBurst);
+    if (length == 0) {
+        return true;
+    }
+
+    asyncTransfer.addr = PCA9956B_ADDR;
+    asyncTransfer.writeData = asyncBurst;
+    asyncTransfer.writeLength = length;
+    asyncTransfer.readData = 0;
+    asyncTransfer.readLength = 0;
+    asyncTransfer.callback = 0;
+    asyncTransfer.done = 0;
+    I2C_Submit(I2C_A_BASE, &asyncTransfer);
+    asyncSubmitted = true;
+
+    return true;
+}
+
+// PCA9956b_SetPWM
+// Sets the duty cycle of one LED in the shadow image.
+// Param uint8_t "LED": channel, 0 to 23
+// Param uint8_t "PWM": duty cycle
+// Return: void
+void PCA9956b_SetPWM(uint8_t LED, uint8_t PWM) {
+    if (LED < PCA9956B_CHANNELS) {
+        PCA9956b_ShadowSet(PWM0 + LED, PWM);
+    }
+}
+
+// PCA9956b_SetIREF
+// Sets the output current of one LED in the shadow image.
+// Param uint8_t "LED": channel, 0 to 23
+// Param uint8_t "IREF": output current
+// Return: void
+void PCA9956b_SetIREF(uint8_t LED, uint8_t IREF) {
+    if (LED < PCA9956B_CHANNELS) {
+        PCA9956b_ShadowSet(IREF0 + LED, IREF);
+    }
+}
+
+// PCA9956b_SetOutputMode
+// Sets how one LED is driven in the shadow image.
+// Param uint8_t "LED": channel, 0 to 23
+// Param uint8_t "mode": LEDOUT_OFF, LEDOUT_ON, LEDOUT_PWM or LEDOUT_PWM_GROUP
+// Return: void
+void PCA9956b_SetOutputMode(uint8_t LED, uint8_t mode) {
+    uint8_t reg = LEDOUT0 + (LED / 4);
+    uint8_t shift = (LED % 4) * 2;
+    uint8_t value = 0;
+
+    if (LED >= PCA9956B_CHANNELS) {
+        return;
+    }
+
+    value = shadow[reg - PCA9956B_SHADOW_FIRST];
+    value = (value & ~(0x03 << shift)) | ((mode & 0x03) << shift);
+    PCA9956b_ShadowSet(reg, value);
+}
+
+// PCA9956b_SetGroup
+// Sets group dimming or blinking of LEDs in LEDOUT_PWM_GROUP mode in the
+// shadow image. Dimming scales them by PWM / 256. Blinking turns them on
+// for PWM / 256 of a (freq + 1) / 15.26 s period.
+// Param uint8_t "PWM": GRPPWM
+// Param uint8_t "freq": GRPFREQ, only used when blinking
+// Param bool "blink": blink instead of dim
+// Return: void
+void PCA9956b_SetGroup(uint8_t PWM, uint8_t freq, bool blink) {
+    uint8_t mode2 = shadow[MODE2 - PCA9956B_SHADOW_FIRST];
+
+    PCA9956b_ShadowSet(GRPPWM, PWM);
+    PCA9956b_ShadowSet(GRPFREQ, freq);
+    PCA9956b_ShadowSet(MODE2, blink ? (mode2 | MODE2_DMBLNK) : (mode2 & ~(MODE2_DMBLNK)));
 }
 
 uint8_t PCA9956b_GetChipID() {
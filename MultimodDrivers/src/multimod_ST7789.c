@@ -1,6 +1,6 @@
 // multimod_ST7789.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-18
 // Defines for ST7789 TFT display
 
 /************************************Includes***************************************/
@@ -389,5 +389,19 @@ void ST7789_DrawRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16
     ST7789_Deselect();
 }
 
+// ST7789_SetBrightness
+// Sets the display brightness through WRDISBV, with brightness control
+// and backlight enabled in WRCTRLD.
+// Param uint8_t "level": 0 is darkest, 255 brightest
+// Return: void
+void ST7789_SetBrightness(uint8_t level) {
+    ST7789_Select();
+    ST7789_WriteCommand(ST7789_WRCTRLD_ADDR);
+    ST7789_WriteData(ST7789_CTRLD_BCTRL | ST7789_CTRLD_BL);
+    ST7789_WriteCommand(ST7789_WRDISBV_ADDR);
+    ST7789_WriteData(level);
+    ST7789_Deselect();
+}
+
 /********************************Public Functions***********************************/
 
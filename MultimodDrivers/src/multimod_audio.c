@@ -1,7 +1,12 @@
-// multimod_joystick.c
+// multimod_audio.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
-// Defines for joystick functions
+// Date Updated: 2026-10-19
+// Defines for audio functions. A running stream costs no CPU per sample:
+// TIMER0A requests one DAC packet per period from the uDMA, which moves
+// it from a ping-pong buffer into SSI2 while TIMER0B frames it with the
+// chip select. The DMA completion interrupt refills the half that
+// finished while the other one plays. Capture runs the same way in
+// reverse, from ADC1 into a ping-pong buffer handed out a block at a time.
 
 /************************************Includes***************************************/
 
@@ -9,6 +14,7 @@
 
 #include "../multimod_i2c.h"
 #include "../multimod_spi.h"
+#include "../multimod_dma.h"
 
 #include <driverlib/gpio.h>
 #include <driverlib/sysctl.h>
@@ -16,47 +22,139 @@
 #include <driverlib/adc.h>
 #include <driverlib/interrupt.h>
 #include <driverlib/timer.h>
+#include <driverlib/pwm.h>
 
 #include <inc/tm4c123gh6pm.h>
 #include <inc/hw_types.h>
 #include <inc/hw_memmap.h>
 #include <inc/hw_i2c.h>
 #include <inc/hw_gpio.h>
+#include <inc/hw_ssi.h>
+#include <inc/hw_adc.h>
+
+#include "../../G8RTOS/G8RTOS_Scheduler.h"
 
 /************************************Includes***************************************/
 
+/*******************************Private Variables***********************************/
+
+// Two 12 bit frames per sample, the command frame then the data frame
+static uint16_t dacFrames[2][AUDIO_BLOCK_SAMPLES * 2];
+
+// Word aligned so refill callbacks can work on sample pairs
+#pragma DATA_ALIGN(refillBlock, 4)
+static int16_t refillBlock[AUDIO_BLOCK_SAMPLES];
+
+static audioRefill_t streamRefill = 0;
+static volatile bool streaming = false;
+static audioStreamStats_t streamStats;
+
+// Raw ADC results, one half is handed out while the other fills
+static uint16_t captureFrames[2][AUDIO_CAPTURE_SAMPLES];
+
+static audioCapture_t captureCallback = 0;
+static volatile bool capturing = false;
+static audioCaptureStats_t captureStats;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// AudioStream_Fill
+// Takes a block from the refill callback into one buffer half. Only the
+// data frames change, the command frames were written at start.
+// Param uint8_t "half": 0 for the primary buffer, 1 for the alternate
+// Return: void
+static void AudioStream_Fill(uint8_t half) {
+    uint16_t* frames = dacFrames[half];
+    uint32_t start = G8RTOS_GetTimeUS();
+    uint16_t i = 0;
+
+    if (streamRefill) {
+        streamRefill(refillBlock, AUDIO_BLOCK_SAMPLES);
+    } else {
+        for (i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+            refillBlock[i] = 0;
+        }
+    }
+
+    // Signed 16 bit to offset 12 bit, 0 lands on WAVEFORM_OFFSET
+    for (i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+        frames[2 * i + 1] = ((uint16_t)refillBlock[i] ^ 0x8000) >> 4;
+    }
+
+    streamStats.blocks++;
+    streamStats.refillUS += G8RTOS_GetTimeUS() - start;
+}
+
+// AudioStream_Arm
+// Points a control structure back at its buffer half.
+// Param uint8_t "half": 0 for the primary buffer, 1 for the alternate
+// Return: void
+static void AudioStream_Arm(uint8_t half) {
+    uDMAChannelTransferSet(UDMA_CHANNEL_TMR0A | (half ? UDMA_ALT_SELECT : UDMA_PRI_SELECT),
+                           UDMA_MODE_PINGPONG, dacFrames[half], (void*)(SPI_B_BASE + SSI_O_DR),
+                           AUDIO_BLOCK_SAMPLES * 2);
+}
+
+// AudioCapture_Arm
+// Points a control structure back at its buffer half.
+// Param uint8_t "half": 0 for the primary buffer, 1 for the alternate
+// Return: void
+static void AudioCapture_Arm(uint8_t half) {
+    uDMAChannelTransferSet(UDMA_SEC_CHANNEL_ADC13 | (half ? UDMA_ALT_SELECT : UDMA_PRI_SELECT),
+                           UDMA_MODE_PINGPONG, (void*)(ADC1_BASE + ADC_O_SSFIFO3), captureFrames[half],
+                           AUDIO_CAPTURE_SAMPLES);
+}
+
+// AudioCapture_Deliver
+// Hands a filled buffer half to the capture callback.
+// Param uint8_t "half": 0 for the primary buffer, 1 for the alternate
+// Return: void
+static void AudioCapture_Deliver(uint8_t half) {
+    uint32_t start = G8RTOS_GetTimeUS();
+
+    if (captureCallback) {
+        captureCallback(captureFrames[half], AUDIO_CAPTURE_SAMPLES);
+    }
+
+    captureStats.blocks++;
+    captureStats.processUS += G8RTOS_GetTimeUS() - start;
+}
+
+/*******************************Private Functions***********************************/
+
 /********************************Public Functions***********************************/
 
 // AudioInput_Init
-// Initializes relevant audio modules / adc to retrieve audio information
+// Sets up the mic amplifier and ADC1 sequence 3, converting the mic at
+// every PWM0 generator 0 load. AudioCapture_Start starts the samples.
 // Return: void
 void AudioInput_Init(void) {
 
     I2C_Init(I2C_B_BASE);
+    I2C_SetDeviceProfile(I2C_B_BASE, AUDIO_PCA9555_GPIO_ADDR, AUDIO_PCA9555_SPEED, "PCA9555");
 
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC0);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC1);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_PWM0);
     SysCtlDelay(3);
 
     GPIOPinTypeADC(GPIO_PORTE_BASE, GPIO_PIN_1); // PE1/AIN2
 
-    // Set the ADC clock rate to 1 MSPS
-    ADCClockConfigSet(ADC0_BASE, ADC_CLOCK_RATE_FULL, 1);
-
-    ADCHardwareOversampleConfigure(ADC0_BASE, 64); // Enable hardware averaging with 64 samples
-
-    ADCSequenceConfigure(ADC0_BASE, 1, ADC_TRIGGER_PROCESSOR, 0);
-
-    ADCSequenceStepConfigure(ADC0_BASE, 1, 0, ADC_CTL_CH2 | ADC_CTL_IE | ADC_CTL_END);
+    // Averaging is per ADC, ADC1 leaves the joystick's on ADC0 alone
+    ADCHardwareOversampleConfigure(ADC1_BASE, AUDIO_CAPTURE_OVERSAMPLE);
 
-    ADCSequenceEnable(ADC0_BASE, 1);
+    ADCSequenceDisable(ADC1_BASE, 3);
+    ADCSequenceConfigure(ADC1_BASE, 3, ADC_TRIGGER_PWM0 | ADC_TRIGGER_PWM_MOD0, 0);
+    ADCSequenceStepConfigure(ADC1_BASE, 3, 0, ADC_CTL_CH2 | ADC_CTL_IE | ADC_CTL_END);
+    ADCSequenceDMAEnable(ADC1_BASE, 3);
+    ADCSequenceEnable(ADC1_BASE, 3);
 
-    ADCIntClear(ADC0_BASE, 1);
-    ADCIntEnable(ADC0_BASE, 1); // Enable the ADC interrupt
-    IntEnable(INT_ADC0SS1);
-
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
-    TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
+    // Generator 0 only counts, its outputs stay off the pins
+    SysCtlPWMClockSet(SYSCTL_PWMDIV_1);
+    PWMGenConfigure(PWM0_BASE, PWM_GEN_0, PWM_GEN_MODE_DOWN | PWM_GEN_MODE_NO_SYNC);
+    PWMGenIntTrigEnable(PWM0_BASE, PWM_GEN_0, PWM_TR_CNT_LOAD);
 
     // set the direction of port 0 pins
     Audio_PCA9555_Write(0x06, 0xF0); // set pins 0 to 4 as output (0b11110000)
@@ -76,60 +174,45 @@ void AudioOutput_Init(void) {
     GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_1, GPIO_PIN_1);
 }
 
-// AudioConversionTimer_Init
-// Initializes the timer to begin conversion at a specific frequency.
-// Return: void
-void AudioConversionTimer_Enable(uint32_t frequency) {
-    uint32_t timer_period;
-
-    timer_period = SysCtlClockGet() / frequency;
-    TimerLoadSet(TIMER0_BASE, TIMER_A, timer_period - 1);
-
-    // Register the interrupt handler
-    IntEnable(INT_TIMER0A);
-    TimerIntEnable(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
-
-    TimerEnable(TIMER0_BASE, TIMER_A);
-}
-
-// AudioConversionTimer_Disable
-// Disables the timer
-// Return: void
-void AudioConversionTimer_Disable() {
-    TimerDisable(TIMER0_BASE, TIMER_A);
-    IntDisable(INT_TIMER0A);
-}
-
 // AudioDAC_Write
 // Writes data to register in DAC
 // Return: void
 void AudioDAC_Write(uint32_t address, uint32_t data) {
-    uint32_t packet = ((address << 19) & 0x1F) | ((DAC_WRITE_CMD << 17) & 0x03) | ((data << 0) & 0xFFFF);
-    void AudioDAC_Select(void);
+    uint32_t packet = DAC_PACKET(address, DAC_WRITE_CMD, data);
+
+    AudioDAC_Select();
 
-    SPI_WriteSingle(SPI_B_BASE, packet >> 12);
-    SPI_WriteSingle(SPI_B_BASE, packet);
+    // SSI2 runs 12 bit frames, wider than SPI_WriteSingle takes
+    SSIDataPut(SPI_B_BASE, (packet >> 12) & 0xFFF);
+    SSIDataPut(SPI_B_BASE, packet & 0xFFF);
+    while (SSIBusy(SPI_B_BASE));
 
-    void AudioDAC_Deselect(void);
+    AudioDAC_Deselect();
 }
 
 // AudioDAC_Read
 // Gets register value from DAC
 // Return: uint32_t
 uint32_t AudioDAC_Read(uint32_t address) {
-    uint32_t packet = ((address << 19) & 0x1F) | ((DAC_READ_CMD << 17) & 0x03);
-    uint32_t data;
+    uint32_t packet = DAC_PACKET(address, DAC_READ_CMD, 0);
+    uint32_t high = 0;
+    uint32_t low = 0;
+
+    // Drop anything left in the receive FIFO
+    while (SSIDataGetNonBlocking(SPI_B_BASE, &low));
 
     AudioDAC_Select();
 
-    SPI_WriteSingle(SPI_B_BASE, packet >> 12);
-    SPI_WriteSingle(SPI_B_BASE, 0);
+    SSIDataPut(SPI_B_BASE, (packet >> 12) & 0xFFF);
+    SSIDataPut(SPI_B_BASE, 0);
+    while (SSIBusy(SPI_B_BASE));
 
-    SSIDataGet(SPI_B_BASE, &data);
+    SSIDataGet(SPI_B_BASE, &high);
+    SSIDataGet(SPI_B_BASE, &low);
 
     AudioDAC_Deselect();
 
-    return data & 0xFFFF; // extract the 16-bit data
+    return ((high << 12) | (low & 0xFFF)) & 0xFFFF; // extract the 16-bit data
 }
 
 // AudioDAC_Select
@@ -146,6 +229,167 @@ void AudioDAC_Deselect(void) {
     GPIOPinWrite(GPIO_PORTF_BASE, DAC_CS, 0xFF);
 }
 
+// AudioStream_Start
+// Starts streaming samples from the refill callback to the DAC. Both
+// buffer halves are filled before the first sample plays. The DAC can't
+// be written with AudioDAC_Write while the stream runs.
+// Param uint32_t "rate": sample rate in Hz, AUDIO_SAMPLE_RATE
+// Param audioRefill_t "refill": block source, 0 plays silence
+// Return: void
+void AudioStream_Start(uint32_t rate, audioRefill_t refill) {
+    uint32_t period = SysCtlClockGet() / rate;
+    uint16_t i = 0;
+
+    AudioStream_Stop();
+
+    streamRefill = refill;
+    for (i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+        dacFrames[0][2 * i] = DAC_PACKET(AUDIO_DAC_ADDRESS, DAC_WRITE_CMD, 0) >> 12;
+        dacFrames[1][2 * i] = DAC_PACKET(AUDIO_DAC_ADDRESS, DAC_WRITE_CMD, 0) >> 12;
+    }
+    AudioStream_Fill(0);
+    AudioStream_Fill(1);
+
+    // Each timer request moves both frames of one sample
+    DMA_Init();
+    uDMAChannelAssign(UDMA_CH18_TIMER0A);
+    uDMAChannelAttributeDisable(UDMA_CHANNEL_TMR0A, UDMA_ATTR_ALL);
+    uDMAChannelControlSet(UDMA_CHANNEL_TMR0A | UDMA_PRI_SELECT,
+                          UDMA_SIZE_16 | UDMA_SRC_INC_16 | UDMA_DST_INC_NONE | UDMA_ARB_2);
+    uDMAChannelControlSet(UDMA_CHANNEL_TMR0A | UDMA_ALT_SELECT,
+                          UDMA_SIZE_16 | UDMA_SRC_INC_16 | UDMA_DST_INC_NONE | UDMA_ARB_2);
+    AudioStream_Arm(0);
+    AudioStream_Arm(1);
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
+    GPIOPinConfigure(GPIO_PF1_T0CCP1);
+    GPIOPinTypeTimer(GPIO_PORTF_BASE, DAC_CS);
+
+    // Both halves count the same period. Inverted PWM pulls CS low at the
+    // reload, when A requests the sample, and releases it at the match.
+    TimerConfigure(TIMER0_BASE, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_PERIODIC | TIMER_CFG_B_PWM);
+    TimerLoadSet(TIMER0_BASE, TIMER_BOTH, period - 1);
+    TimerMatchSet(TIMER0_BASE, TIMER_B, period - 1 - AUDIO_CS_LOW_CYCLES);
+    TimerControlLevel(TIMER0_BASE, TIMER_B, true);
+
+    // Only DMA completion interrupts, the timeout needs none
+    IntRegister(INT_TIMER0A, AudioStream_Handler);
+    IntPrioritySet(INT_TIMER0A, AUDIO_INT_PRIORITY);
+    TimerIntClear(TIMER0_BASE, TIMER_TIMA_DMA | TIMER_TIMA_TIMEOUT);
+    TimerIntEnable(TIMER0_BASE, TIMER_TIMA_DMA);
+    IntEnable(INT_TIMER0A);
+
+    uDMAChannelEnable(UDMA_CHANNEL_TMR0A);
+    streaming = true;
+    TimerEnable(TIMER0_BASE, TIMER_BOTH);
+}
+
+// AudioStream_Stop
+// Stops the stream and returns chip select to a deselected GPIO.
+// Return: void
+void AudioStream_Stop(void) {
+    if (!streaming) {
+        return;
+    }
+
+    TimerDisable(TIMER0_BASE, TIMER_BOTH);
+    IntDisable(INT_TIMER0A);
+    TimerIntDisable(TIMER0_BASE, TIMER_TIMA_DMA);
+    uDMAChannelDisable(UDMA_CHANNEL_TMR0A);
+
+    GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, DAC_CS);
+    AudioDAC_Deselect();
+    streaming = false;
+}
+
+// AudioStream_IsRunning
+// Return: bool
+bool AudioStream_IsRunning(void) {
+    return streaming;
+}
+
+// AudioStream_GetStats
+// Copies the stream counters.
+// Param audioStreamStats_t* "stats": destination
+// Return: void
+void AudioStream_GetStats(audioStreamStats_t* stats) {
+    IntDisable(INT_TIMER0A);
+    *stats = streamStats;
+    if (streaming) {
+        IntEnable(INT_TIMER0A);
+    }
+}
+
+// AudioCapture_Start
+// Starts converting the mic into the ping-pong buffer, handing each
+// filled half to the capture callback. Needs AudioInput_Init.
+// Param uint32_t "rate": sample rate in Hz, AUDIO_CAPTURE_RATE
+// Param audioCapture_t "capture": block consumer, 0 drops the blocks
+// Return: void
+void AudioCapture_Start(uint32_t rate, audioCapture_t capture) {
+    AudioCapture_Stop();
+
+    captureCallback = capture;
+
+    // Each conversion requests one transfer
+    DMA_Init();
+    uDMAChannelAssign(UDMA_CH27_ADC1_3);
+    uDMAChannelAttributeDisable(UDMA_SEC_CHANNEL_ADC13, UDMA_ATTR_ALL);
+    uDMAChannelControlSet(UDMA_SEC_CHANNEL_ADC13 | UDMA_PRI_SELECT,
+                          UDMA_SIZE_16 | UDMA_SRC_INC_NONE | UDMA_DST_INC_16 | UDMA_ARB_1);
+    uDMAChannelControlSet(UDMA_SEC_CHANNEL_ADC13 | UDMA_ALT_SELECT,
+                          UDMA_SIZE_16 | UDMA_SRC_INC_NONE | UDMA_DST_INC_16 | UDMA_ARB_1);
+    AudioCapture_Arm(0);
+    AudioCapture_Arm(1);
+
+    // With uDMA on the sequence, its interrupt marks a finished half
+    IntRegister(INT_ADC1SS3, AudioCapture_Handler);
+    IntPrioritySet(INT_ADC1SS3, AUDIO_CAPTURE_PRIORITY);
+    ADCIntClear(ADC1_BASE, 3);
+    ADCIntEnable(ADC1_BASE, 3);
+    IntEnable(INT_ADC1SS3);
+
+    uDMAChannelEnable(UDMA_SEC_CHANNEL_ADC13);
+    capturing = true;
+
+    PWMGenPeriodSet(PWM0_BASE, PWM_GEN_0, SysCtlClockGet() / rate);
+    PWMGenEnable(PWM0_BASE, PWM_GEN_0);
+}
+
+// AudioCapture_Stop
+// Stops converting, the last partly filled half is dropped.
+// Return: void
+void AudioCapture_Stop(void) {
+    if (!capturing) {
+        return;
+    }
+
+    PWMGenDisable(PWM0_BASE, PWM_GEN_0);
+    IntDisable(INT_ADC1SS3);
+    ADCIntDisable(ADC1_BASE, 3);
+    uDMAChannelDisable(UDMA_SEC_CHANNEL_ADC13);
+    capturing = false;
+}
+
+// AudioCapture_IsRunning
+// Return: bool
+bool AudioCapture_IsRunning(void) {
+    return capturing;
+}
+
+// AudioCapture_GetStats
+// Copies the capture counters.
+// Param audioCaptureStats_t* "stats": destination
+// Return: void
+void AudioCapture_GetStats(audioCaptureStats_t* stats) {
+    IntDisable(INT_ADC1SS3);
+    *stats = captureStats;
+    if (capturing) {
+        IntEnable(INT_ADC1SS3);
+    }
+}
+
 // Audio_PCA9555_Write
 // Writes to audio PCA9555 register
 // Return: void
@@ -163,3 +407,58 @@ uint8_t Audio_PCA9555_Read(uint8_t reg) {
 }
 /********************************Public Functions***********************************/
 
+/*******************************Interrupt Handlers**********************************/
+
+// AudioStream_Handler
+// Refills and re-arms every buffer half the uDMA finished. If both
+// finished the stream ran dry and the controller stopped the channel.
+// Return: void
+void AudioStream_Handler(void) {
+    bool primary = (uDMAChannelModeGet(UDMA_CHANNEL_TMR0A | UDMA_PRI_SELECT) == UDMA_MODE_STOP);
+    bool alternate = (uDMAChannelModeGet(UDMA_CHANNEL_TMR0A | UDMA_ALT_SELECT) == UDMA_MODE_STOP);
+
+    TimerIntClear(TIMER0_BASE, TIMER_TIMA_DMA);
+
+    if (primary && alternate) {
+        streamStats.underruns++;
+    }
+    if (primary) {
+        AudioStream_Fill(0);
+        AudioStream_Arm(0);
+    }
+    if (alternate) {
+        AudioStream_Fill(1);
+        AudioStream_Arm(1);
+    }
+    if (!uDMAChannelIsEnabled(UDMA_CHANNEL_TMR0A)) {
+        uDMAChannelEnable(UDMA_CHANNEL_TMR0A);
+    }
+}
+
+// AudioCapture_Handler
+// Delivers and re-arms every buffer half the uDMA filled. If both filled
+// the callback fell behind and the controller stopped the channel.
+// Return: void
+void AudioCapture_Handler(void) {
+    bool primary = (uDMAChannelModeGet(UDMA_SEC_CHANNEL_ADC13 | UDMA_PRI_SELECT) == UDMA_MODE_STOP);
+    bool alternate = (uDMAChannelModeGet(UDMA_SEC_CHANNEL_ADC13 | UDMA_ALT_SELECT) == UDMA_MODE_STOP);
+
+    ADCIntClear(ADC1_BASE, 3);
+
+    if (primary && alternate) {
+        captureStats.overruns++;
+    }
+    if (primary) {
+        AudioCapture_Deliver(0);
+        AudioCapture_Arm(0);
+    }
+    if (alternate) {
+        AudioCapture_Deliver(1);
+        AudioCapture_Arm(1);
+    }
+    if (!uDMAChannelIsEnabled(UDMA_SEC_CHANNEL_ADC13)) {
+        uDMAChannelEnable(UDMA_SEC_CHANNEL_ADC13);
+    }
+}
+
+/*******************************Interrupt Handlers**********************************/
@@ -1,6 +1,6 @@
 // multimod_buttons.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
+// Date Updated: 2026-10-18
 // Defines for button functions
 
 /************************************Includes***************************************/
@@ -19,6 +19,15 @@
 
 /************************************Includes***************************************/
 
+/*******************************Private Variables***********************************/
+
+// Read queued by MultimodButtons_GetAsync, must outlive the call
+static const uint8_t inputPortReg = 0x00;
+static i2cTransaction_t asyncRead;
+static bool asyncSubmitted = false;
+
+/*******************************Private Variables***********************************/
+
 /********************************Public Functions***********************************/
 
 // Buttons_Init
@@ -28,6 +37,9 @@
 void MultimodButtons_Init() {
     // Initialize I2C module
     I2C_Init(I2C_A_BASE);
+    I2C_SetDeviceProfile(I2C_A_BASE, BUTTONS_PCA9555_GPIO_ADDR, BUTTONS_PCA9555_SPEED, "PCA9555");
+    // Port reads jump the queue ahead of LED and sensor traffic
+    I2C_SetDevicePriority(I2C_A_BASE, BUTTONS_PCA9555_GPIO_ADDR, I2C_PRIORITY_HIGH);
     // Initialize pin, configure as interrupt
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
 
@@ -43,8 +55,35 @@ void MultimodButtons_Init() {
 // Gets the input to GPIO bank 1, [0..7].
 // Return: uint8_t 
 uint8_t MultimodButtons_Get() {
-    I2C_WriteSingle(I2C_A_BASE, BUTTONS_PCA9555_GPIO_ADDR, 0x00);
-    return I2C_ReadSingle(I2C_A_BASE, BUTTONS_PCA9555_GPIO_ADDR);
+    uint8_t result = 0;
+
+    I2C_WriteRead(I2C_A_BASE, BUTTONS_PCA9555_GPIO_ADDR, &inputPortReg, 1, &result, 1);
+    return result;
+}
+
+// MultimodButtons_GetAsync
+// Queues a read of GPIO bank 1 and returns without waiting, for use from
+// interrupts. Reading the port also releases the PCA9555 interrupt line.
+// Param uint8_t* "result": destination, valid once the callback runs
+// Param i2cCallback_t "callback": runs in the I2C interrupt on completion
+// Return: bool, false if the previous read is still running
+bool MultimodButtons_GetAsync(uint8_t* result, i2cCallback_t callback) {
+    if (asyncSubmitted && asyncRead.status == I2C_PENDING) {
+        return false;
+    }
+
+    asyncRead.addr = BUTTONS_PCA9555_GPIO_ADDR;
+    asyncRead.writeData = &inputPortReg;
+    asyncRead.writeLength = 1;
+    asyncRead.readData = result;
+    asyncRead.readLength = 1;
+    asyncRead.callback = callback;
+    asyncRead.done = 0;
+    asyncSubmitted = true;
+
+    I2C_Submit(I2C_A_BASE, &asyncRead);
+
+    return true;
 }
 
 /********************************Public Functions***********************************/
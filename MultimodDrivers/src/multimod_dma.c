@@ -0,0 +1,73 @@
+// multimod_dma.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Defines for the shared uDMA controller. Owns the channel control table,
+// drivers set up their own channels once DMA_Init has run.
+
+/************************************Includes***************************************/
+
+#include "../multimod_dma.h"
+
+#include <driverlib/sysctl.h>
+#include <driverlib/interrupt.h>
+
+#include <inc/tm4c123gh6pm.h>
+#include <inc/hw_ints.h>
+
+/************************************Includes***************************************/
+
+/*******************************Private Variables***********************************/
+
+// The controller requires the table on a 1024 byte boundary
+#pragma DATA_ALIGN(controlTable, DMA_CONTROL_TABLE_SIZE)
+static uint8_t controlTable[DMA_CONTROL_TABLE_SIZE];
+
+static bool initialized = false;
+static volatile uint32_t errors = 0;
+
+/*******************************Private Variables***********************************/
+
+/********************************Public Functions***********************************/
+
+// DMA_Init
+// Enables the uDMA controller and points it at the control table. Several
+// drivers use it, only the first call sets it up.
+// Return: void
+void DMA_Init(void) {
+    if (initialized) {
+        return;
+    }
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_UDMA));
+
+    uDMAEnable();
+    uDMAControlBaseSet(controlTable);
+
+    IntRegister(INT_UDMAERR, DMA_Error_Handler);
+    IntEnable(INT_UDMAERR);
+
+    initialized = true;
+}
+
+// DMA_GetErrors
+// Return: uint32_t, bus errors the controller reported since reset
+uint32_t DMA_GetErrors(void) {
+    return errors;
+}
+
+/********************************Public Functions***********************************/
+
+/*******************************Interrupt Handlers**********************************/
+
+// DMA_Error_Handler
+// Counts a bus error. The failing channel is disabled by the controller.
+// Return: void
+void DMA_Error_Handler(void) {
+    if (uDMAErrorStatusGet()) {
+        uDMAErrorStatusClear();
+        errors++;
+    }
+}
+
+/*******************************Interrupt Handlers**********************************/
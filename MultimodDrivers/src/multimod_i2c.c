@@ -1,21 +1,303 @@
 // multimod_i2c.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
-// Defines for I2C functions
+// Date Updated: 2026-10-18
+// Defines for I2C functions. Transfers are queued per module and advanced
+// by the I2C master interrupt, one START/CONT/FINISH command per byte.
+// Threads block on a semaphore while their transaction runs. Before the
+// scheduler starts, or from an interrupt, the caller services the module
+// itself until the transaction completes. Each module runs at its own
+// clock rate, switched per transaction for devices with a profile.
+// The queue is ordered by the priority of each device's profile, so input
+// reads go out right after the active transfer instead of behind a backlog
+// of LED updates. A transfer on the wire is never interrupted.
 
 /************************************Includes***************************************/
 
 #include "../multimod_i2c.h"
 
+#include <string.h>
+
 #include <driverlib/gpio.h>
 #include <driverlib/sysctl.h>
 #include <driverlib/pin_map.h>
+#include <driverlib/interrupt.h>
+#include <driverlib/cpu.h>
 
 #include <inc/tm4c123gh6pm.h>
 #include <inc/hw_i2c.h>
+#include <inc/hw_nvic.h>
+#include <inc/hw_types.h>
+
+#include "../../G8RTOS/G8RTOS_Scheduler.h"
+#include "../../G8RTOS/G8RTOS_CriticalSection.h"
 
 /************************************Includes***************************************/
 
+/******************************Data Type Definitions********************************/
+
+// Where the active transaction is
+typedef enum {
+    I2C_PHASE_IDLE = 0,
+    I2C_PHASE_WRITE,
+    I2C_PHASE_READ,
+    I2C_PHASE_STOPPING          // error stop issued after a failed burst
+} i2cPhase_t;
+
+/******************************Data Type Definitions********************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// Per-module transaction queue
+typedef struct {
+    uint32_t base;
+    bool initialized;
+    i2cTransaction_t* head;     // active transaction while phase is not idle
+    i2cTransaction_t* tail;
+    i2cPhase_t phase;
+    uint8_t index;              // next byte of the current phase
+    bool burst;                 // a burst is open and needs a stop on error
+
+    uint32_t speed;             // module default rate
+    uint32_t activeSpeed;       // rate programmed into MTPR
+    i2cDeviceStats_t devices[I2C_MAX_DEVICES];
+    uint8_t deviceCount;
+    i2cDeviceStats_t other;     // traffic to devices without a profile
+    uint32_t startUS;           // start of the active transaction
+    uint32_t resetUS;           // when the traffic counters were cleared
+} i2cBus_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/*******************************Private Variables***********************************/
+
+static i2cBus_t buses[I2C_BUS_COUNT] = {
+    {.base = I2C_A_BASE, .phase = I2C_PHASE_IDLE, .speed = I2C_A_SPEED},
+    {.base = I2C_B_BASE, .phase = I2C_PHASE_IDLE, .speed = I2C_B_SPEED}
+};
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// I2C_GetBus
+// Return: i2cBus_t*, queue of the module
+static i2cBus_t* I2C_GetBus(uint32_t mod) {
+    return (mod == I2C_B_BASE) ? &buses[1] : &buses[0];
+}
+
+// I2C_FindDevice
+// Return: i2cDeviceStats_t*, profile of the device, other if it has none
+static i2cDeviceStats_t* I2C_FindDevice(i2cBus_t* bus, uint8_t addr) {
+    uint8_t i = 0;
+
+    for (i = 0; i < bus->deviceCount; i++) {
+        if (bus->devices[i].addr == addr) {
+            return &bus->devices[i];
+        }
+    }
+
+    return &bus->other;
+}
+
+// I2C_AddDevice
+// Finds the profile of a device, creating it if there is room. Callers
+// hold a critical section.
+// Return: i2cDeviceStats_t*, profile of the device, 0 if the table is full
+static i2cDeviceStats_t* I2C_AddDevice(i2cBus_t* bus, uint8_t addr) {
+    i2cDeviceStats_t* device = I2C_FindDevice(bus, addr);
+
+    if (device != &bus->other) {
+        return device;
+    }
+    if (bus->deviceCount >= I2C_MAX_DEVICES) {
+        return 0;
+    }
+
+    device = &bus->devices[bus->deviceCount++];
+    device->addr = addr;
+    device->priority = I2C_PRIORITY_NORMAL;
+    return device;
+}
+
+// I2C_ProgramSpeed
+// Sets the SCL period. Only valid while the module is idle.
+// Param uint32_t "speed": rate in Hz
+// Return: void
+static void I2C_ProgramSpeed(i2cBus_t* bus, uint32_t speed) {
+    uint32_t clock = SysCtlClockGet();
+    uint32_t tpr = 0;
+
+    // SCL period is 2 * (SCL_LP + SCL_HP) * (TPR + 1) system clocks, with
+    // SCL_LP = 6 and SCL_HP = 4. Round TPR up so the rate never exceeds speed.
+    tpr = ((clock + (20 * speed) - 1) / (20 * speed)) - 1;
+    HWREG(bus->base + I2C_O_MTPR) = tpr;
+    bus->activeSpeed = speed;
+}
+
+// I2C_StartRead
+// Addresses the device for reading, a repeated start if bytes were written.
+// Return: void
+static void I2C_StartRead(i2cBus_t* bus) {
+    i2cTransaction_t* t = bus->head;
+
+    bus->phase = I2C_PHASE_READ;
+    bus->index = 0;
+    bus->burst = (t->readLength > 1);
+
+    I2CMasterSlaveAddrSet(bus->base, t->addr, true);
+    I2CMasterControl(bus->base, bus->burst ? I2C_MASTER_CMD_BURST_RECEIVE_START :
+                                             I2C_MASTER_CMD_SINGLE_RECEIVE);
+}
+
+// I2C_StartNext
+// Starts the transaction at the head of the queue, if any.
+// Return: void
+static void I2C_StartNext(i2cBus_t* bus) {
+    i2cTransaction_t* t = bus->head;
+    i2cDeviceStats_t* device = 0;
+    uint32_t speed = 0;
+    uint32_t wait = 0;
+
+    if (t == 0) {
+        bus->phase = I2C_PHASE_IDLE;
+        return;
+    }
+
+    // Switch rate between transactions when this device has its own
+    device = I2C_FindDevice(bus, t->addr);
+    speed = device->speed;
+    if (speed == 0) {
+        speed = bus->speed;
+    }
+    if (speed != bus->activeSpeed) {
+        I2C_ProgramSpeed(bus, speed);
+    }
+    bus->startUS = G8RTOS_GetTimeUS();
+
+    wait = bus->startUS - t->submitUS;
+    device->waitUS += wait;
+    if (wait > device->maxWaitUS) {
+        device->maxWaitUS = wait;
+    }
+
+    if (t->writeLength == 0) {
+        I2C_StartRead(bus);
+        return;
+    }
+
+    bus->phase = I2C_PHASE_WRITE;
+    bus->index = 0;
+    // A lone byte with nothing to read can go out as a single send
+    bus->burst = (t->writeLength > 1 || t->readLength > 0);
+
+    I2CMasterSlaveAddrSet(bus->base, t->addr, false);
+    I2CMasterDataPut(bus->base, t->writeData[0]);
+    I2CMasterControl(bus->base, bus->burst ? I2C_MASTER_CMD_BURST_SEND_START :
+                                             I2C_MASTER_CMD_SINGLE_SEND);
+}
+
+// I2C_Complete
+// Finishes the active transaction and starts the next one.
+// Param i2cStatus_t "status": result of the transaction
+// Return: void
+static void I2C_Complete(i2cBus_t* bus, i2cStatus_t status) {
+    i2cTransaction_t* t = bus->head;
+    i2cDeviceStats_t* device = I2C_FindDevice(bus, t->addr);
+
+    // Address bytes, one per direction, plus the data bytes
+    device->transactions++;
+    device->bytes += t->writeLength + t->readLength + ((t->writeLength > 0) ? 1 : 0) + ((t->readLength > 0) ? 1 : 0);
+    device->busyUS += G8RTOS_GetTimeUS() - bus->startUS;
+    if (status != I2C_DONE) {
+        device->errors++;
+    }
+
+    bus->head = t->next;
+    if (bus->head == 0) {
+        bus->tail = 0;
+    }
+
+    I2C_StartNext(bus);
+
+    t->status = status;
+    if (t->callback) {
+        t->callback(t);
+    }
+    if (t->done) {
+        G8RTOS_SignalSemaphore(t->done);
+        // Let the waiting thread run as soon as this interrupt returns
+        HWREG(NVIC_INT_CTRL) |= NVIC_INT_CTRL_PEND_SV;
+    }
+}
+
+// I2C_Service
+// Advances the active transaction after the module finished a command.
+// Return: void
+static void I2C_Service(i2cBus_t* bus) {
+    i2cTransaction_t* t = bus->head;
+    uint32_t error = 0;
+
+    I2CMasterIntClear(bus->base);
+
+    if (t == 0 || bus->phase == I2C_PHASE_IDLE) {
+        return;
+    }
+
+    if (bus->phase == I2C_PHASE_STOPPING) {
+        I2C_Complete(bus, I2C_ERROR);
+        return;
+    }
+
+    error = I2CMasterErr(bus->base);
+    if (error != I2C_MASTER_ERR_NONE) {
+        // Single commands and lost arbitration end without a stop of ours
+        if (bus->burst && !(error & I2C_MASTER_ERR_ARB_LOST)) {
+            I2CMasterControl(bus->base, (bus->phase == I2C_PHASE_WRITE) ?
+                                        I2C_MASTER_CMD_BURST_SEND_ERROR_STOP :
+                                        I2C_MASTER_CMD_BURST_RECEIVE_ERROR_STOP);
+            bus->phase = I2C_PHASE_STOPPING;
+            return;
+        }
+        I2C_Complete(bus, I2C_ERROR);
+        return;
+    }
+
+    if (bus->phase == I2C_PHASE_WRITE) {
+        bus->index++;
+        if (bus->index < t->writeLength) {
+            I2CMasterDataPut(bus->base, t->writeData[bus->index]);
+            // Keep the burst open on the last byte when a read follows
+            I2CMasterControl(bus->base, (bus->index == t->writeLength - 1 && t->readLength == 0) ?
+                                        I2C_MASTER_CMD_BURST_SEND_FINISH :
+                                        I2C_MASTER_CMD_BURST_SEND_CONT);
+        } else if (t->readLength > 0) {
+            I2C_StartRead(bus);
+        } else {
+            I2C_Complete(bus, I2C_DONE);
+        }
+        return;
+    }
+
+    t->readData[bus->index++] = (I2CMasterDataGet(bus->base) & 0xFF);
+    if (bus->index < t->readLength) {
+        I2CMasterControl(bus->base, (bus->index == t->readLength - 1) ?
+                                    I2C_MASTER_CMD_BURST_RECEIVE_FINISH :
+                                    I2C_MASTER_CMD_BURST_RECEIVE_CONT);
+    } else {
+        I2C_Complete(bus, I2C_DONE);
+    }
+}
+
+// I2C_CanBlock
+// Checks if the caller is a thread that can block on a semaphore.
+// Return: bool
+static bool I2C_CanBlock(void) {
+    return (CurrentlyRunningThread != 0) && !CPUprimask() &&
+           ((HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_VEC_ACT_M) == 0);
+}
+
+/*******************************Private Functions***********************************/
+
 /********************************Public Functions***********************************/
 
 // I2C_Init
@@ -23,6 +305,13 @@
 // Param uint32_t "mod": base address of module
 // Return: void
 void I2C_Init(uint32_t mod) {
+    i2cBus_t* bus = I2C_GetBus(mod);
+
+    // Several drivers share a module, only the first one sets it up
+    if (bus->initialized) {
+        return;
+    }
+
     if (mod == I2C_A_BASE) {
         SysCtlPeripheralEnable(SYSCTL_PERIPH_I2C1);
         SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
@@ -33,6 +322,11 @@ void I2C_Init(uint32_t mod) {
         GPIOPinTypeI2C(I2C_A_GPIO_BASE, I2C_A_PIN_SDA);
 
         I2CMasterInitExpClk(I2C_A_BASE, SysCtlClockGet(), false);
+        I2C_ProgramSpeed(bus, bus->speed);
+
+        IntRegister(INT_I2C1, I2C_A_Handler);
+        IntPrioritySet(INT_I2C1, I2C_INT_PRIORITY);
+        IntEnable(INT_I2C1);
     }
 
     if (mod == I2C_B_BASE) {
@@ -45,7 +339,330 @@ void I2C_Init(uint32_t mod) {
         GPIOPinTypeI2C(I2C_B_GPIO_BASE, I2C_B_PIN_SDA);
 
         I2CMasterInitExpClk(I2C_B_BASE, SysCtlClockGet(), false);
+        I2C_ProgramSpeed(bus, bus->speed);
+
+        IntRegister(INT_I2C0, I2C_B_Handler);
+        IntPrioritySet(INT_I2C0, I2C_INT_PRIORITY);
+        IntEnable(INT_I2C0);
+    }
+
+    bus->head = 0;
+    bus->tail = 0;
+    bus->phase = I2C_PHASE_IDLE;
+    bus->other.priority = I2C_PRIORITY_NORMAL;
+    bus->resetUS = G8RTOS_GetTimeUS();
+    I2CMasterIntClear(mod);
+    I2CMasterIntEnable(mod);
+    bus->initialized = true;
+}
+
+// I2C_SetSpeed
+// Sets the default clock rate of a module, applied from its next transaction.
+// Param uint32_t "mod": base address of module
+// Param uint32_t "speed": I2C_SPEED_100K, I2C_SPEED_400K or I2C_SPEED_1M
+// Return: void
+void I2C_SetSpeed(uint32_t mod, uint32_t speed) {
+    i2cBus_t* bus = I2C_GetBus(mod);
+    int32_t state = StartCriticalSection();
+
+    bus->speed = speed;
+    if (bus->initialized && bus->phase == I2C_PHASE_IDLE) {
+        I2C_ProgramSpeed(bus, speed);
     }
+    EndCriticalSection(state);
+}
+
+// I2C_GetSpeed
+// Param uint32_t "mod": base address of module
+// Return: uint32_t, default clock rate of the module in Hz
+uint32_t I2C_GetSpeed(uint32_t mod) {
+    return I2C_GetBus(mod)->speed;
+}
+
+// I2C_SetDeviceProfile
+// Names a device for statistics and sets the clock rate its transactions
+// run at, so a slow device can share a fast module or the reverse.
+// Param uint32_t "mod": base address of module
+// Param uint8_t "addr": address to device
+// Param uint32_t "speed": rate in Hz, 0 to use the module default
+// Param const char* "name": name used in reports
+// Return: void
+void I2C_SetDeviceProfile(uint32_t mod, uint8_t addr, uint32_t speed, const char* name) {
+    int32_t state = StartCriticalSection();
+    i2cDeviceStats_t* device = I2C_AddDevice(I2C_GetBus(mod), addr);
+
+    if (device) {
+        device->speed = speed;
+        device->name = name;
+    }
+    EndCriticalSection(state);
+}
+
+// I2C_SetDevicePriority
+// Sets where a device's transactions are queued relative to other devices
+// on the module. Devices start at I2C_PRIORITY_NORMAL.
+// Param uint32_t "mod": base address of module
+// Param uint8_t "addr": address to device
+// Param i2cPriority_t "priority": queue priority
+// Return: void
+void I2C_SetDevicePriority(uint32_t mod, uint8_t addr, i2cPriority_t priority) {
+    int32_t state = StartCriticalSection();
+    i2cDeviceStats_t* device = I2C_AddDevice(I2C_GetBus(mod), addr);
+
+    if (device) {
+        device->priority = priority;
+    }
+    EndCriticalSection(state);
+}
+
+// I2C_SetDeviceIncrement
+// Marks a device as auto-incrementing its register address, so
+// I2C_WriteRegisters can write consecutive registers in one burst.
+// Param uint32_t "mod": base address of module
+// Param uint8_t "addr": address to device
+// Param uint8_t "flag": bits ORed into the register address to enable
+//                       auto-increment, 0 if the device always does
+// Return: void
+void I2C_SetDeviceIncrement(uint32_t mod, uint8_t addr, uint8_t flag) {
+    int32_t state = StartCriticalSection();
+    i2cDeviceStats_t* device = I2C_AddDevice(I2C_GetBus(mod), addr);
+
+    if (device) {
+        device->autoIncrement = true;
+        device->incrementFlag = flag;
+    }
+    EndCriticalSection(state);
+}
+
+// I2C_GetDeviceCount
+// Param uint32_t "mod": base address of module
+// Return: uint8_t, number of devices with a profile on the module
+uint8_t I2C_GetDeviceCount(uint32_t mod) {
+    return I2C_GetBus(mod)->deviceCount;
+}
+
+// I2C_GetDeviceStats
+// Copies the profile and traffic of a device. Index deviceCount returns
+// traffic to devices without a profile.
+// Param uint32_t "mod": base address of module
+// Param uint8_t "index": device, 0 to I2C_GetDeviceCount
+// Param i2cDeviceStats_t* "stats": destination
+// Return: bool, false if index is out of range
+bool I2C_GetDeviceStats(uint32_t mod, uint8_t index, i2cDeviceStats_t* stats) {
+    i2cBus_t* bus = I2C_GetBus(mod);
+    int32_t state = 0;
+
+    if (index > bus->deviceCount) {
+        return false;
+    }
+
+    state = StartCriticalSection();
+    *stats = (index == bus->deviceCount) ? bus->other : bus->devices[index];
+    stats->elapsedUS = G8RTOS_GetTimeUS() - bus->resetUS;
+    EndCriticalSection(state);
+
+    if (index == bus->deviceCount) {
+        stats->name = "other";
+    }
+
+    return true;
+}
+
+// I2C_GetThroughput
+// Param i2cDeviceStats_t* "stats": device traffic
+// Return: uint32_t, bytes per second while the device's transactions ran
+uint32_t I2C_GetThroughput(i2cDeviceStats_t* stats) {
+    if (stats->busyUS == 0) {
+        return 0;
+    }
+
+    return (uint32_t)(((uint64_t)stats->bytes * 1000000) / stats->busyUS);
+}
+
+// I2C_GetOccupancy
+// Param i2cDeviceStats_t* "stats": device traffic
+// Return: uint16_t, share of the time since the counters were cleared that
+//         the module spent on the device, in tenths of a percent
+uint16_t I2C_GetOccupancy(i2cDeviceStats_t* stats) {
+    if (stats->elapsedUS == 0) {
+        return 0;
+    }
+
+    return (uint16_t)(((uint64_t)stats->busyUS * 1000) / stats->elapsedUS);
+}
+
+// I2C_GetAverageWait
+// Param i2cDeviceStats_t* "stats": device traffic
+// Return: uint32_t, mean time a transaction was queued before it started, in us
+uint32_t I2C_GetAverageWait(i2cDeviceStats_t* stats) {
+    if (stats->transactions == 0) {
+        return 0;
+    }
+
+    return stats->waitUS / stats->transactions;
+}
+
+// I2C_ResetStats
+// Clears traffic counters of every device, keeping profiles.
+// Return: void
+void I2C_ResetStats(void) {
+    uint8_t b = 0;
+    uint8_t i = 0;
+    int32_t state = StartCriticalSection();
+
+    for (b = 0; b < I2C_BUS_COUNT; b++) {
+        for (i = 0; i <= I2C_MAX_DEVICES; i++) {
+            i2cDeviceStats_t* device = (i < I2C_MAX_DEVICES) ? &buses[b].devices[i] : &buses[b].other;
+            device->transactions = 0;
+            device->errors = 0;
+            device->bytes = 0;
+            device->busyUS = 0;
+            device->waitUS = 0;
+            device->maxWaitUS = 0;
+        }
+        buses[b].resetUS = G8RTOS_GetTimeUS();
+    }
+    EndCriticalSection(state);
+}
+
+// I2C_Submit
+// Queues a transaction behind those of equal or higher priority and returns
+// without waiting. Completion is reported through status, callback and done.
+// Param uint32_t "mod": base address of module
+// Param i2cTransaction_t* "transaction": descriptor to queue
+// Return: void
+void I2C_Submit(uint32_t mod, i2cTransaction_t* transaction) {
+    i2cBus_t* bus = I2C_GetBus(mod);
+    i2cTransaction_t* prev = 0;
+    i2cTransaction_t* cur = 0;
+    int32_t state = 0;
+
+    transaction->status = I2C_PENDING;
+    transaction->next = 0;
+
+    // Nothing to transfer
+    if (transaction->writeLength == 0 && transaction->readLength == 0) {
+        transaction->status = I2C_DONE;
+        return;
+    }
+
+    state = StartCriticalSection();
+    transaction->priority = I2C_FindDevice(bus, transaction->addr)->priority;
+    transaction->submitUS = G8RTOS_GetTimeUS();
+
+    // The active transaction keeps the head, the rest is sorted by priority
+    cur = bus->head;
+    if (cur && bus->phase != I2C_PHASE_IDLE) {
+        prev = cur;
+        cur = cur->next;
+    }
+    while (cur && cur->priority <= transaction->priority) {
+        prev = cur;
+        cur = cur->next;
+    }
+
+    transaction->next = cur;
+    if (prev) {
+        prev->next = transaction;
+    } else {
+        bus->head = transaction;
+    }
+    if (cur == 0) {
+        bus->tail = transaction;
+    }
+
+    if (bus->phase == I2C_PHASE_IDLE) {
+        I2C_StartNext(bus);
+    }
+    EndCriticalSection(state);
+}
+
+// I2C_Transfer
+// Queues a transaction and waits for it. Threads block, other callers
+// service the module until the transaction completes.
+// Param uint32_t "mod": base address of module
+// Param i2cTransaction_t* "transaction": descriptor to run
+// Return: bool, true if the device acknowledged every byte
+bool I2C_Transfer(uint32_t mod, i2cTransaction_t* transaction) {
+    i2cBus_t* bus = I2C_GetBus(mod);
+    semaphore_t done;
+    int32_t state = 0;
+
+    if (I2C_CanBlock()) {
+        G8RTOS_InitSemaphore(&done, 0);
+        transaction->done = &done;
+        transaction->callback = 0;
+        I2C_Submit(mod, transaction);
+        G8RTOS_WaitSemaphore(&done);
+    } else {
+        transaction->done = 0;
+        I2C_Submit(mod, transaction);
+        while (transaction->status == I2C_PENDING) {
+            // With interrupts masked the handler can't run, do its work here
+            state = StartCriticalSection();
+            if (I2CMasterIntStatus(mod, false)) {
+                I2C_Service(bus);
+            }
+            EndCriticalSection(state);
+        }
+    }
+
+    return (transaction->status == I2C_DONE);
+}
+
+// I2C_WriteRead
+// Writes bytes then reads bytes after a repeated start.
+// Param uint32_t "mod": base address of module
+// Param uint8_t "addr": address to device
+// Param const uint8_t* "wr": bytes to write
+// Param uint8_t "wr_bytes": number of bytes to write
+// Param uint8_t* "rd": destination of read bytes
+// Param uint8_t "rd_bytes": number of bytes to read
+// Return: bool, true if the device acknowledged every byte
+bool I2C_WriteRead(uint32_t mod, uint8_t addr, const uint8_t* wr, uint8_t wr_bytes, uint8_t* rd, uint8_t rd_bytes) {
+    i2cTransaction_t t = {0};
+
+    t.addr = addr;
+    t.writeData = wr;
+    t.writeLength = wr_bytes;
+    t.readData = rd;
+    t.readLength = rd_bytes;
+
+    return I2C_Transfer(mod, &t);
+}
+
+// I2C_WriteRegisters
+// Writes a list of registers of one device. Runs of consecutive register
+// addresses go out as one burst each when the device auto-increments,
+// otherwise every register is its own transaction.
+// Param uint32_t "mod": base address of module
+// Param uint8_t "addr": address to device
+// Param const uint8_t* "regs": register addresses, in write order
+// Param const uint8_t* "values": value of each register
+// Param uint8_t "count": number of registers
+// Return: bool, true if the device acknowledged every byte
+bool I2C_WriteRegisters(uint32_t mod, uint8_t addr, const uint8_t* regs, const uint8_t* values, uint8_t count) {
+    i2cDeviceStats_t* device = I2C_FindDevice(I2C_GetBus(mod), addr);
+    uint8_t burst[1 + I2C_MAX_MERGE];
+    uint8_t length = 0;
+    uint8_t i = 0;
+    bool ok = true;
+
+    while (i < count) {
+        length = 1;
+        if (device->autoIncrement) {
+            while (i + length < count && length < I2C_MAX_MERGE && regs[i + length] == (uint8_t)(regs[i] + length)) {
+                length++;
+            }
+        }
+
+        burst[0] = (length > 1) ? (regs[i] | device->incrementFlag) : regs[i];
+        memcpy(&burst[1], &values[i], length);
+        ok &= I2C_WriteRead(mod, addr, burst, length + 1, 0, 0);
+        i += length;
+    }
+
+    return ok;
 }
 
 // I2C_WriteSingle
@@ -55,13 +672,7 @@ void I2C_Init(uint32_t mod) {
 // Param uint8_t "byte": byte to send
 // Return: void
 void I2C_WriteSingle(uint32_t mod, uint8_t addr, uint8_t byte) {
-    I2CMasterSlaveAddrSet(mod, addr, false);
-    I2CMasterDataPut(mod, byte);
-    I2CMasterControl(mod, I2C_MASTER_CMD_SINGLE_SEND);
-    SysCtlDelay(100);
-    while(I2CMasterBusy(mod));
-
-    return;
+    I2C_WriteRead(mod, addr, &byte, 1, 0, 0);
 }
 
 // I2C_ReadSingle
@@ -70,12 +681,11 @@ void I2C_WriteSingle(uint32_t mod, uint8_t addr, uint8_t byte) {
 // Param uint8_t "addr": address to device
 // Return: uint8_t
 uint8_t I2C_ReadSingle(uint32_t mod, uint8_t addr) {
-    I2CMasterSlaveAddrSet(mod, addr, true);
-    I2CMasterControl(mod, I2C_MASTER_CMD_SINGLE_RECEIVE);
-    SysCtlDelay(100);
-    while(I2CMasterBusy(mod));
+    uint8_t byte = 0;
+
+    I2C_WriteRead(mod, addr, 0, 0, &byte, 1);
 
-    return (I2CMasterDataGet(mod) & 0xFF);
+    return byte;
 }
 
 // I2C_WriteMultiple
@@ -86,27 +696,7 @@ uint8_t I2C_ReadSingle(uint32_t mod, uint8_t addr) {
 // Param uint8_t "num_bytes": number of bytes to transmit
 // Return: void
 void I2C_WriteMultiple(uint32_t mod, uint8_t addr, uint8_t* data, uint8_t num_bytes) {
-    I2CMasterSlaveAddrSet(mod, addr, false);
-    I2CMasterDataPut(mod, *(data++));
-    I2CMasterControl(mod, I2C_MASTER_CMD_BURST_SEND_START);
-    SysCtlDelay(100);
-    num_bytes--;
-    while(I2CMasterBusy(mod));
-
-    while (num_bytes > 1) {
-        I2CMasterDataPut(mod, *(data++));
-        I2CMasterControl(mod, I2C_MASTER_CMD_BURST_SEND_CONT);
-        SysCtlDelay(100);
-        num_bytes--;
-        while(I2CMasterBusy(mod));
-    }
-
-    I2CMasterDataPut(mod, *(data++));
-    I2CMasterControl(mod, I2C_MASTER_CMD_BURST_SEND_FINISH);
-    SysCtlDelay(100);
-    while(I2CMasterBusy(mod));
-
-    return;
+    I2C_WriteRead(mod, addr, data, num_bytes, 0, 0);
 }
 
 // I2C_ReadMultiple
@@ -117,30 +707,29 @@ void I2C_WriteMultiple(uint32_t mod, uint8_t addr, uint8_t* data, uint8_t num_by
 // Param uint8_t "num_bytes": number of bytes to read
 // Return: void
 void I2C_ReadMultiple(uint32_t mod, uint8_t addr, uint8_t* data, uint8_t num_bytes) {
-    I2CMasterSlaveAddrSet(mod, addr, true);
-    I2CMasterControl(mod, I2C_MASTER_CMD_BURST_RECEIVE_START);
-    SysCtlDelay(100);
-    while(I2CMasterBusy(mod));
-
-    num_bytes--;
-    *(data++) = (I2CMasterDataGet(mod) & 0xFF);
-
-    while (num_bytes > 1) {
-        I2CMasterControl(mod, I2C_MASTER_CMD_BURST_RECEIVE_CONT);
-        SysCtlDelay(100);
-        while(I2CMasterBusy(mod));
-        num_bytes--;
-        *(data++) = (I2CMasterDataGet(mod) & 0xFF);
-    }
+    I2C_WriteRead(mod, addr, 0, 0, data, num_bytes);
+}
 
-    I2CMasterControl(mod, I2C_MASTER_CMD_BURST_RECEIVE_FINISH);
-    SysCtlDelay(100);
-    while(I2CMasterBusy(mod));
+/********************************Public Functions***********************************/
 
-    *(data++) = (I2CMasterDataGet(mod) & 0xFF);
+/*******************************Interrupt Handlers**********************************/
 
-    return;
+// I2C_A_Handler
+// Advances the I2C_A queue.
+// Return: void
+void I2C_A_Handler(void) {
+    if (I2CMasterIntStatus(I2C_A_BASE, true)) {
+        I2C_Service(&buses[0]);
+    }
 }
 
-/********************************Public Functions***********************************/
+// I2C_B_Handler
+// Advances the I2C_B queue.
+// Return: void
+void I2C_B_Handler(void) {
+    if (I2CMasterIntStatus(I2C_B_BASE, true)) {
+        I2C_Service(&buses[1]);
+    }
+}
 
+/*******************************Interrupt Handlers**********************************/
@@ -1,7 +1,9 @@
 // multimod_joystick.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
-// Defines for joystick functions
+// Date Updated: 2026-10-18
+// Defines for joystick functions. After JOYSTICK_StartSampling, TIMER1A
+// triggers ADC0 sequence 2 and the sequence interrupt filters each sample,
+// so readers only copy the latest filtered state.
 
 /************************************Includes***************************************/
 
@@ -12,6 +14,7 @@
 #include <driverlib/pin_map.h>
 #include <driverlib/adc.h>
 #include <driverlib/interrupt.h>
+#include <driverlib/timer.h>
 
 #include <inc/tm4c123gh6pm.h>
 #include <inc/hw_types.h>
@@ -21,6 +24,84 @@
 
 /************************************Includes***************************************/
 
+/****************************Data Structure Definitions*****************************/
+
+// Filter state of one axis
+typedef struct {
+    int32_t filtered;           // IIR output, JOYSTICK_FRAC_BITS fraction bits
+    int32_t center;             // JOYSTICK_FRAC_BITS + JOYSTICK_CAL_SHIFT fraction bits
+    int32_t noise;              // mean deviation from filtered, JOYSTICK_FRAC_BITS fraction bits
+    int16_t offset;             // filtered - center, 0 inside the deadzone
+    uint16_t deadzone;
+} joystickAxis_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/*******************************Private Variables***********************************/
+
+static joystickAxis_t axisX;
+static joystickAxis_t axisY;
+static volatile uint32_t sampleCount = 0;
+static bool sampling = false;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// JOYSTICK_FilterAxis
+// Runs one raw sample through the IIR, noise estimate, center tracking
+// and deadzone of an axis.
+// Param joystickAxis_t* "axis": axis state
+// Param uint32_t "raw": 12-bit ADC result
+// Return: void
+static void JOYSTICK_FilterAxis(joystickAxis_t* axis, uint32_t raw) {
+    int32_t sample = (int32_t)raw << JOYSTICK_FRAC_BITS;
+    int32_t deviation = 0;
+    int32_t offset = 0;
+    int32_t deadzone = 0;
+
+    // Start from the first sample, the stick rests when sampling starts
+    if (sampleCount == 0) {
+        axis->filtered = sample;
+        axis->center = sample << JOYSTICK_CAL_SHIFT;
+        axis->noise = 0;
+    }
+
+    axis->filtered += (sample - axis->filtered) >> JOYSTICK_IIR_SHIFT;
+
+    deviation = sample - axis->filtered;
+    deviation = (deviation < 0) ? -deviation : deviation;
+    axis->noise += (deviation - axis->noise) >> JOYSTICK_NOISE_SHIFT;
+
+    offset = (axis->filtered - (axis->center >> JOYSTICK_CAL_SHIFT)) >> JOYSTICK_FRAC_BITS;
+
+    // Follow drift of the resting position, not deliberate pushes
+    if (offset > -JOYSTICK_CAL_WINDOW && offset < JOYSTICK_CAL_WINDOW) {
+        axis->center += ((axis->filtered << JOYSTICK_CAL_SHIFT) - axis->center) >> JOYSTICK_CAL_SHIFT;
+    }
+
+    deadzone = (axis->noise * JOYSTICK_DEADZONE_NOISE) >> JOYSTICK_FRAC_BITS;
+    if (deadzone < JOYSTICK_DEADZONE_MIN) {
+        deadzone = JOYSTICK_DEADZONE_MIN;
+    }
+    axis->deadzone = deadzone;
+    axis->offset = (offset > deadzone || offset < -deadzone) ? offset : 0;
+}
+
+// JOYSTICK_ToRaw
+// Return: uint16_t, filtered offset back on the 0-4095 ADC scale
+static uint16_t JOYSTICK_ToRaw(int16_t offset) {
+    int32_t value = JOYSTICK_CENTER + offset;
+
+    if (value < 0) {
+        return 0;
+    }
+
+    return (value > 4095) ? 4095 : value;
+}
+
+/*******************************Private Functions***********************************/
+
 /********************************Public Functions***********************************/
 
 // JOYSTICK_Init
@@ -85,10 +166,17 @@ uint16_t JOYSTICK_GetY() {
 
 
 // JOYSTICK_GetXY
-// Gets X and Y adc readings
+// Gets X and Y adc readings. While sampling runs these are the filtered
+// readings re-centered on JOYSTICK_CENTER, returned without waiting.
 // Return: uint32_t, 16-bit packed, upper 16-bit is X and lower 16-bit is Y.
 uint32_t JOYSTICK_GetXY() {
     uint32_t results[2];
+    joystickState_t state;
+
+    if (sampling) {
+        JOYSTICK_GetState(&state);
+        return ((uint32_t)JOYSTICK_ToRaw(state.x) << 16) | JOYSTICK_ToRaw(state.y);
+    }
 
     // Start conversion
     ADCProcessorTrigger(ADC0_BASE, 2);
@@ -105,5 +193,77 @@ uint32_t JOYSTICK_GetXY() {
     return (results[0] << 16 | results[1]);
 }
 
+// JOYSTICK_StartSampling
+// Switches sequence 2 to timer triggered sampling with hardware averaging.
+// Results are filtered in JOYSTICK_ADC_Handler.
+// Param uint32_t "rate": samples per second
+// Return: void
+void JOYSTICK_StartSampling(uint32_t rate) {
+    ADCSequenceDisable(ADC0_BASE, 2);
+
+    // Averaging applies to every sequence of ADC0
+    ADCHardwareOversampleConfigure(ADC0_BASE, JOYSTICK_OVERSAMPLE);
+
+    ADCSequenceConfigure(ADC0_BASE, 2, ADC_TRIGGER_TIMER, 0);
+    ADCSequenceStepConfigure(ADC0_BASE, 2, 0, ADC_CTL_CH0);
+    ADCSequenceStepConfigure(ADC0_BASE, 2, 1, ADC_CTL_CH1 | ADC_CTL_IE | ADC_CTL_END);
+    ADCSequenceEnable(ADC0_BASE, 2);
+
+    sampleCount = 0;
+    sampling = true;
+
+    ADCIntClear(ADC0_BASE, 2);
+    ADCIntEnable(ADC0_BASE, 2);
+    IntRegister(INT_ADC0SS2, JOYSTICK_ADC_Handler);
+    IntPrioritySet(INT_ADC0SS2, JOYSTICK_INT_PRIORITY);
+    IntEnable(INT_ADC0SS2);
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER1);
+    TimerDisable(TIMER1_BASE, TIMER_A);
+    TimerConfigure(TIMER1_BASE, TIMER_CFG_PERIODIC);
+    TimerLoadSet(TIMER1_BASE, TIMER_A, (SysCtlClockGet() / rate) - 1);
+    TimerControlTrigger(TIMER1_BASE, TIMER_A, true);
+    TimerEnable(TIMER1_BASE, TIMER_A);
+}
+
+// JOYSTICK_GetState
+// Copies the latest filtered state.
+// Param joystickState_t* "state": destination
+// Return: void
+void JOYSTICK_GetState(joystickState_t* state) {
+    bool wasDisabled = IntMasterDisable();
+
+    state->x = axisX.offset;
+    state->y = axisY.offset;
+    state->centerX = axisX.center >> (JOYSTICK_CAL_SHIFT + JOYSTICK_FRAC_BITS);
+    state->centerY = axisY.center >> (JOYSTICK_CAL_SHIFT + JOYSTICK_FRAC_BITS);
+    state->deadzoneX = axisX.deadzone;
+    state->deadzoneY = axisY.deadzone;
+    state->samples = sampleCount;
+
+    if (!wasDisabled) {
+        IntMasterEnable();
+    }
+}
+
 /********************************Public Functions***********************************/
 
+/*******************************Interrupt Handlers**********************************/
+
+// JOYSTICK_ADC_Handler
+// Filters a completed X/Y conversion.
+// Return: void
+void JOYSTICK_ADC_Handler(void) {
+    uint32_t results[4];
+
+    ADCIntClear(ADC0_BASE, 2);
+
+    if (ADCSequenceDataGet(ADC0_BASE, 2, results) >= 2) {
+        JOYSTICK_FilterAxis(&axisX, results[0]);
+        JOYSTICK_FilterAxis(&axisY, results[1]);
+        sampleCount++;
+    }
+}
+
+/*******************************Interrupt Handlers**********************************/
+
@@ -1,7 +1,10 @@
 // multimod_uart.c
 // Date Created: 2023-07-25
-// Date Updated: 2023-07-27
-// Defines for UART functions
+// Date Updated: 2026-10-19
+// Defines for UART functions. A stream owns the TX FIFO until it finishes:
+// it starts once the console ring has drained, and console writers wait
+// on the same lock as the stream's owner. The link UART has rings of its
+// own, filled and drained by its interrupt.
 
 /************************************Includes***************************************/
 
@@ -13,19 +16,133 @@
 #include <inc/tm4c123gh6pm.h>
 #include <inc/hw_memmap.h>
 #include <inc/hw_gpio.h>
+#include <inc/hw_ints.h>
+#include <inc/hw_uart.h>
 
 #include <driverlib/uartstdio.h>
 #include <driverlib/gpio.h>
 #include <driverlib/uart.h>
 #include <driverlib/sysctl.h>
 #include <driverlib/pin_map.h>
+#include <driverlib/interrupt.h>
+
+#include "../multimod_dma.h"
+#include "../../G8RTOS/G8RTOS_Scheduler.h"
+#include "../../G8RTOS/G8RTOS_CriticalSection.h"
 
 /************************************Includes***************************************/
 
+/*************************************Defines***************************************/
+
+#define LINK_UART_BASE          UART1_BASE
+#define LINK_UART_PERIPH        SYSCTL_PERIPH_UART1
+#define LINK_GPIO_PERIPH        SYSCTL_PERIPH_GPIOB
+#define LINK_GPIO_BASE          GPIO_PORTB_BASE
+#define LINK_RX_PIN             GPIO_PIN_0
+#define LINK_TX_PIN             GPIO_PIN_1
+#define LINK_RX_PIN_CONFIG      GPIO_PB0_U1RX
+#define LINK_TX_PIN_CONFIG      GPIO_PB1_U1TX
+#define LINK_INT                INT_UART1
+
+#define LINK_RING_MASK          (LINK_RING_SIZE - 1)
+
+// Error bits read with a character from the data register
+#define LINK_RX_ERRORS          0xF00
+
+/*************************************Defines***************************************/
+
+/*******************************Private Variables***********************************/
+
+static uint32_t baudRate = UART_BAUD;
+
+// Signaled when received bytes are waiting in the console ring
+static semaphore_t* rxReady = 0;
+
+// Stream in progress. The test repeats one block instead of reading a
+// buffer as long as the stream.
+static const uint8_t* streamNext = 0;
+static uint32_t streamLeft = 0;
+static const uint8_t* streamBlock = 0;
+static uint32_t streamBlockLength = 0;
+static semaphore_t* streamDone = 0;
+static volatile bool streamBusy = false;
+static uartStreamStats_t streamStats;
+
+static uint8_t testBlock[UART_TEST_BLOCK];
+
+// Link rings, one writer and one reader each
+static uint8_t linkTx[LINK_RING_SIZE];
+static volatile uint32_t linkTxHead = 0;
+static volatile uint32_t linkTxTail = 0;
+static uint8_t linkRx[LINK_RING_SIZE];
+static volatile uint32_t linkRxHead = 0;
+static volatile uint32_t linkRxTail = 0;
+static uartLinkStats_t linkStats;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// UART_StreamArm
+// Starts the next chunk of the stream on the TX channel.
+// Return: void
+static void UART_StreamArm(void) {
+    uint32_t count = streamLeft;
+
+    if (streamBlock && streamNext == streamBlock + streamBlockLength) {
+        streamNext = streamBlock;
+    }
+    if (streamBlock && count > (uint32_t)(streamBlock + streamBlockLength - streamNext)) {
+        count = (uint32_t)(streamBlock + streamBlockLength - streamNext);
+    }
+    if (count > UART_DMA_CHUNK) {
+        count = UART_DMA_CHUNK;
+    }
+
+    uDMAChannelTransferSet(UDMA_CHANNEL_UART0TX | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                           (void*)streamNext, (void*)(UART0_BASE + UART_O_DR), count);
+    uDMAChannelEnable(UDMA_CHANNEL_UART0TX);
+
+    streamNext += count;
+    streamLeft -= count;
+}
+
+// UART_StreamBegin
+// Waits for the console ring to drain and hands the FIFO to the uDMA.
+// Return: void
+static void UART_StreamBegin(uint32_t length, semaphore_t* done) {
+    UARTFlushTx(false);
+
+    streamLeft = length;
+    streamDone = done;
+    streamBusy = true;
+    streamStats.streams++;
+    streamStats.bytes += length;
+
+    UARTDMAEnable(UART0_BASE, UART_DMA_TX);
+    UART_StreamArm();
+}
+
+// UART_LinkFill
+// Moves link bytes from the ring into the TX FIFO while it has room. Runs
+// in the link interrupt or with interrupts off.
+// Return: void
+static void UART_LinkFill(void) {
+    while (linkTxTail != linkTxHead && UARTSpaceAvail(LINK_UART_BASE)) {
+        UARTCharPutNonBlocking(LINK_UART_BASE, linkTx[linkTxTail & LINK_RING_MASK]);
+        linkTxTail++;
+    }
+}
+
+/*******************************Private Functions***********************************/
+
 /********************************Public Functions***********************************/
 
 // UART_Init
-// Initializes UART serial communication with PC
+// Initializes UART serial communication with PC. Output goes through the
+// console's transmit ring; the interrupt tops up the 16 byte FIFO each time
+// it falls to 2 bytes, so a print costs the copy and not the line time.
+// Received characters are buffered without echo.
 // Return: void
 void UART_Init() {
     // Enable port A
@@ -39,28 +156,311 @@ void UART_Init() {
     GPIOPinConfigure(GPIO_PA1_U0TX);
     GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
 
-    UARTFIFODisable(UART0_BASE);
+    UARTFIFOEnable(UART0_BASE);
 
     // Set UART clock source
     UARTClockSourceSet(UART0_BASE, UART_CLOCK_SYSTEM);
+
+    // The console enables the interrupt once configured. Stream
+    // completions come in on the same vector.
+    IntRegister(INT_UART0, UART_Handler);
+    IntPrioritySet(INT_UART0, UART_INT_PRIORITY);
+
     // Configure UART baud rate
+    UARTStdioConfig(0, baudRate, SysCtlClockGet());
+
+    // Echo would write the ring from the interrupt while a thread prints
+    UARTEchoSet(false);
+
+    // One byte per request, the TX FIFO asks for a burst at 2 bytes left
+    DMA_Init();
+    uDMAChannelAssign(UDMA_CH9_UART0TX);
+    uDMAChannelAttributeDisable(UDMA_CHANNEL_UART0TX, UDMA_ATTR_ALL);
+    uDMAChannelControlSet(UDMA_CHANNEL_UART0TX | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_8);
+}
+
+// UART_SetBaud
+// Changes the console baud once everything queued has been sent. The host
+// has to follow. Callers hold the console lock.
+// Param uint32_t "baud": bits per second, up to the clock / 8
+// Return: bool, false if the rate is out of range or a stream is running
+bool UART_SetBaud(uint32_t baud) {
+    if (baud == 0 || baud > SysCtlClockGet() / UART_MAX_BAUD_DIVISOR || streamBusy) {
+        return false;
+    }
+
+    UARTFlushTx(false);
+    while (UARTBusy(UART0_BASE));
+
+    // High speed mode (clock / 8) is picked when clock / 16 is too slow
+    UARTDisable(UART0_BASE);
+    UARTConfigSetExpClk(UART0_BASE, SysCtlClockGet(), baud,
+                        UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE);
+    UARTEnable(UART0_BASE);
+
+    baudRate = baud;
+    return true;
+}
+
+// UART_GetBaud
+// Return: uint32_t, the console baud
+uint32_t UART_GetBaud(void) {
+    return baudRate;
+}
+
+// UART_GetDropped
+// Gets the characters lost to a full transmit ring since UART_Init.
+// Return: uint32_t
+uint32_t UART_GetDropped(void) {
+    return UARTTxBytesDropped();
+}
+
+// UART_WriteFrame
+// Queues binary data on the console unchanged, all of it or none.
+// Callers hold the same lock as console printers.
+// Param const uint8_t* "frame": bytes to send
+// Param uint16_t "length": bytes
+// Return: bool, false if the transmit ring had no room
+bool UART_WriteFrame(const uint8_t* frame, uint16_t length) {
+    return UARTwriteBlock(frame, length);
+}
 
-    UARTStdioConfig(0, 115200, SysCtlClockGet());
+// UART_SetRxSemaphore
+// Sets a semaphore signaled from the interrupt whenever received bytes are
+// waiting. Echo is off, so the reader sees them as they came in.
+// Param semaphore_t* "ready": semaphore, 0 for none
+// Return: void
+void UART_SetRxSemaphore(semaphore_t* ready) {
+    rxReady = ready;
+}
+
+// UART_StreamStart
+// Sends a buffer by uDMA, one interrupt per UART_DMA_CHUNK bytes. Waits
+// for the console ring to drain first. Callers hold the console lock and
+// the buffer until the stream ends.
+// Param const uint8_t* "data": bytes to send
+// Param uint32_t "length": bytes
+// Param semaphore_t* "done": optional, signaled when the last byte is in the FIFO
+// Return: bool, false if a stream is already running
+bool UART_StreamStart(const uint8_t* data, uint32_t length, semaphore_t* done) {
+    if (streamBusy || length == 0) {
+        return false;
+    }
+
+    streamNext = data;
+    streamBlock = 0;
+    UART_StreamBegin(length, done);
+    return true;
+}
+
+// UART_StreamBusy
+// Return: bool, true until the last byte of a stream is in the FIFO
+bool UART_StreamBusy(void) {
+    return streamBusy;
+}
 
+// UART_GetStreamStats
+// Gets stream counts since reset.
+// Param uartStreamStats_t* "stats": destination
+// Return: void
+void UART_GetStreamStats(uartStreamStats_t* stats) {
+    *stats = streamStats;
+}
+
+// UART_StreamTest
+// Sends a header line and then a test pattern by uDMA and times it until
+// the last bit has left. Blocks the calling thread, which holds the
+// console lock. tools/uart_throughput checks the pattern on the host.
+// Param uint32_t "bytes": pattern bytes to send
+// Param uartTestResult_t* "result": measured rate
+// Return: void
+void UART_StreamTest(uint32_t bytes, uartTestResult_t* result) {
+    semaphore_t done;
+    uint32_t interrupts = streamStats.interrupts;
+    uint32_t start = 0;
+    uint32_t elapsedUS = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < UART_TEST_BLOCK; i++) {
+        testBlock[i] = UART_TEST_BYTE(i);
+    }
+
+    UARTprintf("UART test %d bytes at %d baud\n", bytes, baudRate);
+
+    // Only the pattern is timed, the header leaves the line first
+    UARTFlushTx(false);
+    while (UARTBusy(UART0_BASE));
+
+    G8RTOS_InitSemaphore(&done, 0);
+    if (bytes && !streamBusy) {
+        streamNext = testBlock;
+        streamBlock = testBlock;
+        streamBlockLength = UART_TEST_BLOCK;
+        UART_StreamBegin(bytes, &done);
+        start = G8RTOS_GetTimeUS();
+        G8RTOS_WaitSemaphore(&done);
+        while (UARTBusy(UART0_BASE));
+        elapsedUS = G8RTOS_GetTimeUS() - start;
+    }
+
+    result->baud = baudRate;
+    result->bytes = bytes;
+    result->elapsedUS = elapsedUS;
+    result->interrupts = streamStats.interrupts - interrupts;
 }
 
 // UART_BeagleBone_Init
-// Initializes UART serial communication with Beaglebone
+// Initializes the link UART to a BeagleBone or a second board, 8N1 at
+// LINK_BAUD. Received bytes are moved into a ring by the interrupt at half
+// a FIFO or after a gap in the line, sent bytes are fed to the FIFO each
+// time it falls to a quarter.
 // Return: void
 void UART_BeagleBone_Init(void) {
     // Enable peripherals
+    SysCtlPeripheralEnable(LINK_GPIO_PERIPH);
+    SysCtlPeripheralEnable(LINK_UART_PERIPH);
 
-    // Configure UART4 pins
+    // Configure link pins
+    GPIOPinConfigure(LINK_RX_PIN_CONFIG);
+    GPIOPinConfigure(LINK_TX_PIN_CONFIG);
+    GPIOPinTypeUART(LINK_GPIO_BASE, LINK_RX_PIN | LINK_TX_PIN);
 
-    // Configure UART4 settings
+    // Configure link settings
+    UARTConfigSetExpClk(LINK_UART_BASE, SysCtlClockGet(), LINK_BAUD,
+                        UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE);
+    UARTFIFOEnable(LINK_UART_BASE);
+    UARTFIFOLevelSet(LINK_UART_BASE, UART_FIFO_TX2_8, UART_FIFO_RX4_8);
+    UARTTxIntModeSet(LINK_UART_BASE, UART_TXINT_MODE_FIFO);
 
-    // Enable UART4 RX interrupts
+    // Enable link RX interrupts, TX is enabled while the ring has bytes
+    IntRegister(LINK_INT, UART_Link_Handler);
+    IntPrioritySet(LINK_INT, LINK_INT_PRIORITY);
+    UARTIntEnable(LINK_UART_BASE, UART_INT_RX | UART_INT_RT);
+    IntEnable(LINK_INT);
+}
+
+// UART_LinkWrite
+// Queues bytes on the link, all of them or none.
+// Param const uint8_t* "data": bytes to send
+// Param uint16_t "length": bytes
+// Return: bool, false if the transmit ring had no room
+bool UART_LinkWrite(const uint8_t* data, uint16_t length) {
+    int32_t state = StartCriticalSection();
+    uint32_t head = linkTxHead;
+    uint16_t i = 0;
+
+    if (LINK_RING_SIZE - (head - linkTxTail) < length) {
+        EndCriticalSection(state);
+        return false;
+    }
+
+    for (i = 0; i < length; i++) {
+        linkTx[(head + i) & LINK_RING_MASK] = data[i];
+    }
+    linkTxHead = head + length;
+    linkStats.txBytes += length;
+
+    // The interrupt only comes as the FIFO drains, so start it off here
+    UART_LinkFill();
+    if (linkTxTail != linkTxHead) {
+        UARTIntEnable(LINK_UART_BASE, UART_INT_TX);
+    }
+    EndCriticalSection(state);
+
+    return true;
+}
+
+// UART_LinkRead
+// Takes received link bytes. Only one thread may read.
+// Param uint8_t* "data": destination
+// Param uint32_t "size": most bytes to take
+// Return: uint32_t, bytes taken
+uint32_t UART_LinkRead(uint8_t* data, uint32_t size) {
+    uint32_t head = linkRxHead;
+    uint32_t tail = linkRxTail;
+    uint32_t n = 0;
+
+    while (n < size && tail != head) {
+        data[n++] = linkRx[tail & LINK_RING_MASK];
+        tail++;
+    }
+    linkRxTail = tail;
+
+    return n;
+}
+
+// UART_GetLinkStats
+// Gets link byte and error counts since reset.
+// Param uartLinkStats_t* "stats": destination
+// Return: void
+void UART_GetLinkStats(uartLinkStats_t* stats) {
+    *stats = linkStats;
 }
 
 /********************************Public Functions***********************************/
 
+/*******************************Interrupt Handlers**********************************/
+
+// UART_Handler
+// Starts the next chunk of a stream once the last one has been taken,
+// then serves the console rings and wakes the reader.
+// Return: void
+void UART_Handler(void) {
+    uint32_t received = 0;
+
+    if (streamBusy && !uDMAChannelIsEnabled(UDMA_CHANNEL_UART0TX)) {
+        streamStats.interrupts++;
+
+        if (streamLeft) {
+            UART_StreamArm();
+        } else {
+            UARTDMADisable(UART0_BASE, UART_DMA_TX);
+            streamBusy = false;
+            if (streamDone) {
+                G8RTOS_SignalSemaphore(streamDone);
+            }
+        }
+    }
+
+    // The console handler clears the status, so look first
+    received = UARTIntStatus(UART0_BASE, true) & (UART_INT_RX | UART_INT_RT);
+
+    UARTStdioIntHandler();
+
+    if (rxReady && received && UARTRxBytesAvail()) {
+        G8RTOS_SignalSemaphore(rxReady);
+    }
+}
+
+// UART_Link_Handler
+// Moves received bytes into the link ring, dropping damaged ones, and
+// refills the TX FIFO until the transmit ring is empty.
+// Return: void
+void UART_Link_Handler(void) {
+    uint32_t status = UARTIntStatus(LINK_UART_BASE, true);
+    int32_t c = 0;
+
+    UARTIntClear(LINK_UART_BASE, status);
+
+    while (UARTCharsAvail(LINK_UART_BASE)) {
+        c = UARTCharGetNonBlocking(LINK_UART_BASE);
+        if (c & LINK_RX_ERRORS) {
+            linkStats.rxErrors++;
+        } else if (linkRxHead - linkRxTail >= LINK_RING_SIZE) {
+            linkStats.rxDropped++;
+        } else {
+            linkRx[linkRxHead & LINK_RING_MASK] = (uint8_t)c;
+            linkRxHead++;
+            linkStats.rxBytes++;
+        }
+    }
+
+    UART_LinkFill();
+    if (linkTxTail == linkTxHead) {
+        UARTIntDisable(LINK_UART_BASE, UART_INT_TX);
+    }
+}
+
+/*******************************Interrupt Handlers**********************************/
+
@@ -73,6 +73,13 @@ static unsigned char g_pcUARTTxBuffer[UART_TX_BUFFER_SIZE];
 static volatile uint32_t g_ui32UARTTxWriteIndex = 0;
 static volatile uint32_t g_ui32UARTTxReadIndex = 0;
 
+//*****************************************************************************
+//
+// Count of characters discarded because the output ring buffer was full.
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32UARTTxDropped = 0;
+
 //*****************************************************************************
 //
 // Input ring buffer.  Buffer is full if g_ui32UARTTxReadIndex is one ahead of
@@ -465,6 +472,7 @@ UARTwrite(const char *pcBuf, uint32_t ui32Len)
                 //
                 // Buffer is full - discard remaining characters and return.
                 //
+                g_ui32UARTTxDropped += ui32Len - uIdx;
                 break;
             }
         }
@@ -486,6 +494,7 @@ UARTwrite(const char *pcBuf, uint32_t ui32Len)
             //
             // Buffer is full - discard remaining characters and return.
             //
+            g_ui32UARTTxDropped += ui32Len - uIdx;
             break;
         }
     }
@@ -1352,6 +1361,83 @@ UARTTxBytesFree(void)
 }
 #endif
 
+//*****************************************************************************
+//
+//! Writes a block of binary data to the UART output.
+//!
+//! \param pui8Buf points to the data to transmit.
+//! \param ui32Len is the number of bytes to transmit.
+//!
+//! This function, available only when the module is built to operate in
+//! buffered mode using \b UART_BUFFERED, copies the data to the transmit
+//! buffer without the LF to CRLF translation or the stop at a null
+//! character done by UARTwrite().  The block is written whole or not at all,
+//! so framed protocols never send part of a frame.
+//!
+//! \return Returns \b true if the block was buffered or \b false if there
+//! was not room for all of it.
+//
+//*****************************************************************************
+#if defined(UART_BUFFERED) || defined(DOXYGEN)
+bool
+UARTwriteBlock(const uint8_t *pui8Buf, uint32_t ui32Len)
+{
+    uint32_t ui32Idx;
+
+    //
+    // Check for valid arguments.
+    //
+    ASSERT(pui8Buf != 0);
+    ASSERT(g_ui32Base != 0);
+
+    //
+    // Refuse the block if it does not fit.  One slot always stays empty
+    // to tell a full buffer from an empty one.
+    //
+    if(ui32Len >= TX_BUFFER_FREE)
+    {
+        return(false);
+    }
+
+    for(ui32Idx = 0; ui32Idx < ui32Len; ui32Idx++)
+    {
+        g_pcUARTTxBuffer[g_ui32UARTTxWriteIndex] = pui8Buf[ui32Idx];
+        ADVANCE_TX_BUFFER_INDEX(g_ui32UARTTxWriteIndex);
+    }
+
+    //
+    // Make sure that the UART is set up to transmit it.
+    //
+    if(!TX_BUFFER_EMPTY)
+    {
+        UARTPrimeTransmit(g_ui32Base);
+        MAP_UARTIntEnable(g_ui32Base, UART_INT_TX);
+    }
+
+    return(true);
+}
+#endif
+
+//*****************************************************************************
+//
+//! Returns the number of characters discarded by a full transmit buffer.
+//!
+//! This function, available only when the module is built to operate in
+//! buffered mode using \b UART_BUFFERED, may be used to determine how much
+//! output has been lost since the console was configured.  Each call to
+//! UARTwrite() that finds the buffer full discards the rest of its string.
+//!
+//! \return Returns the count of discarded characters.
+//
+//*****************************************************************************
+#if defined(UART_BUFFERED) || defined(DOXYGEN)
+uint32_t
+UARTTxBytesDropped(void)
+{
+    return(g_ui32UARTTxDropped);
+}
+#endif
+
 //*****************************************************************************
 //
 //! Looks ahead in the receive buffer for a particular character.
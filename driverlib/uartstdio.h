@@ -71,7 +71,10 @@ extern void UARTFlushTx(bool bDiscard);
 extern void UARTFlushRx(void);
 extern int UARTRxBytesAvail(void);
 extern int UARTTxBytesFree(void);
+extern uint32_t UARTTxBytesDropped(void);
+extern bool UARTwriteBlock(const uint8_t *pui8Buf, uint32_t ui32Len);
 extern void UARTEchoSet(bool bEnable);
+extern void UARTStdioIntHandler(void);
 #endif
 
 //*****************************************************************************
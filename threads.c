@@ -1,6 +1,6 @@
 // G8RTOS_Threads.c
 // Date Created: 2023-07-25
-// Date Updated: 2024-12-11
+// Date Updated: 2026-10-19
 // Defines for thread functions.
 
 /************************************Includes***************************************/
@@ -15,21 +15,72 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <time.h>
+#include <string.h>
+#include <stdarg.h>
 #include "threads.h"
 #include "MultimodDrivers/multimod_ST7789.h"
+#include "Game/tetris_ai.h"
+#include "Game/tetris_input.h"
+#include "Game/tetris_level.h"
+#include "Game/tetris_leds.h"
+#include "Game/tetris_motion.h"
+#include "Game/tetris_light.h"
+#include "Game/tetris_music.h"
+#include "Game/tetris_sfx.h"
+#include "Game/tetris_mic.h"
+#include "Game/tetris_telemetry.h"
+#include "Game/tetris_console.h"
+#include "Game/tetris_versus.h"
 
 // Function prototypes for game logic
 static void InitializeBoard(void);
 static void SpawnNewPiece(void);
+static void SpawnPiece(int pieceType);
+static void EndGame(void);
+static void HoldPiece(void);
+static void HardDrop(void);
+static void UpdateColumnTops(void);
+static int LandingPieceY(void);
+static void InvalidatePanels(void);
+static void DrawPanelPiece(int slot, uint16_t x, uint16_t y, int pieceType);
+static void DrawPanels(void);
+static void DrawPeerBoard(void);
 static bool CanMovePiece(int newX, int newY);
-static void MovePiece(int deltaX, int deltaY);
+static bool MovePiece(int deltaX, int deltaY);
+static void LockPiece(void);
 static void UpdateTetrisDisplay(void);
 static void PlacePieceOnBoard(void);
 static void DrawGameOverScreen(void);
-static void RotatePiece(bool clockwise);
-static void CheckAndClearLines(void);
+static bool RotatePiece(bool clockwise);
+static int CheckAndClearLines(void);
+static bool InsertGarbage(uint8_t lines, uint8_t hole);
 static void DrawPauseScreen(void);
 static void DrawStartScreen(void);
+static void RestartGame(const uint32_t* seed);
+static void SetPaused(bool pause);
+static uint8_t LinkSession(void);
+static void PrintGameReport(void);
+static void PrintBusReport(void);
+static void PrintInputReport(void);
+static void PrintAudioReport(void);
+static void QueueInput(uint32_t event);
+static void RequestButtons(void);
+static void ButtonsRead(i2cTransaction_t* transaction);
+static void HandleStickEvent(uint32_t event);
+static void HandleButtonEvent(uint32_t event);
+static void AudioRefill(int16_t* samples, uint16_t count);
+static void MicCapture(const uint16_t* samples, uint16_t count);
+static void ConsolePrint(const char* format, ...);
+static bool ConsoleLevel(uint8_t argc, char** argv);
+static bool ConsolePriority(uint8_t argc, char** argv);
+static bool ConsoleThreads(uint8_t argc, char** argv);
+static bool ConsoleFIFOs(uint8_t argc, char** argv);
+static bool ConsoleBaud(uint8_t argc, char** argv);
+static bool ConsoleTelemetry(uint8_t argc, char** argv);
+static bool ConsolePause(uint8_t argc, char** argv);
+static bool ConsoleSeed(uint8_t argc, char** argv);
+static bool ConsoleReplay(uint8_t argc, char** argv);
+static bool ConsoleLink(uint8_t argc, char** argv);
 
 /*********************************Global Variables**********************************/
 
@@ -39,9 +90,6 @@ semaphore_t sem_GameState;
 // Game state
 static GameState gameState;
 
-// Drop speed variable
-uint32_t dropSpeed = 250;
-
 // Fast drop flag
 static bool fastDrop = false;
 
@@ -51,6 +99,12 @@ static uint8_t currentPiece[PIECE_SIZE][PIECE_SIZE];
 // Current score tracker
 static uint32_t currentScore = 0;
 
+// Game over reports waiting for the telemetry thread, with the score and
+// versus result the game ended on
+static bool reportPending = false;
+static uint32_t reportScore = 0;
+static versusPhase_t reportPhase;
+
 // Game over screen drawn flag
 static bool gameOverScreenDrawn = false;
 
@@ -66,6 +120,74 @@ static bool gameStarted = false;
 // Start screen drawn flag
 static bool startScreenDrawn = false;
 
+// Autoplayer flag, set when the game is started with SW1
+static bool autoplay = false;
+
+// Button port read by the I2C interrupt, and whether an edge arrived
+// while the previous read was still on the bus
+static uint8_t buttonPort = 0xFF;
+static volatile bool buttonReread = false;
+
+// Time of the last BMI160 FIFO interrupt
+static volatile uint32_t motionTime = 0;
+
+// Seed the current game's pieces were drawn from, and whether the next game
+// takes it as it is instead of a new one
+static uint32_t gameSeed = 0;
+static bool seedPending = false;
+
+// Number of pieces spawned, lets the autoplayer detect a new piece
+static uint32_t piecesSpawned = 0;
+
+// Highest filled row of each column, BOARD_HEIGHT if the column is empty.
+// Kept up to date as pieces are placed and lines are cleared so landing rows
+// need no probing.
+static int columnTop[BOARD_WIDTH];
+
+// Colors currently drawn in the hold (slot 0) and preview panel cells,
+// so only cells that change are sent to the display
+static uint16_t panelShadow[PREVIEW_COUNT + 1][PANEL_ROWS][PIECE_SIZE];
+
+// Panel windows have been drawn since the last full screen redraw
+static bool panelsDrawn = false;
+
+// Colors currently drawn in the versus opponent's board, and whether its
+// window has been drawn since the last full screen redraw
+static uint16_t peerShadow[BOARD_HEIGHT][BOARD_WIDTH];
+static bool peerDrawn = false;
+
+// Stick direction held, -1 left and 1 right, sent to the versus opponent
+// so it can move the piece on between states
+static int8_t heldShift = 0;
+
+// Array to map cell values to colors
+static const uint16_t cellColors[] = {
+    COLOR_EMPTY,  // 0
+    COLOR_I,      // 1
+    COLOR_O,      // 2
+    COLOR_T,      // 3
+    COLOR_S,      // 4
+    COLOR_Z,      // 5
+    COLOR_J,      // 6
+    COLOR_L,      // 7
+    COLOR_GHOST,  // 8
+    COLOR_GARBAGE // 9
+};
+
+// Console commands on top of the built in get / set of tunables
+static const consoleCommand_t consoleCommands[] = {
+    {"level", "[1-20], show or set the level, and with it the drop speed", ConsoleLevel},
+    {"prio", "id priority, change a thread's priority", ConsolePriority},
+    {"threads", "thread states and load since the last dump", ConsoleThreads},
+    {"fifo", "FIFO and queue fill and losses", ConsoleFIFOs},
+    {"baud", "[rate], show or set the console baud", ConsoleBaud},
+    {"telemetry", "[on | off], show or switch binary frames", ConsoleTelemetry},
+    {"pause", "[on | off], toggle or set pause", ConsolePause},
+    {"seed", "[n], show the game's seed or set the next game's", ConsoleSeed},
+    {"replay", "restart with the same pieces", ConsoleReplay},
+    {"link", "board link and versus counts", ConsoleLink}
+};
+
 /*********************************Global Variables**********************************/
 
 /********************************Public Functions***********************************/
@@ -77,13 +199,43 @@ void Threads_Init(void) {
     // Initialize game state semaphore
     G8RTOS_InitSemaphore(&sem_GameState, 1);
     G8RTOS_InitSemaphore(&sem_UART, 1);
-    G8RTOS_InitSemaphore(&sem_I2CA, 1);
     G8RTOS_InitSemaphore(&sem_SPIA, 1);
-    G8RTOS_InitSemaphore(&sem_PCA9555_Debounce, 0);
+    G8RTOS_InitSemaphore(&sem_Motion, 0);
+    G8RTOS_InitSemaphore(&sem_Console, 0);
 
     // Initialize FIFOs
-    G8RTOS_InitFIFO(BUTTONS_FIFO);
-    G8RTOS_InitFIFO(JOYSTICK_FIFO);
+    G8RTOS_InitFIFO(INPUT_FIFO);
+
+    // Initialize input timing
+    TetrisInput_Init();
+
+    // The link session is drawn from joystick noise while single reads
+    // still work, so a restarted board is told apart from the one before
+    TetrisVersus_Init(UART_LinkWrite, LinkSession());
+
+    // Joystick filters in its ADC interrupt from here on
+    JOYSTICK_StartSampling(JOYSTICK_SAMPLE_RATE);
+
+    // LED matrix animations
+    TetrisLEDs_Init();
+
+    // Display and LED brightness follow the ambient light
+    TetrisLight_Init();
+
+    // Music and effects render in the DAC stream's refill interrupt
+    TetrisMusic_Init(AUDIO_SAMPLE_RATE);
+    TetrisSFX_Init(AUDIO_SAMPLE_RATE);
+    AudioStream_Start(AUDIO_SAMPLE_RATE, AudioRefill);
+
+    // Claps and whistles are measured in the mic capture interrupt
+    TetrisMic_Init(AUDIO_CAPTURE_RATE);
+    AudioCapture_Start(AUDIO_CAPTURE_RATE, MicCapture);
+
+    // Binary frames share the console with the text reports
+    TetrisTelemetry_Init(UART_WriteFrame);
+
+    // Commands are read as they come in, nothing is polled
+    UART_SetRxSemaphore(&sem_Console);
 
     // Initialize flags
     gameStarted = false;
@@ -93,27 +245,38 @@ void Threads_Init(void) {
     
     // Reset score
     currentScore = 0;
+
+    // Bus statistics count from here, not the driver setup traffic
+    I2C_ResetStats();
+
+    // Read the buttons once, the PCA9555 line may already be asserted
+    RequestButtons();
     
     // Add background threads
     G8RTOS_AddThread(Tetris_Game_Thread, GAME_THREAD_PRIORITY, "Game Thread");
-    G8RTOS_AddThread(Tetris_Joystick_Thread, JOYSTICK_THREAD_PRIORITY, "Joystick Thread");
-    G8RTOS_AddThread(Read_Buttons, READ_BUTTONS_PRIORITY, "Read Buttons");
-    G8RTOS_AddThread(Tetris_Button_Thread, BUTTON_THREAD_PRIORITY, "TETRIS_BUTTON");
+    G8RTOS_AddThread(Tetris_Input_Thread, INPUT_THREAD_PRIORITY, "Input Thread");
+    G8RTOS_AddThread(Tetris_Motion_Thread, MOTION_THREAD_PRIORITY, "Motion Thread");
+    G8RTOS_AddThread(Tetris_AI_Thread, AI_THREAD_PRIORITY, "AI Thread");
+    G8RTOS_AddThread(Tetris_Telemetry_Thread, TELEMETRY_THREAD_PRIORITY, "Telemetry");
+    G8RTOS_AddThread(Tetris_Console_Thread, CONSOLE_THREAD_PRIORITY, "Console");
+    G8RTOS_AddThread(Tetris_Link_Thread, LINK_THREAD_PRIORITY, "Link");
     G8RTOS_AddThread(Idle_Thread, 255, "Idle Thread");
 
     // Add periodic threads
     G8RTOS_Add_PeriodicEvent(Tetris_Display_Thread, DISPLAY_PERIOD, 0);
-    G8RTOS_Add_PeriodicEvent(Read_Joystick, JOYSTICK_PERIOD, 1);
+    G8RTOS_Add_PeriodicEvent(Read_Input, INPUT_PERIOD, 1);
+    G8RTOS_Add_PeriodicEvent(TetrisLEDs_Update, LEDS_FRAME_PERIOD, 2);
 
     // Add aperiodic events
     G8RTOS_Add_APeriodicEvent(Button_Handler, 1, BUTTON_INTERRUPT);
+    G8RTOS_Add_APeriodicEvent(Sensors_Handler, 2, BMI160_INTERRUPT);
 }
 
+// Clears the board and screen for a new game, with the game state semaphore held.
 static void InitializeBoard(void) {
     int i = 0;
     int j = 0;
     
-    G8RTOS_WaitSemaphore(&sem_GameState);
     for (i = 0; i < BOARD_HEIGHT; i++) {
         for (j = 0; j < BOARD_WIDTH; j++) {
             gameState.board[i][j] = CELL_EMPTY;
@@ -139,46 +302,67 @@ static void InitializeBoard(void) {
     ST7789_DrawRectangle(239, 0, 1, Y_MAX, ST7789_WHITE);
     EndCriticalSection(IBit_State);
     
-    gameState.nextPieceType = 0xFF;
+    // Each game draws its pieces from its own seed so it can be replayed
+    if (!seedPending) {
+        gameSeed = G8RTOS_GetTimeUS();
+    }
+    seedPending = false;
+    srand(gameSeed);
+
+    // With a peer on the link both boards play these pieces
+    TetrisVersus_NewGame(gameSeed, SystemTime);
+    heldShift = 0;
+
+    gameState.nextPieceType = NO_PIECE;
+    gameState.holdPieceType = NO_PIECE;
+    gameState.holdUsed = false;
+    TetrisLevel_Init(LEVEL_START);
+    TetrisMusic_SetLevel(LEVEL_START);
+    TetrisMusic_Play();
+    UpdateColumnTops();
+    InvalidatePanels();
+    TetrisTelemetry_Keyframe();
     gameOverScreenDrawn = false;
     pauseScreenDrawn = false;
-    G8RTOS_SignalSemaphore(&sem_GameState);
 }
 
 static void SpawnNewPiece(void) {
+    int i;
+    int pieceType;
+
+    // Fill the preview queue on the first spawn
+    if (gameState.nextPieceType == NO_PIECE) {
+        for (i = 0; i < PREVIEW_COUNT; i++) {
+            gameState.previewTypes[i] = ((rand() * 5) % 7);
+        }
+    }
+
+    // Take the head of the queue and generate a new tail
+    pieceType = gameState.previewTypes[0];
+    for (i = 0; i < PREVIEW_COUNT - 1; i++) {
+        gameState.previewTypes[i] = gameState.previewTypes[i + 1];
+    }
+    gameState.previewTypes[PREVIEW_COUNT - 1] = ((rand() * 5) % 7);
+    gameState.nextPieceType = gameState.previewTypes[0];
+    gameState.holdUsed = false;
+
+    // Show the next piece on the LED matrix
+    TetrisLEDs_ShowPattern(PIECES[gameState.nextPieceType]);
+
+    SpawnPiece(pieceType);
+}
+
+// Puts a piece at the top of the board in its spawn orientation.
+// Callers hold sem_GameState.
+static void SpawnPiece(int pieceType) {
     int i, j;
     gameState.currentPieceX = BOARD_WIDTH / 2 - PIECE_SIZE / 2;
     gameState.currentPieceY = 0;
-    
-    // Use the next piece as current piece if it exists, otherwise generate random
-    if (gameState.nextPieceType != 0xFF) {  // 0xFF is initialization value
-        gameState.currentPieceType = gameState.nextPieceType;
-    } else {
-        gameState.currentPieceType = ((rand() * 5) % 7);
-    }
-    
-    // Generate next piece
-    gameState.nextPieceType = ((rand() * 5) % 7);
-
-    // Set all LEDs in 4x4 grid to show next piece preview
-    G8RTOS_WaitSemaphore(&sem_I2CA);
-    PCA9556b_SetLED(4, 0xFF, PIECES[gameState.nextPieceType][0][0] ? 0xFF : 0x00);
-    PCA9556b_SetLED(8, 0xFF, PIECES[gameState.nextPieceType][0][1] ? 0xFF : 0x00);
-    PCA9556b_SetLED(12, 0xFF, PIECES[gameState.nextPieceType][0][2] ? 0xFF : 0x00);
-    PCA9556b_SetLED(16, 0xFF, PIECES[gameState.nextPieceType][0][3] ? 0xFF : 0x00);
-    PCA9556b_SetLED(5, 0xFF, PIECES[gameState.nextPieceType][1][0] ? 0xFF : 0x00);
-    PCA9556b_SetLED(9, 0xFF, PIECES[gameState.nextPieceType][1][1] ? 0xFF : 0x00);
-    PCA9556b_SetLED(13, 0xFF, PIECES[gameState.nextPieceType][1][2] ? 0xFF : 0x00);
-    PCA9556b_SetLED(17, 0xFF, PIECES[gameState.nextPieceType][1][3] ? 0xFF : 0x00);
-    PCA9556b_SetLED(6, 0xFF, PIECES[gameState.nextPieceType][2][0] ? 0xFF : 0x00);
-    PCA9556b_SetLED(10, 0xFF, PIECES[gameState.nextPieceType][2][1] ? 0xFF : 0x00);
-    PCA9556b_SetLED(14, 0xFF, PIECES[gameState.nextPieceType][2][2] ? 0xFF : 0x00);
-    PCA9556b_SetLED(18, 0xFF, PIECES[gameState.nextPieceType][2][3] ? 0xFF : 0x00);
-    PCA9556b_SetLED(7, 0xFF, PIECES[gameState.nextPieceType][3][0] ? 0xFF : 0x00);
-    PCA9556b_SetLED(11, 0xFF, PIECES[gameState.nextPieceType][3][1] ? 0xFF : 0x00);
-    PCA9556b_SetLED(15, 0xFF, PIECES[gameState.nextPieceType][3][2] ? 0xFF : 0x00);
-    PCA9556b_SetLED(19, 0xFF, PIECES[gameState.nextPieceType][3][3] ? 0xFF : 0x00);
-    G8RTOS_SignalSemaphore(&sem_I2CA);
+    gameState.currentPieceType = pieceType;
+    piecesSpawned++;
+    TetrisInput_NewPiece();
+    TetrisLevel_ResetGravity();
+
     // Copy piece data to currentPiece array
     for (i = 0; i < PIECE_SIZE; i++) {
         for (j = 0; j < PIECE_SIZE; j++) {
@@ -188,17 +372,95 @@ static void SpawnNewPiece(void) {
     
     // Check if piece can be placed at starting position
     if (!CanMovePiece(gameState.currentPieceX, gameState.currentPieceY)) {
-        G8RTOS_WaitSemaphore(&sem_GameState);
-        gameState.gameOver = true;
-        G8RTOS_SignalSemaphore(&sem_GameState);
+        EndGame();
+    }
+}
 
-        G8RTOS_WaitSemaphore(&sem_UART);
-        UARTprintf("Final score: %d\n", currentScore);
-        G8RTOS_SignalSemaphore(&sem_UART);
-        
-        // Force immediate display update to show game over screen
-        UpdateTetrisDisplay();
+// Ends the game, topped out or beaten by the versus opponent, and queues
+// the reports for the telemetry thread. Callers hold sem_GameState.
+static void EndGame(void) {
+    gameState.gameOver = true;
+    TetrisMusic_Stop();
+    TetrisSFX_Play(SFX_GAME_OVER);
+
+    // Only sent if this board lost, a win was heard from the peer
+    TetrisVersus_Lost(SystemTime);
+
+    // Printed without the game state, draining the UART takes a while
+    reportScore = currentScore;
+    reportPhase = TetrisVersus_GetPhase();
+    reportPending = true;
+
+    // Force immediate display update to show game over screen
+    UpdateTetrisDisplay();
+}
+
+// Swaps the current piece with the held one, once per spawned piece.
+// Callers hold sem_GameState.
+static void HoldPiece(void) {
+    int heldType = gameState.holdPieceType;
+
+    if (gameState.holdUsed) {
+        return;
+    }
+
+    gameState.holdPieceType = gameState.currentPieceType;
+    if (heldType == NO_PIECE) {
+        SpawnNewPiece();
+    } else {
+        SpawnPiece(heldType);
+    }
+    gameState.holdUsed = true;
+}
+
+// Drops the current piece straight to its landing row and locks it.
+// Callers hold sem_GameState.
+static void HardDrop(void) {
+    gameState.currentPieceY = LandingPieceY();
+    LockPiece();
+}
+
+// Rebuilds the column top cache from the whole board
+static void UpdateColumnTops(void) {
+    int i = 0;
+    int j = 0;
+
+    for (j = 0; j < BOARD_WIDTH; j++) {
+        for (i = 0; i < BOARD_HEIGHT && gameState.board[i][j] == CELL_EMPTY; i++);
+        columnTop[j] = i;
+    }
+}
+
+// Row the current piece would land on if dropped, from the column tops
+// under each of its columns. O(piece width) unless the piece is tucked
+// under an overhang.
+static int LandingPieceY(void) {
+    int i = 0;
+    int j = 0;
+    int bottom = 0;
+    int landing = BOARD_HEIGHT;
+
+    for (j = 0; j < PIECE_SIZE; j++) {
+        bottom = -1;
+        for (i = 0; i < PIECE_SIZE; i++) {
+            if (currentPiece[i][j]) {
+                bottom = i;
+            }
+        }
+        if (bottom >= 0 && columnTop[gameState.currentPieceX + j] - 1 - bottom < landing) {
+            landing = columnTop[gameState.currentPieceX + j] - 1 - bottom;
+        }
+    }
+
+    // Tucked under an overhang, the column tops are above the piece
+    if (landing < gameState.currentPieceY) {
+        landing = gameState.currentPieceY;
+        while (CanMovePiece(gameState.currentPieceX, landing + 1)) {
+            landing++;
+        }
     }
+
+    return landing;
 }
 
 static bool CanMovePiece(int newX, int newY) {
@@ -247,27 +509,47 @@ static bool CanMovePiece(int newX, int newY) {
     return true;
 }
 
-static void MovePiece(int deltaX, int deltaY) {
+// Locking is left to the game thread so a grounded piece gets its lock delay.
+static bool MovePiece(int deltaX, int deltaY) {
     int newX = gameState.currentPieceX + deltaX;
     int newY = gameState.currentPieceY + deltaY;
     
     if (CanMovePiece(newX, newY)) {
         gameState.currentPieceX = newX;
         gameState.currentPieceY = newY;
+        return true;
     }
-    else if ((newY + 1) > 0) {
-            if (CanMovePiece(newX, newY + 1)) {
-                gameState.currentPieceX = newX;
-                gameState.currentPieceY = newY + 1;
-            }
+    // Sideways moves may slip one row down under an overhang
+    else if ((deltaY == 0) && CanMovePiece(newX, newY + 1)) {
+        gameState.currentPieceX = newX;
+        gameState.currentPieceY = newY + 1;
+        return true;
+    }
+    return false;
+}
+
+static void LockPiece(void) {
+    uint8_t lines = 0;
+    uint8_t hole = 0;
+
+    // Place the current piece on the board
+    PlacePieceOnBoard();
+    TetrisSFX_Play(SFX_LOCK);
+    lines = CheckAndClearLines();
+
+    // Clears attack the versus opponent, otherwise its garbage comes up
+    if (lines > 0) {
+        TetrisVersus_LinesCleared(lines, SystemTime);
+    } else {
+        lines = TetrisVersus_TakeGarbage(&hole);
+        if (lines > 0 && !InsertGarbage(lines, hole)) {
+            EndGame();
+            return;
         }
-    if ((deltaY > 0) && (!(CanMovePiece(newX, newY)) && !(CanMovePiece(newX, newY + 1)))) {  // If we tried to move down but couldn't
-        // Place the current piece on the board
-        PlacePieceOnBoard();
-        CheckAndClearLines();
-        // Spawn a new piece
-        SpawnNewPiece();
     }
+
+    // Spawn a new piece
+    SpawnNewPiece();
 }
 
 static void UpdateTetrisDisplay(void) {
@@ -308,6 +590,7 @@ static void UpdateTetrisDisplay(void) {
         ST7789_DrawRectangle(222, 0, 1, Y_MAX, ST7789_WHITE);
         ST7789_DrawRectangle(239, 0, 1, Y_MAX, ST7789_WHITE);
         G8RTOS_SignalSemaphore(&sem_SPIA);
+        InvalidatePanels();
         unpaused = false;
     }
     
@@ -321,6 +604,7 @@ static void UpdateTetrisDisplay(void) {
     int y = 0;
     int i = 0;
     int j = 0;
+    int ghostY = LandingPieceY();
     
     // Create a temporary board for display
     uint8_t displayBoard[BOARD_HEIGHT][BOARD_WIDTH];
@@ -332,6 +616,15 @@ static void UpdateTetrisDisplay(void) {
         }
     }
     
+    // Add the ghost piece where a hard drop would land
+    for (i = 0; i < PIECE_SIZE; i++) {
+        for (j = 0; j < PIECE_SIZE; j++) {
+            if (currentPiece[i][j] && ghostY + i >= 0 && ghostY + i < BOARD_HEIGHT) {
+                displayBoard[ghostY + i][gameState.currentPieceX + j] = CELL_GHOST;
+            }
+        }
+    }
+
     // Add the current moving piece to the display board
     for (i = 0; i < PIECE_SIZE; i++) {
         for (j = 0; j < PIECE_SIZE; j++) {
@@ -346,18 +639,6 @@ static void UpdateTetrisDisplay(void) {
         }
     }
     
-    // Array to map cell values to colors
-    const uint16_t cellColors[] = {
-        COLOR_EMPTY,  // 0
-        COLOR_I,      // 1
-        COLOR_O,      // 2
-        COLOR_T,      // 3
-        COLOR_S,      // 4
-        COLOR_Z,      // 5
-        COLOR_J,      // 6
-        COLOR_L       // 7
-    };
-    
     // Draw the combined board (placed pieces + current moving piece)
     for (y = 0; y < BOARD_HEIGHT; y++) {
         for (x = 0; x < BOARD_WIDTH; x++) {
@@ -368,6 +649,102 @@ static void UpdateTetrisDisplay(void) {
                                cellWidth - 1, cellHeight - 1, color);
         }
     }
+
+    DrawPanels();
+    DrawPeerBoard();
+}
+
+// Forces the hold and preview panels to be fully redrawn
+static void InvalidatePanels(void) {
+    int s = 0;
+    int i = 0;
+    int j = 0;
+
+    for (s = 0; s <= PREVIEW_COUNT; s++) {
+        for (i = 0; i < PANEL_ROWS; i++) {
+            for (j = 0; j < PIECE_SIZE; j++) {
+                panelShadow[s][i][j] = PANEL_INVALID;
+            }
+        }
+    }
+    for (i = 0; i < BOARD_HEIGHT; i++) {
+        for (j = 0; j < BOARD_WIDTH; j++) {
+            peerShadow[i][j] = PANEL_INVALID;
+        }
+    }
+    panelsDrawn = false;
+    peerDrawn = false;
+}
+
+// Draws the rows of a piece that are filled in spawn orientation,
+// skipping cells that already show the right color.
+static void DrawPanelPiece(int slot, uint16_t x, uint16_t y, int pieceType) {
+    int i = 0;
+    int j = 0;
+    uint16_t color = 0;
+
+    if (!panelsDrawn) {
+        ST7789_DrawRectangle(x, y, PIECE_SIZE * PANEL_CELL + 1, PANEL_ROWS * PANEL_CELL + 1, COLOR_EMPTY);
+    }
+
+    for (i = 0; i < PANEL_ROWS; i++) {
+        for (j = 0; j < PIECE_SIZE; j++) {
+            color = COLOR_EMPTY;
+            if (pieceType != NO_PIECE && PIECES[pieceType][PANEL_FIRST_ROW + i][j]) {
+                color = cellColors[pieceType + 1];
+            }
+            if (panelShadow[slot][i][j] != color) {
+                // Display y grows upwards, piece rows grow downwards
+                ST7789_DrawRectangle(x + 1 + (j * PANEL_CELL), y + 1 + ((PANEL_ROWS - 1 - i) * PANEL_CELL),
+                                     PANEL_CELL - 1, PANEL_CELL - 1, color);
+                panelShadow[slot][i][j] = color;
+            }
+        }
+    }
+}
+
+// Hold piece on the left column, upcoming pieces on the right column
+static void DrawPanels(void) {
+    int i = 0;
+
+    DrawPanelPiece(0, PANEL_LEFT_X, PANEL_SLOT_Y(0), gameState.holdPieceType);
+    for (i = 0; i < PREVIEW_COUNT; i++) {
+        DrawPanelPiece(i + 1, PANEL_RIGHT_X, PANEL_SLOT_Y(i),
+                       (gameState.nextPieceType == NO_PIECE) ? NO_PIECE : gameState.previewTypes[i]);
+    }
+    panelsDrawn = true;
+}
+
+// Versus opponent's board on the left column below the hold panel, its
+// falling piece where it is predicted to be by now. Like the panels, only
+// cells that change are drawn.
+static void DrawPeerBoard(void) {
+    static uint8_t board[BOARD_HEIGHT][BOARD_WIDTH];
+    uint16_t color = 0;
+    int i = 0;
+    int j = 0;
+
+    if (TetrisVersus_GetPhase() == VERSUS_IDLE || !TetrisVersus_PeerBoard(SystemTime, board)) {
+        return;
+    }
+
+    if (!peerDrawn) {
+        ST7789_DrawRectangle(PEER_X - 1, PEER_Y - 1, BOARD_WIDTH * PEER_CELL + 1, BOARD_HEIGHT * PEER_CELL + 1,
+                             COLOR_EMPTY);
+        peerDrawn = true;
+    }
+
+    for (i = 0; i < BOARD_HEIGHT; i++) {
+        for (j = 0; j < BOARD_WIDTH; j++) {
+            color = cellColors[(board[i][j] <= CELL_GARBAGE) ? board[i][j] : CELL_EMPTY];
+            if (peerShadow[i][j] != color) {
+                // Display y grows upwards, board rows grow downwards
+                ST7789_DrawRectangle(PEER_X + (j * PEER_CELL), PEER_Y + ((BOARD_HEIGHT - 1 - i) * PEER_CELL),
+                                     PEER_CELL - 1, PEER_CELL - 1, color);
+                peerShadow[i][j] = color;
+            }
+        }
+    }
 }
 
 static void PlacePieceOnBoard(void) {
@@ -379,6 +756,9 @@ static void PlacePieceOnBoard(void) {
             if (currentPiece[i][j]) {
                 gameState.board[gameState.currentPieceY + i][gameState.currentPieceX + j] = 
                     gameState.currentPieceType + 1;  // +1 because 0 is empty
+                if (gameState.currentPieceY + i < columnTop[gameState.currentPieceX + j]) {
+                    columnTop[gameState.currentPieceX + j] = gameState.currentPieceY + i;
+                }
             }
         }
     }
@@ -386,8 +766,11 @@ static void PlacePieceOnBoard(void) {
 
 static void DrawGameOverScreen(void) {
     if (!gameOverScreenDrawn) {  // Only draw if we haven't already
-        PCA9956b_SetAllOff();
-        ST7789_DrawRectangle(0, 0, X_MAX, Y_MAX, ST7789_RED);
+        TetrisLEDs_Off();
+
+        // Green when the versus opponent topped out first
+        ST7789_DrawRectangle(0, 0, X_MAX, Y_MAX,
+                             (TetrisVersus_GetPhase() == VERSUS_WON) ? ST7789_GREEN : ST7789_RED);
 
         //Letter G
         int G_base_x = 30;
@@ -463,7 +846,7 @@ static void DrawGameOverScreen(void) {
     }
 }
 
-static void RotatePiece(bool clockwise) {
+static bool RotatePiece(bool clockwise) {
     int i = 0;
     int j = 0;
     uint8_t rotatedPiece[PIECE_SIZE][PIECE_SIZE] = {0};
@@ -502,12 +885,18 @@ static void RotatePiece(bool clockwise) {
                 currentPiece[i][j] = tempPiece[i][j];
             }
         }
+        return false;
     }
+
+    TetrisSFX_Play(SFX_ROTATE);
+    return true;
 }
 
-static void CheckAndClearLines(void) {
+// Clears full lines and scores them. Returns the number cleared.
+static int CheckAndClearLines(void) {
     int i, j, k;
     int linesCleared = 0;
+    uint8_t level = 0;
     bool isLineFull;
     
     // Check each line from bottom to top
@@ -542,36 +931,79 @@ static void CheckAndClearLines(void) {
             i++;
         }
     }
+
+    // Cleared rows are full, so they all lie at or below every column top.
+    // Each top moves down by linesCleared, or further if it was itself cleared.
+    if (linesCleared > 0) {
+        for (j = 0; j < BOARD_WIDTH; j++) {
+            for (i = columnTop[j]; i < BOARD_HEIGHT && gameState.board[i][j] == CELL_EMPTY; i++);
+            columnTop[j] = i;
+        }
+    }
     
-    // Update score based on number of lines cleared
-    switch (linesCleared) {
-        case 1:
-            currentScore += 40;
-            G8RTOS_WaitSemaphore(&sem_UART);
-            UARTprintf("Current score: %d\n", currentScore);
-            G8RTOS_SignalSemaphore(&sem_UART);
-            break;
-        case 2:
-            currentScore += 100;
-            G8RTOS_WaitSemaphore(&sem_UART);
-            UARTprintf("Current score: %d\n", currentScore);
-            G8RTOS_SignalSemaphore(&sem_UART);
-            break;
-        case 3:
-            currentScore += 300;
-            G8RTOS_WaitSemaphore(&sem_UART);
-            UARTprintf("Current score: %d\n", currentScore);
-            G8RTOS_SignalSemaphore(&sem_UART);
-            break;
-        case 4:
-            currentScore += 1200;
-            G8RTOS_WaitSemaphore(&sem_UART);
-            UARTprintf("Current score: %d\n", currentScore);
-            G8RTOS_SignalSemaphore(&sem_UART);
-            break;
-        default:
-            break;
+    // Update score, multiplied by the level the lines were cleared on
+    if (linesCleared > 0) {
+        level = TetrisLevel_GetLevel();
+        currentScore += TetrisLevel_AddLines(linesCleared);
+
+        if (TetrisLevel_GetLevel() != level) {
+            TetrisLEDs_LevelUp();
+            TetrisMusic_SetLevel(TetrisLevel_GetLevel());
+        } else {
+            TetrisLEDs_LineClear(linesCleared);
+        }
+
+        // Posts only, the clip starts with the next audio block
+        if (linesCleared >= 4) {
+            TetrisSFX_Play(SFX_TETRIS);
+        } else if (TetrisLevel_GetLevel() != level) {
+            TetrisSFX_Play(SFX_LEVEL);
+        } else {
+            TetrisSFX_Play(SFX_LINE);
+        }
+
+        G8RTOS_WaitSemaphore(&sem_UART);
+        UARTprintf("Current score: %d\n", currentScore);
+        if (TetrisLevel_GetLevel() != level) {
+            UARTprintf("Level %d\n", TetrisLevel_GetLevel());
+        }
+        G8RTOS_SignalSemaphore(&sem_UART);
+    }
+
+    return linesCleared;
+}
+
+// Raises garbage rows from the versus opponent under the stack, each open
+// in one column. Returns false if the stack was pushed out of the top.
+// Callers hold sem_GameState.
+static bool InsertGarbage(uint8_t lines, uint8_t hole) {
+    bool toppedOut = false;
+    int i = 0;
+    int j = 0;
+
+    if (lines > BOARD_HEIGHT) {
+        lines = BOARD_HEIGHT;
+    }
+
+    for (i = 0; i < lines; i++) {
+        for (j = 0; j < BOARD_WIDTH; j++) {
+            toppedOut |= (gameState.board[i][j] != CELL_EMPTY);
+        }
     }
+
+    for (i = 0; i < BOARD_HEIGHT - lines; i++) {
+        for (j = 0; j < BOARD_WIDTH; j++) {
+            gameState.board[i][j] = gameState.board[i + lines][j];
+        }
+    }
+    for (i = BOARD_HEIGHT - lines; i < BOARD_HEIGHT; i++) {
+        for (j = 0; j < BOARD_WIDTH; j++) {
+            gameState.board[i][j] = (j == hole) ? CELL_EMPTY : CELL_GARBAGE;
+        }
+    }
+
+    UpdateColumnTops();
+    return !toppedOut;
 }
 
 static void DrawPauseScreen(void) {
@@ -675,179 +1107,1004 @@ static void DrawStartScreen(void) {
     }
 }
 
-/********************************Public Functions***********************************/
-
-/*************************************Threads***************************************/
-
-void Idle_Thread(void) {
-    while(1);
-}
+// Prints the reports queued by EndGame. The reports together outgrow the
+// console's transmit ring, so each waits for the last to drain. This runs
+// without sem_GameState, so the other threads keep going meanwhile.
+static void PrintGameReport(void) {
+    telemetryStats_t telemetry;
+    versusPhase_t phase;
+    uint32_t score = 0;
+    bool pending = false;
 
-void Read_Buttons(void) {
+    G8RTOS_WaitSemaphore(&sem_GameState);
+    pending = reportPending;
+    score = reportScore;
+    phase = reportPhase;
+    reportPending = false;
+    G8RTOS_SignalSemaphore(&sem_GameState);
 
-    // Initialize / declare any variables here
-    uint8_t buttons;
+    if (!pending) {
+        return;
+    }
 
-    while(1) {
-        // wait for button semaphore
-        G8RTOS_WaitSemaphore(&sem_PCA9555_Debounce);
-        // debounce buttons
-        sleep(15);
-        // Get buttons
-        buttons = ~MultimodButtons_Get();
-        // clear button interrupt
-        GPIOIntClear(BUTTONS_INT_GPIO_BASE, BUTTONS_INT_PIN);
-        // update current_buttons value
-        G8RTOS_WriteFIFO(BUTTONS_FIFO, buttons);
+    G8RTOS_WaitSemaphore(&sem_UART);
+    UARTprintf("Final score: %d\n", score);
+    if (phase == VERSUS_WON || phase == VERSUS_LOST) {
+        UARTprintf("Versus: %s\n", (phase == VERSUS_WON) ? "won" : "lost");
     }
+    PrintBusReport();
+    UARTFlushTx(false);
+    PrintInputReport();
+    UARTFlushTx(false);
+    PrintAudioReport();
+    TetrisTelemetry_GetStats(&telemetry);
+    UARTprintf("UART: %d bytes dropped, telemetry %d frames, %d bytes, %d dropped, %d inputs lost\n",
+               UART_GetDropped(), telemetry.frames, telemetry.bytes, telemetry.dropped, telemetry.inputsLost);
+    G8RTOS_SignalSemaphore(&sem_UART);
 }
 
-void Tetris_Game_Thread(void) {
-    while (1) {
-        // Don't start game logic until game has started
-        if (!gameStarted) {
-            sleep(100);
-            continue;
-        }
-        
-        // Exit game loop if game is over
-        if (gameState.gameOver) {
-            sleep(1000);
-            continue;
-        }
-        
-        if (!gameState.pauseGame) {
-            G8RTOS_WaitSemaphore(&sem_GameState);
-            
-            // Move piece down
-            MovePiece(0, 1);
-            G8RTOS_SignalSemaphore(&sem_GameState);
+// Prints I2C traffic, throughput, share of bus time and queue wait of
+// each device. Callers hold sem_UART.
+static void PrintBusReport(void) {
+    const uint32_t modules[I2C_BUS_COUNT] = {I2C_A_BASE, I2C_B_BASE};
+    const char moduleNames[I2C_BUS_COUNT] = {'A', 'B'};
+    i2cDeviceStats_t stats;
+    uint16_t occupancy = 0;
+    uint8_t m = 0;
+    uint8_t i = 0;
+
+    for (m = 0; m < I2C_BUS_COUNT; m++) {
+        UARTprintf("I2C_%c %d kHz\n", moduleNames[m], I2C_GetSpeed(modules[m]) / 1000);
+        for (i = 0; I2C_GetDeviceStats(modules[m], i, &stats); i++) {
+            if (stats.transactions == 0) {
+                continue;
+            }
+            occupancy = I2C_GetOccupancy(&stats);
+            UARTprintf("  %s 0x%02x: %d kHz, %d xfers, %d errors, %d bytes, %d B/s\n",
+                       stats.name, stats.addr, (stats.speed ? stats.speed : I2C_GetSpeed(modules[m])) / 1000,
+                       stats.transactions, stats.errors, stats.bytes, I2C_GetThroughput(&stats));
+            UARTprintf("    busy %d.%d%%, wait avg %d us, max %d us\n",
+                       occupancy / 10, occupancy % 10, I2C_GetAverageWait(&stats), stats.maxWaitUS);
         }
-        
-        // Sleep for different durations based on fastDrop state
-        sleep(fastDrop ? dropSpeed / 4 : dropSpeed);
     }
 }
 
-// Uncomment and update the button thread
-void Tetris_Button_Thread(void) {
-    uint8_t buttons;
-    
-    while (1) {
-        buttons = G8RTOS_ReadFIFO(BUTTONS_FIFO);
-        
-        // Check for game start
-        if (!gameStarted) {
-            if (buttons & SW4) {
-                gameStarted = true;
-                InitializeBoard();
-                SpawnNewPiece();
-            }
-            GPIOIntEnable(BUTTONS_INT_GPIO_BASE, BUTTONS_INT_PIN);
-            sleep(100);
-            continue;
+// Prints the input latency histograms. Callers hold sem_UART.
+static void PrintInputReport(void) {
+    const char* sourceNames[INPUT_SOURCES] = {"Joystick", "Buttons", "Motion", "Mic"};
+    uint32_t histogram[INPUT_LATENCY_BUCKETS];
+    uint8_t source = 0;
+    uint8_t i = 0;
+
+    for (source = 0; source < INPUT_SOURCES; source++) {
+        TetrisInput_GetLatency(source, histogram);
+        UARTprintf("%s latency:", sourceNames[source]);
+        for (i = 0; i < INPUT_LATENCY_BUCKETS - 1; i++) {
+            UARTprintf(" <%dms %d", 1 << i, histogram[i]);
         }
-        
-        // Only process rotation buttons if game is not over and not paused
-        if (!gameState.gameOver) {
-            G8RTOS_WaitSemaphore(&sem_GameState);
-            
-            if (!gameState.pauseGame) {
-                // SW1: Rotate counterclockwise
-                if (buttons & SW1) {
-                    RotatePiece(false);
-                }
-                // SW2: Rotate clockwise
-                if (buttons & SW2) {
-                    RotatePiece(true);
-                }
-            }
-            
-            // SW3: Toggle pause
-            if (buttons & SW3) {
-                gameState.pauseGame = !gameState.pauseGame;
-                // Clear pause screen flag when unpausing
-                if (!gameState.pauseGame) {
-                    pauseScreenDrawn = false;
-                    unpaused = true;
-                }
-            }
-            
-            G8RTOS_SignalSemaphore(&sem_GameState);
-        }
-        GPIOIntEnable(BUTTONS_INT_GPIO_BASE, BUTTONS_INT_PIN);
-        sleep(100);
+        UARTprintf(" more %d\n", histogram[INPUT_LATENCY_BUCKETS - 1]);
     }
 }
 
-void Tetris_Joystick_Thread(void) {
-    // define variables
-    uint32_t joystick_xy_val = 0;
-    uint16_t joystick_x_val = 0;
-    uint16_t joystick_y_val = 0;
-    uint16_t deadzone_lower = 2048 - 512;
-    uint16_t deadzone_upper = 2048 + 512;
+// Prints the audio refill load, the effect mixer's voice use and ADPCM
+// decode cost, and the mic capture and detectors. Callers hold sem_UART.
+static void PrintAudioReport(void) {
+    audioStreamStats_t stream;
+    audioCaptureStats_t capture;
+    micLevel_t mic;
+    sfxStats_t sfx;
+    uint32_t refillUS = 0;
+    uint32_t cycles = 0;
+
+    AudioStream_GetStats(&stream);
+    TetrisSFX_GetStats(&sfx);
+
+    refillUS = stream.blocks ? (stream.refillUS * 10) / stream.blocks : 0;
+    UARTprintf("Audio: %d blocks, %d underruns, refill avg %d.%d us\n",
+               stream.blocks, stream.underruns, refillUS / 10, refillUS % 10);
+
+    // Whole cycles and tenths apart, the cycle total is too large to scale
+    cycles = sfx.decoded ? sfx.decodeCycles / sfx.decoded : 0;
+    UARTprintf("  effects %d, stolen %d, dropped %d, ADPCM %d samples at %d.%d cycles/sample\n",
+               sfx.triggers, sfx.steals, sfx.drops, sfx.decoded, cycles,
+               sfx.decoded ? ((sfx.decodeCycles % sfx.decoded) * 10) / sfx.decoded : 0);
+
+    AudioCapture_GetStats(&capture);
+    TetrisMic_GetLevel(&mic);
+    UARTprintf("Mic: %d blocks, %d overruns, process avg %d us, room %d, claps %d\n",
+               capture.blocks, capture.overruns, capture.blocks ? capture.processUS / capture.blocks : 0,
+               mic.background, mic.claps);
+}
 
-    while(1) 
-    {
-        if (gameState.gameOver) {
-            sleep(1000);  // Sleep to prevent busy waiting
-            continue;
-        }
+// Queues an input event. Events come from interrupts and the autoplayer,
+// so the FIFO write is kept atomic.
+static void QueueInput(uint32_t event) {
+    int32_t state = StartCriticalSection();
 
-        if (!gameState.pauseGame) {
-            // read joystick values
-            joystick_xy_val = G8RTOS_ReadFIFO(JOYSTICK_FIFO);
-            joystick_x_val = (joystick_xy_val >> 16 & 0xFFFF);
-            joystick_y_val = (joystick_xy_val >> 0 & 0xFFFF);
-            // normalize the joystick values
-            float normalized_x = 0.0f;
-            float normalized_y = 0.0f;
-            if (joystick_x_val < deadzone_lower || joystick_x_val > deadzone_upper) {
-                normalized_x = (float)(joystick_x_val - 2048.0f) / 2048.0f;
-            }
-            if (joystick_y_val < deadzone_lower || joystick_y_val > deadzone_upper) {
-                normalized_y = (float)(joystick_y_val - 2048.0f) / 2048.0f;
-            }
-            // update piece position based on normalized_x
-            G8RTOS_WaitSemaphore(&sem_GameState);
-            if (normalized_x > 0) {
-                MovePiece(-1, 0);
-            }
-            else if (normalized_x < 0) {
-                MovePiece(1, 0);
-            }
-            
-            // Update fast drop state based on joystick position
-            fastDrop = (normalized_y < 0);
-            
-            G8RTOS_SignalSemaphore(&sem_GameState);
-        }
-        sleep(50);  // Add a small delay to prevent too rapid movement
-    }
+    G8RTOS_WriteFIFO(INPUT_FIFO, event);
+    EndCriticalSection(state);
 }
 
-/********************************Periodic Threads***********************************/
+// Starts a read of the button port unless one is already on the bus,
+// in which case Read_Input retries.
+static void RequestButtons(void) {
+    int32_t state = StartCriticalSection();
 
-void Read_Joystick(void) {
-    if (!(gameState.pauseGame)) {
-        // read joystick values
-        uint32_t joystick_xy_val = JOYSTICK_GetXY();
-        // push joystick value to fifo
-        G8RTOS_WriteFIFO(JOYSTICK_FIFO, joystick_xy_val);
+    if (!MultimodButtons_GetAsync(&buttonPort, ButtonsRead)) {
+        buttonReread = true;
     }
+    EndCriticalSection(state);
 }
 
-void Tetris_Display_Thread(void) {
-    G8RTOS_WaitSemaphore(&sem_GameState);
-    UpdateTetrisDisplay();
+// Hands a finished button port read to the debouncer. Runs in the I2C
+// interrupt. Buttons pull their port bits low.
+static void ButtonsRead(i2cTransaction_t* transaction) {
+    if (transaction->status == I2C_DONE) {
+        TetrisInput_ButtonSample(~buttonPort);
+    } else {
+        buttonReread = true;
+    }
+}
+
+// Fills an audio block from silence, effects layered over the music. Runs
+// in the DMA completion interrupt.
+static void AudioRefill(int16_t* samples, uint16_t count) {
+    memset(samples, 0, count * sizeof(int16_t));
+    TetrisMusic_Render(samples, count);
+    TetrisSFX_Mix(samples, count);
+}
+
+// Measures a block of mic samples and queues clap and whistle events. Runs
+// in the capture interrupt.
+static void MicCapture(const uint16_t* samples, uint16_t count) {
+    uint32_t events[INPUT_MAX_EVENTS];
+    uint8_t n = TetrisMic_Update(samples, count, SystemTime, events);
+    uint8_t i = 0;
+
+    // The mic only steers a game the player is playing
+    if (gameStarted && !autoplay && !gameState.pauseGame) {
+        for (i = 0; i < n; i++) {
+            QueueInput(events[i]);
+        }
+    }
+}
+
+// Applies a joystick event: shifts, fast drop and the hard drop flick.
+static void HandleStickEvent(uint32_t event) {
+    uint8_t kind = INPUT_EVENT_KIND(event);
+    uint8_t code = INPUT_EVENT_CODE(event);
+    uint8_t cells = 0;
+
+    G8RTOS_WaitSemaphore(&sem_GameState);
+    if (!gameStarted || gameState.gameOver || gameState.pauseGame) {
+        fastDrop = false;
+        G8RTOS_SignalSemaphore(&sem_GameState);
+        return;
+    }
+
+    switch (code) {
+        case INPUT_LEFT:
+        case INPUT_RIGHT:
+            // Press and repeats shift, DAS/ARR timing is in the classifier
+            heldShift = (kind == INPUT_RELEASE) ? 0 : ((code == INPUT_LEFT) ? -1 : 1);
+            if (kind == INPUT_RELEASE) {
+                break;
+            }
+            for (cells = INPUT_EVENT_COUNT(event); cells > 0; cells--) {
+                if (!MovePiece((code == INPUT_LEFT) ? -1 : 1, 0)) {
+                    break;
+                }
+                TetrisInput_LockReset(SystemTime);
+            }
+            break;
+        case INPUT_DOWN:
+            fastDrop = (kind != INPUT_RELEASE);
+            break;
+        case INPUT_UP:
+            // Flicking up hard drops, once per flick
+            if (kind == INPUT_PRESS) {
+                HardDrop();
+            }
+            break;
+        default:
+            break;
+    }
+
+    G8RTOS_SignalSemaphore(&sem_GameState);
+}
+
+// Applies a button event. Only presses act.
+static void HandleButtonEvent(uint32_t event) {
+    uint8_t button = INPUT_EVENT_CODE(event);
+
+    if (INPUT_EVENT_KIND(event) != INPUT_PRESS) {
+        return;
+    }
+
+    // Check for game start
+    if (!gameStarted) {
+        // SW4: play, SW1: let the autoplayer play
+        if (button == INPUT_SW4 || button == INPUT_SW1) {
+            G8RTOS_WaitSemaphore(&sem_GameState);
+            // The console or the link may have started one since the check
+            if (!gameStarted) {
+                autoplay = (button == INPUT_SW1);
+                gameStarted = true;
+                InitializeBoard();
+                SpawnNewPiece();
+            }
+            G8RTOS_SignalSemaphore(&sem_GameState);
+        }
+        return;
+    }
+
+    // Only process rotation/hold buttons if game is not over and not paused
+    if (gameState.gameOver) {
+        return;
+    }
+
+    G8RTOS_WaitSemaphore(&sem_GameState);
+
+    if (!gameState.pauseGame) {
+        // SW1: Rotate counterclockwise
+        if (button == INPUT_SW1 && RotatePiece(false)) {
+            TetrisInput_LockReset(SystemTime);
+        }
+        // SW2: Rotate clockwise
+        if (button == INPUT_SW2 && RotatePiece(true)) {
+            TetrisInput_LockReset(SystemTime);
+        }
+        // SW4: Hold piece
+        if (button == INPUT_SW4) {
+            HoldPiece();
+        }
+    }
+
+    // SW3: Toggle pause
+    if (button == INPUT_SW3) {
+        SetPaused(!gameState.pauseGame);
+    }
+
+    G8RTOS_SignalSemaphore(&sem_GameState);
+}
+
+// Starts a new game in one hold of the game state semaphore, so the game
+// thread never steps an empty board. A seed deals that game's pieces, 0
+// keeps a pending one or draws a new one. With no game started yet, a
+// player game is started.
+static void RestartGame(const uint32_t* seed) {
+    G8RTOS_WaitSemaphore(&sem_GameState);
+    if (seed) {
+        gameSeed = *seed;
+        seedPending = true;
+    }
+    if (!gameStarted) {
+        autoplay = false;
+        gameStarted = true;
+    }
+    currentScore = 0;
+    InitializeBoard();
+    gameState.gameOver = false;
+    gameState.pauseGame = false;
+    SpawnNewPiece();
+    G8RTOS_SignalSemaphore(&sem_GameState);
+}
+
+// Pauses or resumes the game, with the game state semaphore held.
+static void SetPaused(bool pause) {
+    if (pause == gameState.pauseGame) {
+        return;
+    }
+
+    gameState.pauseGame = pause;
+    TetrisMusic_Pause(pause);
+
+    // Clear pause screen flag when unpausing
+    if (!pause) {
+        pauseScreenDrawn = false;
+        unpaused = true;
+    }
+}
+
+// Folds a few raw joystick readings into a link session number. The low
+// bits of each reading are noise. Only before JOYSTICK_StartSampling.
+static uint8_t LinkSession(void) {
+    uint32_t noise = 0;
+    uint8_t i = 0;
+
+    for (i = 0; i < 8; i++) {
+        noise = (noise * 31) + JOYSTICK_GetXY();
+    }
+    return (uint8_t)(noise ^ (noise >> 8) ^ (noise >> 16) ^ (noise >> 24));
+}
+
+/********************************Public Functions***********************************/
+
+/*********************************Console Commands**********************************/
+
+// Prints console output between other writers of the console.
+static void ConsolePrint(const char* format, ...) {
+    va_list args;
+
+    va_start(args, format);
+    G8RTOS_WaitSemaphore(&sem_UART);
+    UARTvprintf(format, args);
+    G8RTOS_SignalSemaphore(&sem_UART);
+    va_end(args);
+}
+
+// level [1-20]: moves the game to a level, the row time follows.
+static bool ConsoleLevel(uint8_t argc, char** argv) {
+    uint32_t level = 0;
+
+    if (argc > 1) {
+        if (!TetrisConsole_ParseNumber(argv[1], &level) || level < 1 || level > LEVEL_MAX) {
+            return false;
+        }
+        G8RTOS_WaitSemaphore(&sem_GameState);
+        TetrisLevel_SetLevel((uint8_t)level);
+        TetrisMusic_SetLevel((uint8_t)level);
+        G8RTOS_SignalSemaphore(&sem_GameState);
+    }
+
+    ConsolePrint("level %d, %d us per row\n", TetrisLevel_GetLevel(), TetrisLevel_GetRowTimeUS(false));
+    return true;
+}
+
+// prio id priority: lower numbers run first, Idle is 255.
+static bool ConsolePriority(uint8_t argc, char** argv) {
+    uint32_t id = 0;
+    uint32_t priority = 0;
+
+    if (argc != 3 || !TetrisConsole_ParseNumber(argv[1], &id) ||
+        !TetrisConsole_ParseNumber(argv[2], &priority) || priority > UINT8_MAX) {
+        return false;
+    }
+
+    if (G8RTOS_SetPriority((threadID_t)id, (uint8_t)priority) != NO_ERROR) {
+        ConsolePrint("no thread %d\n", id);
+    } else {
+        ConsolePrint("thread %d priority %d\n", id, priority);
+    }
+    return true;
+}
+
+// threads: share of the time since the last dump each thread ran.
+static bool ConsoleThreads(uint8_t argc, char** argv) {
+    static uint32_t lastRunUS[MAX_THREADS];
+    static uint32_t lastDumpUS = 0;
+    threadStats_t threads[MAX_THREADS];
+    uint32_t nowUS = G8RTOS_GetTimeUS();
+    uint32_t spanUS = nowUS - lastDumpUS;
+    uint32_t permille = 0;
+    uint32_t count = G8RTOS_GetThreadStats(threads, MAX_THREADS);
+    uint32_t i = 0;
+
+    ConsolePrint("id prio state     load  switches name\n");
+    for (i = 0; i < count; i++) {
+        permille = spanUS ? (uint32_t)(((uint64_t)(threads[i].runTimeUS - lastRunUS[i]) * 1000) / spanUS) : 0;
+        ConsolePrint("%2d %4d %s %3d.%d%% %9d %s\n", threads[i].id, threads[i].priority,
+                     threads[i].blocked ? "blocked" : (threads[i].asleep ? "asleep " : "ready  "),
+                     permille / 10, permille % 10, threads[i].switches, threads[i].name);
+        lastRunUS[i] = threads[i].runTimeUS;
+    }
+    lastDumpUS = nowUS;
+
+    return true;
+}
+
+// fifo: the input FIFO, the telemetry input queue and the console rings.
+static bool ConsoleFIFOs(uint8_t argc, char** argv) {
+    fifoStats_t input;
+    telemetryStats_t telemetry;
+    consoleStats_t console;
+
+    G8RTOS_GetFIFOStats(INPUT_FIFO, &input);
+    TetrisTelemetry_GetStats(&telemetry);
+    TetrisConsole_GetStats(&console);
+
+    ConsolePrint("input fifo: %d waiting, %d peak of %d, %d lost\n",
+                 (input.count > 0) ? input.count : 0, input.peak, FIFO_SIZE, input.lost);
+    ConsolePrint("telemetry: %d frames, %d dropped, %d inputs lost\n",
+                 telemetry.frames, telemetry.dropped, telemetry.inputsLost);
+    ConsolePrint("uart: %d bytes dropped, %d received waiting\n", UART_GetDropped(), UARTRxBytesAvail());
+    ConsolePrint("console: %d lines, %d errors, %d too long\n", console.lines, console.errors, console.overflows);
+
+    return true;
+}
+
+// baud [rate]: the reply goes out at the old rate, then the host follows.
+static bool ConsoleBaud(uint8_t argc, char** argv) {
+    uint32_t baud = 0;
+    bool changed = false;
+
+    if (argc < 2) {
+        ConsolePrint("baud %d\n", UART_GetBaud());
+        return true;
+    }
+    if (!TetrisConsole_ParseNumber(argv[1], &baud)) {
+        return false;
+    }
+
+    G8RTOS_WaitSemaphore(&sem_UART);
+    UARTprintf("baud %d\n", baud);
+    changed = UART_SetBaud(baud);
+    G8RTOS_SignalSemaphore(&sem_UART);
+
+    // Resending the whole board lets a decoder that lost sync catch up
+    if (changed) {
+        TetrisTelemetry_Keyframe();
+    } else {
+        ConsolePrint("baud %d not possible, still %d\n", baud, UART_GetBaud());
+    }
+    return true;
+}
+
+// telemetry [on | off]
+static bool ConsoleTelemetry(uint8_t argc, char** argv) {
+    bool on = false;
+
+    if (argc > 1) {
+        if (!TetrisConsole_ParseSwitch(argv[1], &on)) {
+            return false;
+        }
+        TetrisTelemetry_SetEnabled(on);
+    }
+
+    ConsolePrint("telemetry %s\n", TetrisTelemetry_IsEnabled() ? "on" : "off");
+    return true;
+}
+
+// pause [on | off]: as SW3, toggles without an argument.
+static bool ConsolePause(uint8_t argc, char** argv) {
+    bool pause = false;
+
+    if (argc > 1 && !TetrisConsole_ParseSwitch(argv[1], &pause)) {
+        return false;
+    }
+    if (!gameStarted || gameState.gameOver) {
+        ConsolePrint("no game running\n");
+        return true;
+    }
+
+    G8RTOS_WaitSemaphore(&sem_GameState);
+    SetPaused((argc > 1) ? pause : !gameState.pauseGame);
+    pause = gameState.pauseGame;
+    G8RTOS_SignalSemaphore(&sem_GameState);
+
+    ConsolePrint("%s\n", pause ? "paused" : "running");
+    return true;
+}
+
+// seed [n]: the next game, started by a button or replay, uses n.
+static bool ConsoleSeed(uint8_t argc, char** argv) {
+    uint32_t seed = 0;
+
+    if (argc > 1) {
+        if (!TetrisConsole_ParseNumber(argv[1], &seed)) {
+            return false;
+        }
+        G8RTOS_WaitSemaphore(&sem_GameState);
+        gameSeed = seed;
+        seedPending = true;
+        G8RTOS_SignalSemaphore(&sem_GameState);
+        ConsolePrint("next game seed %u\n", seed);
+    } else {
+        G8RTOS_WaitSemaphore(&sem_GameState);
+        seed = gameSeed;
+        G8RTOS_SignalSemaphore(&sem_GameState);
+        ConsolePrint("seed %u\n", seed);
+    }
+    return true;
+}
+
+// replay: restarts with the seed of the last game, or the one just set.
+static bool ConsoleReplay(uint8_t argc, char** argv) {
+    uint32_t seed = 0;
+
+    G8RTOS_WaitSemaphore(&sem_GameState);
+    seed = gameSeed;
+    G8RTOS_SignalSemaphore(&sem_GameState);
+
+    // Starts a player game if none has been started yet
+    RestartGame(&seed);
+
+    ConsolePrint("replaying seed %u\n", seed);
+    return true;
+}
+
+// link: board link frames and UART bytes, versus games and predictions.
+static bool ConsoleLink(uint8_t argc, char** argv) {
+    const char* phases[] = {"idle", "joining", "playing", "won", "lost"};
+    uartLinkStats_t uart;
+    linkStats_t link;
+    versusStats_t versus;
+    versusPhase_t phase = VERSUS_IDLE;
+    uint8_t pending = 0;
+    bool connected = false;
+
+    UART_GetLinkStats(&uart);
+    G8RTOS_WaitSemaphore(&sem_GameState);
+    TetrisLink_GetStats(&link);
+    TetrisVersus_GetStats(&versus);
+    phase = TetrisVersus_GetPhase();
+    pending = TetrisLink_Pending();
+    connected = TetrisVersus_IsConnected(SystemTime);
+    G8RTOS_SignalSemaphore(&sem_GameState);
+
+    ConsolePrint("link %s, %s, rtt %d ms, %d unacknowledged, %d sessions\n", connected ? "up" : "down",
+                 phases[phase], link.rttMS, pending, link.peers);
+    ConsolePrint("frames: %d sent, %d received, %d bad, %d resent, %d duplicate, %d refused, %d unwritten\n",
+                 link.framesSent, link.framesReceived, link.badFrames, link.retransmits, link.duplicates,
+                 link.windowFull, link.writeFailures);
+    ConsolePrint("uart: %d bytes out, %d in, %d dropped, %d errors\n",
+                 uart.txBytes, uart.rxBytes, uart.rxDropped, uart.rxErrors);
+    ConsolePrint("versus: %d games, %d won, %d lost, garbage %d sent, %d received, %d cancelled\n",
+                 versus.games, versus.wins, versus.losses, versus.linesSent, versus.linesReceived,
+                 versus.linesCancelled);
+    ConsolePrint("states: %d, %d stale, piece predicted %d times, %d missed\n",
+                 versus.states, versus.staleStates, versus.predictions, versus.mispredictions);
+    return true;
+}
+
+/*********************************Console Commands**********************************/
+
+/*************************************Threads***************************************/
+
+void Idle_Thread(void) {
+    while(1);
+}
+
+void Tetris_Game_Thread(void) {
+    uint32_t nowUS = 0;
+    uint32_t lastUS = 0;
+    uint32_t accumulatorUS = 0;
+    uint32_t waitUS = 0;
+    uint32_t lockUS = 0;
+    uint8_t rows = 0;
+    bool running = false;
+
+    while (1) {
+        // Don't start game logic until game has started
+        if (!gameStarted) {
+            running = false;
+            sleep(100);
+            continue;
+        }
+        
+        // Exit game loop if game is over
+        if (gameState.gameOver) {
+            running = false;
+            sleep(1000);
+            continue;
+        }
+
+        // Time doesn't accumulate while paused
+        if (gameState.pauseGame) {
+            running = false;
+            sleep(GAME_MAX_SLEEP);
+            continue;
+        }
+
+        nowUS = G8RTOS_GetTimeUS();
+        if (!running) {
+            lastUS = nowUS;
+            accumulatorUS = 0;
+            running = true;
+        }
+        accumulatorUS += nowUS - lastUS;
+        lastUS = nowUS;
+
+        // Drop time lost to a long stall instead of replaying it
+        if (accumulatorUS > GAME_MAX_CATCHUP_US) {
+            accumulatorUS = GAME_MAX_CATCHUP_US;
+        }
+
+        G8RTOS_WaitSemaphore(&sem_GameState);
+
+        // Run whole fixed steps, the remainder carries over to the next wake-up
+        while (accumulatorUS >= GAME_STEP_US && !gameState.gameOver) {
+            accumulatorUS -= GAME_STEP_US;
+
+            // Gravity, can be several rows per step at high levels
+            rows = TetrisLevel_Gravity(GAME_STEP_US, fastDrop);
+            while (rows > 0) {
+                if (!MovePiece(0, 1)) {
+                    TetrisInput_Grounded(SystemTime, gameState.currentPieceY);
+                    break;
+                }
+                TetrisInput_Airborne();
+                rows--;
+            }
+
+            // Lock once lock delay runs out, unless the piece was moved off the stack
+            if (TetrisInput_LockDue(SystemTime)) {
+                if (CanMovePiece(gameState.currentPieceX, gameState.currentPieceY + 1)) {
+                    TetrisInput_Airborne();
+                } else {
+                    LockPiece();
+                }
+            }
+        }
+
+        // Sleep until the next row or lock, whichever comes first
+        waitUS = TetrisLevel_NextRowUS(fastDrop);
+        if (TetrisInput_IsGrounded()) {
+            lockUS = ((int32_t)(TetrisInput_LockDeadline() - SystemTime) > 0) ?
+                     (TetrisInput_LockDeadline() - SystemTime) * 1000 : 0;
+            if (lockUS < waitUS) {
+                waitUS = lockUS;
+            }
+        }
+
+        G8RTOS_SignalSemaphore(&sem_GameState);
+
+        waitUS = (waitUS > accumulatorUS) ? (waitUS - accumulatorUS) : 0;
+        waitUS = (waitUS + 999) / 1000;
+        if (waitUS > GAME_MAX_SLEEP) {
+            waitUS = GAME_MAX_SLEEP;
+        }
+        sleep((waitUS > 0) ? waitUS : 1);
+    }
+}
+
+void Tetris_Input_Thread(void) {
+    uint32_t event = 0;
+
+    while(1) 
+    {
+        // Blocks until an input changes, nothing is polled here
+        event = G8RTOS_ReadFIFO(INPUT_FIFO);
+
+        // Only player input is timed, the autoplayer queues its own events
+        if (!autoplay) {
+            TetrisInput_RecordLatency(event, SystemTime);
+        }
+        TetrisTelemetry_Input(event);
+
+        if (INPUT_EVENT_SOURCE(event) == INPUT_SOURCE_BUTTON) {
+            HandleButtonEvent(event);
+        } else {
+            HandleStickEvent(event);
+        }
+    }
+}
+
+void Tetris_Motion_Thread(void) {
+    // Frames of one FIFO burst kept off the thread stack
+    static int16_t frames[MOTION_MAX_FRAMES * 3];
+    uint32_t events[INPUT_MAX_EVENTS];
+    motionConfig_t config;
+    uint8_t odr = 0;
+    uint8_t bwp = 0;
+    uint8_t watermark = 0;
+    uint8_t count = 0;
+    uint8_t n = 0;
+    uint8_t i = 0;
+
+    TetrisMotion_Init();
+    BMI160_SetInterrupt(BMI160_INT_FIFO_WATERMARK);
+    BMI160_IntEnable();
+
+    while (1) {
+        // Sensor setup follows the configuration
+        TetrisMotion_GetConfig(&config);
+        if (config.odr != odr || config.bwp != bwp || config.watermark != watermark) {
+            odr = config.odr;
+            bwp = config.bwp;
+            watermark = config.watermark;
+            BMI160_ConfigureAccel(odr, bwp, MOTION_RANGE);
+            BMI160_EnableFIFO(watermark);
+        }
+
+        G8RTOS_WaitSemaphore(&sem_Motion);
+
+        // Drain everything so INT1 drops and the next watermark raises it again
+        do {
+            count = BMI160_ReadFIFO(frames, MOTION_MAX_FRAMES);
+            n = TetrisMotion_Update(frames, count, motionTime, events);
+
+            // Motion only steers a game the player is playing
+            if (gameStarted && !autoplay && !gameState.pauseGame) {
+                for (i = 0; i < n; i++) {
+                    QueueInput(events[i]);
+                }
+            }
+        } while (count == MOTION_MAX_FRAMES);
+    }
+}
+
+void Tetris_AI_Thread(void) {
+    // Board snapshot kept off the thread stack
+    static uint8_t board[BOARD_HEIGHT][BOARD_WIDTH];
+    uint32_t lastPiece = 0;
+    uint8_t currentType = 0;
+    uint8_t nextType = 0;
+    int currentX = 0;
+    int dx = 0;
+    int i = 0;
+    int j = 0;
+    uint8_t code = 0;
+    tetrisMove_t move;
+
+    TetrisAI_Init();
+
+    while (1) {
+        if (!gameStarted || !autoplay) {
+            sleep(100);
+            continue;
+        }
+
+        // Keep soak runs going by restarting after a short look at game over
+        if (gameState.gameOver) {
+            G8RTOS_WaitSemaphore(&sem_UART);
+            UARTprintf("AI: %d placements/s\n", TetrisAI_GetEvalsPerSecond());
+            G8RTOS_SignalSemaphore(&sem_UART);
+
+            // A start from the versus opponent may have restarted it already
+            sleep(AI_RESTART_DELAY);
+            if (gameState.gameOver) {
+                RestartGame(0);
+            }
+            continue;
+        }
+
+        if (gameState.pauseGame || piecesSpawned == lastPiece) {
+            sleep(AI_POLL_PERIOD);
+            continue;
+        }
+
+        // Snapshot the new piece and the board it will land on
+        G8RTOS_WaitSemaphore(&sem_GameState);
+        for (i = 0; i < BOARD_HEIGHT; i++) {
+            for (j = 0; j < BOARD_WIDTH; j++) {
+                board[i][j] = gameState.board[i][j];
+            }
+        }
+        currentType = gameState.currentPieceType;
+        nextType = gameState.nextPieceType;
+        currentX = gameState.currentPieceX;
+        lastPiece = piecesSpawned;
+        G8RTOS_SignalSemaphore(&sem_GameState);
+
+        // Release fast drop in case the stick held it when autoplay started
+        QueueInput(INPUT_EVENT(INPUT_SOURCE_JOYSTICK, INPUT_RELEASE, INPUT_DOWN, 0, SystemTime));
+
+        if (!TetrisAI_FindMove(board, currentType, nextType, &move)) {
+            continue;
+        }
+
+        // Rotations are SW2 presses (clockwise), queued ahead of the moves so
+        // they are applied first
+        for (i = 0; i < move.rotations; i++) {
+            QueueInput(INPUT_EVENT(INPUT_SOURCE_BUTTON, INPUT_PRESS, INPUT_SW2, 1, SystemTime));
+            QueueInput(INPUT_EVENT(INPUT_SOURCE_BUTTON, INPUT_RELEASE, INPUT_SW2, 0, SystemTime));
+        }
+
+        // Horizontal moves and the hard drop are stick events. The whole
+        // shift is one press carrying the cell count.
+        dx = move.x - currentX;
+        if (dx != 0) {
+            code = (dx < 0) ? INPUT_LEFT : INPUT_RIGHT;
+            dx = (dx < 0) ? -dx : dx;
+            QueueInput(INPUT_EVENT(INPUT_SOURCE_JOYSTICK, INPUT_PRESS, code, dx, SystemTime));
+            QueueInput(INPUT_EVENT(INPUT_SOURCE_JOYSTICK, INPUT_RELEASE, code, 0, SystemTime));
+        }
+        QueueInput(INPUT_EVENT(INPUT_SOURCE_JOYSTICK, INPUT_PRESS, INPUT_UP, 1, SystemTime));
+        QueueInput(INPUT_EVENT(INPUT_SOURCE_JOYSTICK, INPUT_RELEASE, INPUT_UP, 0, SystemTime));
+    }
+}
+
+void Tetris_Telemetry_Thread(void) {
+    // Board snapshot kept off the thread stack
+    static uint8_t board[BOARD_HEIGHT][BOARD_WIDTH];
+    threadStats_t threads[TELEMETRY_MAX_THREADS];
+    telemetryThread_t entries[TELEMETRY_MAX_THREADS];
+    telemetryScore_t score;
+    uartTestResult_t test;
+    uint32_t lastThreads = 0;
+    uint32_t count = 0;
+    uint32_t n = 0;
+    int x = 0;
+    int y = 0;
+    int i = 0;
+    int j = 0;
+
+    memset(&score, 0, sizeof(score));
+    memset(entries, 0, sizeof(entries));
+
+    if (UART_SELF_TEST_BYTES) {
+        G8RTOS_WaitSemaphore(&sem_UART);
+        UART_StreamTest(UART_SELF_TEST_BYTES, &test);
+        UARTprintf("\nUART test: %d bytes in %d us, %d B/s of %d, %d interrupts\n", test.bytes,
+                   test.elapsedUS, (uint32_t)(((uint64_t)test.bytes * 1000000) / (test.elapsedUS ? test.elapsedUS : 1)),
+                   test.baud / 10, test.interrupts);
+        G8RTOS_SignalSemaphore(&sem_UART);
+    }
+
+    while (1) {
+        sleep(TELEMETRY_PERIOD);
+        PrintGameReport();
+        if (!TetrisTelemetry_IsEnabled()) {
+            continue;
+        }
+
+        // Snapshot the board with the falling piece drawn in
+        G8RTOS_WaitSemaphore(&sem_GameState);
+        memcpy(board, gameState.board, sizeof(board));
+        if (gameStarted && !gameState.gameOver) {
+            for (i = 0; i < PIECE_SIZE; i++) {
+                for (j = 0; j < PIECE_SIZE; j++) {
+                    y = gameState.currentPieceY + i;
+                    x = gameState.currentPieceX + j;
+                    if (currentPiece[i][j] && y >= 0 && y < BOARD_HEIGHT && x >= 0 && x < BOARD_WIDTH) {
+                        board[y][x] = gameState.currentPieceType + 1;
+                    }
+                }
+            }
+        }
+        score.score = currentScore;
+        score.lines = TetrisLevel_GetLines();
+        score.pieces = piecesSpawned;
+        score.level = TetrisLevel_GetLevel();
+        score.flags = (gameState.gameOver ? TELEMETRY_FLAG_GAME_OVER : 0) |
+                      (gameState.pauseGame ? TELEMETRY_FLAG_PAUSED : 0) |
+                      (autoplay ? TELEMETRY_FLAG_AUTOPLAY : 0);
+        G8RTOS_SignalSemaphore(&sem_GameState);
+
+        // Frames go into the console's ring in a few microseconds each
+        G8RTOS_WaitSemaphore(&sem_UART);
+        TetrisTelemetry_FlushInput(SystemTime);
+        TetrisTelemetry_Score(&score, SystemTime);
+        TetrisTelemetry_Board(board, SystemTime);
+
+        if ((uint32_t)(SystemTime - lastThreads) >= TELEMETRY_THREADS_PERIOD) {
+            lastThreads = SystemTime;
+            count = G8RTOS_GetThreadStats(threads, TELEMETRY_MAX_THREADS);
+            for (n = 0; n < count; n++) {
+                entries[n].runTimeUS = threads[n].runTimeUS;
+                entries[n].switches = threads[n].switches;
+                entries[n].id = (uint8_t)threads[n].id;
+                entries[n].priority = threads[n].priority;
+                entries[n].state = threads[n].blocked ? 2 : (threads[n].asleep ? 1 : 0);
+                strncpy(entries[n].name, threads[n].name, TELEMETRY_NAME_LENGTH);
+            }
+            TetrisTelemetry_Send(TELEMETRY_THREADS, entries, count * sizeof(telemetryThread_t), SystemTime);
+        }
+        G8RTOS_SignalSemaphore(&sem_UART);
+    }
+}
+
+void Tetris_Console_Thread(void) {
+    TetrisConsole_Init(consoleCommands, sizeof(consoleCommands) / sizeof(consoleCommands[0]), ConsolePrint);
+
+    while (1) {
+        // The UART interrupt signals when characters are waiting
+        G8RTOS_WaitSemaphore(&sem_Console);
+        while (UARTRxBytesAvail()) {
+            TetrisConsole_Input((char)UARTgetc());
+        }
+    }
+}
+
+void Tetris_Link_Thread(void) {
+    // Received bytes kept off the thread stack
+    static uint8_t bytes[LINK_READ_CHUNK];
+    versusState_t state;
+    inputConfig_t input;
+    uint32_t count = 0;
+    uint32_t seed = 0;
+    bool playing = false;
+    bool start = false;
+
+    memset(&state, 0, sizeof(state));
+
+    while (1) {
+        // Polled, the link also has to resend and send states on time
+        sleep(LINK_POLL_PERIOD);
+
+        G8RTOS_WaitSemaphore(&sem_GameState);
+        do {
+            count = UART_LinkRead(bytes, sizeof(bytes));
+            TetrisVersus_Receive(bytes, count, SystemTime);
+        } while (count == sizeof(bytes));
+
+        // The opponent topped out first
+        if (gameStarted && !gameState.gameOver && TetrisVersus_GetPhase() == VERSUS_WON) {
+            EndGame();
+        }
+
+        // This board as the opponent sees it, the falling piece apart
+        playing = gameStarted && !gameState.gameOver && !gameState.pauseGame;
+        TetrisInput_GetConfig(&input);
+        TetrisVersus_PackBoard(gameState.board, &state);
+        state.flags = (playing ? VERSUS_FLAG_PLAYING : 0) | (fastDrop ? VERSUS_FLAG_FAST_DROP : 0);
+        state.pieceType = playing ? gameState.currentPieceType : VERSUS_NO_PIECE;
+        state.pieceX = gameState.currentPieceX;
+        state.pieceY = gameState.currentPieceY;
+        state.pieceMask = TetrisVersus_PieceMask(currentPiece);
+        state.shift = heldShift;
+        state.repeatMS = input.arrMS;
+        state.rowTimeUS = TetrisLevel_GetRowTimeUS(fastDrop);
+        TetrisVersus_Update(&state, SystemTime);
+
+        start = TetrisVersus_TakeStart(&seed);
+        G8RTOS_SignalSemaphore(&sem_GameState);
+
+        // The opponent started a game, deal the same pieces here
+        if (start) {
+            RestartGame(&seed);
+        }
+    }
+}
+
+/********************************Periodic Threads***********************************/
+
+void Read_Input(void) {
+    joystickState_t stick;
+    uint32_t events[INPUT_MAX_EVENTS];
+    uint8_t count = 0;
+    uint8_t i = 0;
+
+    // Re-read the port if an edge came in while a read was on the bus
+    if (buttonReread) {
+        buttonReread = false;
+        RequestButtons();
+    }
+
+    // Buttons are debounced while paused too, SW3 resumes
+    count = TetrisInput_Buttons(SystemTime, events);
+    for (i = 0; i < count; i++) {
+        QueueInput(events[i]);
+    }
+
+    // The autoplayer drives the stick while it is playing
+    if (!(gameState.pauseGame) && !autoplay) {
+        // Classify the filtered position, only changes are queued
+        JOYSTICK_GetState(&stick);
+        count = TetrisInput_Stick(stick.x, stick.y, SystemTime, events);
+        for (i = 0; i < count; i++) {
+            QueueInput(events[i]);
+        }
+    }
+}
+
+void Tetris_Display_Thread(void) {
+    uint8_t backlight = 0;
+
+    // Ambient light changes come in from the OPT3001 interrupt
+    if (TetrisLight_TakeBacklight(&backlight)) {
+        ST7789_SetBrightness(backlight);
+    }
+
+    G8RTOS_WaitSemaphore(&sem_GameState);
+    UpdateTetrisDisplay();
     G8RTOS_SignalSemaphore(&sem_GameState);
 }
 
 /*******************************Aperiodic Threads***********************************/
 
 void Button_Handler() {
-    // disable interrupt and signal semaphore
-    GPIOIntDisable(BUTTONS_INT_GPIO_BASE, BUTTONS_INT_PIN);
-    G8RTOS_SignalSemaphore(&sem_PCA9555_Debounce);
+    // Timestamp the edge and read the port, Read_Input debounces the result
+    GPIOIntClear(BUTTONS_INT_GPIO_BASE, BUTTONS_INT_PIN);
+    TetrisInput_ButtonEdge(SystemTime);
+    RequestButtons();
+}
+
+void Sensors_Handler() {
+    // BMI160 and OPT3001 interrupts share port C
+    uint32_t status = GPIOIntStatus(BMI160_INT_GPIO_BASE, true);
+
+    GPIOIntClear(BMI160_INT_GPIO_BASE, status);
+
+    // FIFO reached its watermark, Tetris_Motion_Thread drains it
+    if (status & BMI160_INT_PIN) {
+        motionTime = SystemTime;
+        G8RTOS_SignalSemaphore(&sem_Motion);
+    }
+
+    // Light left the window, read it from the interrupt
+    if (status & OPT3001_INT_PIN) {
+        TetrisLight_Handler();
+    }
 }
@@ -29,6 +29,11 @@
 #define CELL_Z 5
 #define CELL_J 6
 #define CELL_L 7
+#define CELL_GHOST 8
+#define CELL_GARBAGE 9          // raised by the versus opponent
+
+// No piece in a hold or preview slot
+#define NO_PIECE 0xFF
 
 // Piece colors (16-bit RGB565 format)
 #define COLOR_EMPTY 0x0000   // Black
@@ -39,30 +44,71 @@
 #define COLOR_Z 0x001F      // Red
 #define COLOR_J 0xF800      // Blue
 #define COLOR_L 0x04BF      // Orange
+#define COLOR_GHOST 0x4208  // Dark grey
+#define COLOR_GARBAGE 0x8410 // Grey
+
+// Hold / preview panels in the grey side columns
+#define PREVIEW_COUNT 5
+#define PANEL_CELL 8                    // mini cell size in pixels
+#define PANEL_ROWS 2                    // piece rows shown, all spawn shapes fit
+#define PANEL_FIRST_ROW 1               // first of those rows in the 4x4 box
+#define PANEL_SLOT_HEIGHT 34            // two grid rows per slot
+#define PANEL_LEFT_X 1
+#define PANEL_RIGHT_X 206
+#define PANEL_SLOT_Y(n) (Y_MAX - (((n) + 1) * PANEL_SLOT_HEIGHT) + 8)
+#define PANEL_INVALID 0x0001            // never a drawn color, forces a redraw
+
+// Versus opponent's board, small cells at the bottom of the left column
+#define PEER_CELL 3
+#define PEER_X 3
+#define PEER_Y 4
 
 // Thread priorities
 #define GAME_THREAD_PRIORITY 2
-#define BUTTON_THREAD_PRIORITY 4
-#define READ_BUTTONS_PRIORITY 3
-#define JOYSTICK_THREAD_PRIORITY 1
+#define INPUT_THREAD_PRIORITY 1
+#define MOTION_THREAD_PRIORITY 3
+#define AI_THREAD_PRIORITY 5
+#define TELEMETRY_THREAD_PRIORITY 4
+#define CONSOLE_THREAD_PRIORITY 6
+#define LINK_THREAD_PRIORITY 3
 
 // Periodic events
-#define JOYSTICK_PERIOD 50
+#define INPUT_PERIOD 4
 #define DISPLAY_PERIOD 50
 
+// Game thread fixed timestep
+#define GAME_STEP_US 500            // gravity / lock update step
+#define GAME_MAX_CATCHUP_US 50000   // most time replayed after a stall
+#define GAME_MAX_SLEEP 16           // ms, bounds steps run per wake-up
+
+// Telemetry timing, ms
+#define TELEMETRY_PERIOD 20             // board, score and input batches
+#define TELEMETRY_THREADS_PERIOD 1000   // thread statistics
+
+// Bytes of the uDMA throughput test sent before telemetry starts, checked
+// by tools/uart_throughput. 0 skips it.
+#define UART_SELF_TEST_BYTES 0
+
+// Board link, ms and bytes
+#define LINK_POLL_PERIOD 5
+#define LINK_READ_CHUNK 64
+
+// Autoplayer timing
+#define AI_POLL_PERIOD 20
+#define AI_RESTART_DELAY 3000
+
 // FIFOs
-#define BUTTONS_FIFO        0
-#define JOYSTICK_FIFO       1
+#define INPUT_FIFO          0
 
 /*************************************Defines***************************************/
 
 /***********************************Semaphores**************************************/
 
-semaphore_t sem_I2CA;
 semaphore_t sem_UART;
 semaphore_t sem_SPIA;
-semaphore_t sem_PCA9555_Debounce;
 semaphore_t sem_GameState;
+semaphore_t sem_Motion;
+semaphore_t sem_Console;
 
 /***********************************Semaphores**************************************/
 
@@ -74,7 +120,10 @@ typedef struct {
     int currentPieceX;
     int currentPieceY;
     int currentPieceType;  // 0-6 corresponding to piece types
-    int nextPieceType;
+    int nextPieceType;     // head of previewTypes, NO_PIECE before the first spawn
+    int previewTypes[PREVIEW_COUNT];
+    int holdPieceType;
+    bool holdUsed;         // hold allowed once per spawned piece
     bool gameOver;
     bool pauseGame;
 } GameState;
@@ -138,17 +187,20 @@ static const uint8_t PIECES[7][PIECE_SIZE][PIECE_SIZE] = {
 
 // Function declarations
 void Idle_Thread(void);
-void Read_Buttons(void);
 void Threads_Init(void);
 void Tetris_Game_Thread(void);
-void Tetris_Button_Thread(void);
-void Tetris_Joystick_Thread(void);
+void Tetris_Input_Thread(void);
+void Tetris_Motion_Thread(void);
+void Tetris_AI_Thread(void);
+void Tetris_Telemetry_Thread(void);
+void Tetris_Console_Thread(void);
+void Tetris_Link_Thread(void);
 
 /*******************************Background Threads**********************************/
 
 /********************************Periodic Threads***********************************/
 
-void Read_Joystick(void);
+void Read_Input(void);
 void Tetris_Display_Thread(void);
 
 /********************************Periodic Threads***********************************/
@@ -156,6 +208,7 @@ void Tetris_Display_Thread(void);
 /*******************************Aperiodic Threads***********************************/
 
 void Button_Handler(void);
+void Sensors_Handler(void);
 
 /*******************************Aperiodic Threads***********************************/
 
@@ -0,0 +1,185 @@
+// adpcm_encode.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host tool encoding a 16 bit WAV file into an IMA-ADPCM clip for the
+// sound effect mixer, written as C source to add to Game/src. Prints the
+// size, the SNR of the decoded clip and the host decode speed.
+// Build from the repository root:
+//   cc -O2 -I. -o adpcm_encode tools/adpcm_encode.c Game/src/tetris_adpcm.c -lm
+// Usage: adpcm_encode in.wav name out.c
+
+/************************************Includes***************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "Game/tetris_adpcm.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Decode passes timed for the speed report
+#define DECODE_PASSES           200
+
+/*************************************Defines***************************************/
+
+/*******************************Private Functions***********************************/
+
+// GetLE
+// Return: uint32_t, a little-endian value of 2 or 4 bytes
+static uint32_t GetLE(const uint8_t* bytes, uint8_t count) {
+    uint32_t value = 0;
+
+    while (count--) {
+        value = (value << 8) | bytes[count];
+    }
+    return value;
+}
+
+// ReadWAV
+// Loads the first channel of a 16 bit PCM WAV file.
+// Return: int16_t*, malloc'd samples, 0 on error
+static int16_t* ReadWAV(const char* path, uint32_t* count, uint32_t* rate) {
+    FILE* file = fopen(path, "rb");
+    uint8_t header[12];
+    uint8_t chunk[8];
+    uint8_t format[16];
+    uint8_t* data = 0;
+    int16_t* samples = 0;
+    uint32_t size = 0;
+    uint16_t channels = 0;
+    uint32_t i = 0;
+
+    if (file == 0) {
+        perror(path);
+        return 0;
+    }
+
+    if (fread(header, 1, 12, file) != 12 || memcmp(header, "RIFF", 4) || memcmp(header + 8, "WAVE", 4)) {
+        fprintf(stderr, "%s: not a WAV file\n", path);
+        fclose(file);
+        return 0;
+    }
+
+    while (fread(chunk, 1, 8, file) == 8) {
+        size = GetLE(chunk + 4, 4);
+        if (!memcmp(chunk, "fmt ", 4)) {
+            if (size < 16 || fread(format, 1, 16, file) != 16) {
+                break;
+            }
+            fseek(file, (long)(size - 16 + (size & 1)), SEEK_CUR);
+            channels = (uint16_t)GetLE(format + 2, 2);
+            *rate = GetLE(format + 4, 4);
+            if (GetLE(format, 2) != 1 || GetLE(format + 14, 2) != 16 || channels == 0) {
+                fprintf(stderr, "%s: only 16 bit PCM is supported\n", path);
+                break;
+            }
+        } else if (!memcmp(chunk, "data", 4) && channels) {
+            data = malloc(size);
+            samples = malloc((size / (2 * channels)) * sizeof(int16_t));
+            if (data && samples && fread(data, 1, size, file) == size) {
+                *count = size / (2 * channels);
+                for (i = 0; i < *count; i++) {
+                    samples[i] = (int16_t)GetLE(data + 2 * channels * i, 2);
+                }
+                free(data);
+                fclose(file);
+                return samples;
+            }
+            break;
+        } else {
+            fseek(file, (long)(size + (size & 1)), SEEK_CUR);
+        }
+    }
+
+    fprintf(stderr, "%s: no usable sample data\n", path);
+    free(data);
+    free(samples);
+    fclose(file);
+    return 0;
+}
+
+/*******************************Private Functions***********************************/
+
+int main(int argc, char** argv) {
+    adpcmDecoder_t decoder;
+    int16_t* samples = 0;
+    int16_t* decoded = 0;
+    uint8_t* data = 0;
+    uint32_t count = 0;
+    uint32_t rate = 0;
+    uint32_t bytes = 0;
+    uint32_t done = 0;
+    uint32_t i = 0;
+    double signal = 0.0;
+    double noise = 0.0;
+    clock_t start = 0;
+    double seconds = 0.0;
+    const char* name = 0;
+    FILE* file = 0;
+
+    if (argc < 4) {
+        fprintf(stderr, "usage: %s in.wav name out.c\n", argv[0]);
+        return 1;
+    }
+
+    samples = ReadWAV(argv[1], &count, &rate);
+    if (samples == 0) {
+        return 1;
+    }
+
+    data = malloc(ADPCM_BYTES(count));
+    decoded = malloc(count * sizeof(int16_t) + 1);
+    bytes = TetrisADPCM_Encode(samples, count, data);
+
+    // Decode in refill sized pieces, as the mixer does
+    start = clock();
+    for (i = 0; i < DECODE_PASSES; i++) {
+        TetrisADPCM_Start(&decoder, data, count);
+        for (done = 0; done < count; ) {
+            done += TetrisADPCM_Decode(&decoder, decoded + done, 32);
+        }
+    }
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    for (i = 0; i < count; i++) {
+        signal += (double)samples[i] * samples[i];
+        noise += (double)(samples[i] - decoded[i]) * (samples[i] - decoded[i]);
+    }
+
+    name = strrchr(argv[3], '/') ? strrchr(argv[3], '/') + 1 : argv[3];
+    file = fopen(argv[3], "w");
+    if (file == 0) {
+        perror(argv[3]);
+        return 1;
+    }
+
+    fprintf(file,
+            "// %s\n"
+            "// IMA-ADPCM clip, %u samples at %u Hz. Generated by tools/adpcm_encode.c\n"
+            "// from %s.\n\n"
+            "#include \"../tetris_sfx.h\"\n\n"
+            "static const uint8_t %sData[%u] = {",
+            name, count, rate, argv[1], argv[2], bytes);
+    for (i = 0; i < bytes; i++) {
+        fprintf(file, "%s0x%02X%s", (i % 16) ? " " : "\n    ", data[i], (i + 1 < bytes) ? "," : "");
+    }
+    fprintf(file, "\n};\n\nconst sfxClip_t %sClip = {%sData, %u, %u, SFX_FORMAT_ADPCM};\n",
+            argv[2], argv[2], count, rate);
+    fclose(file);
+
+    printf("%s: %u samples at %u Hz, %u bytes (%.1f:1), SNR %.1f dB\n", argv[3], count, rate, bytes,
+           (2.0 * count) / bytes, (noise > 0.0) ? 10.0 * log10(signal / noise) : 99.0);
+    printf("host decode %.1f ns/sample, the board reports cycles/sample in its audio report\n",
+           (seconds * 1e9) / ((double)count * DECODE_PASSES));
+
+    free(samples);
+    free(decoded);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,179 @@
+// ai_bench.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-19
+// Host benchmark of the autoplayer's placement search. Runs TetrisAI
+// searches for every current / next piece pair on a few fixed boards and
+// reports the placements evaluated per second and the time per search,
+// timed with the host's clock, without the preemption the on-target figure
+// includes. The stand-in G8RTOS_GetTimeUS stays at 0 so the time budget
+// never cuts a search short and every run does the same work; the
+// evaluation budget still applies.
+// Build from the repository root, -fcommon for the RTOS headers' globals:
+//   cc -O2 -fcommon -I. -o ai_bench tools/ai_bench.c Game/src/tetris_ai.c
+// Usage: ai_bench [-n rounds]
+
+/************************************Includes***************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "threads.h"
+#include "Game/tetris_ai.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DEFAULT_ROUNDS          200
+#define PIECE_TYPES             7
+
+/*************************************Defines***************************************/
+
+/****************************Data Structure Definitions*****************************/
+
+// A board drawn bottom up from its last row, '#' filled, anything else free
+typedef struct {
+    const char* name;
+    const char* rows[BOARD_HEIGHT];
+} benchBoard_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/*******************************Private Variables***********************************/
+
+static const benchBoard_t boards[] = {
+    { "empty", { 0 } },
+    { "midgame", {
+        "##.#######",
+        "#.########",
+        "###.######",
+        "##.####.##",
+        "#...###..#",
+        "....##....",
+    } },
+    { "tall", {
+        "#########.",
+        "##.#######",
+        "#.#######.",
+        "####.#####",
+        "###.###.##",
+        "##.######.",
+        "#.###.####",
+        "####.###.#",
+        "##.###.###",
+        "#.#.#.#.##",
+        ".#..##..#.",
+    } },
+};
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// G8RTOS_GetTimeUS
+// Stands in for the RTOS clock read by the autoplayer's time budget.
+// Return: uint32_t, always 0
+uint32_t G8RTOS_GetTimeUS(void) {
+    return 0;
+}
+
+// Seconds
+// Return: double, monotonic time in seconds
+static double Seconds(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Fill
+// Draws a bench board into a game board.
+// Return: void
+static void Fill(const benchBoard_t* bench, uint8_t board[BOARD_HEIGHT][BOARD_WIDTH]) {
+    int i = 0;
+    int j = 0;
+
+    memset(board, CELL_EMPTY, BOARD_HEIGHT * BOARD_WIDTH);
+    for (i = 0; i < BOARD_HEIGHT && bench->rows[i]; i++) {
+        for (j = 0; j < BOARD_WIDTH && bench->rows[i][j]; j++) {
+            if (bench->rows[i][j] == '#') {
+                board[BOARD_HEIGHT - 1 - i][j] = CELL_I;
+            }
+        }
+    }
+}
+
+/*******************************Private Functions***********************************/
+
+int main(int argc, char** argv) {
+    uint8_t board[BOARD_HEIGHT][BOARD_WIDTH];
+    tetrisAIStats_t stats;
+    tetrisMove_t move;
+    uint32_t rounds = DEFAULT_ROUNDS;
+    uint32_t searches = 0;
+    uint32_t evaluations = 0;
+    uint32_t budgetHits = 0;
+    uint64_t allEvaluations = 0;
+    double allSeconds = 0.0;
+    double start = 0.0;
+    double seconds = 0.0;
+    uint32_t b = 0;
+    uint32_t n = 0;
+    int current = 0;
+    int next = 0;
+    int a = 0;
+
+    for (a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-n") && a + 1 < argc) {
+            rounds = (uint32_t)strtoul(argv[++a], 0, 10);
+        } else {
+            fprintf(stderr, "usage: %s [-n rounds]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (rounds == 0) {
+        fprintf(stderr, "rounds must be above 0\n");
+        return 1;
+    }
+
+    TetrisAI_Init();
+
+    for (b = 0; b < sizeof(boards) / sizeof(boards[0]); b++) {
+        Fill(&boards[b], board);
+        TetrisAI_GetStats(&stats);
+        evaluations = stats.totalEvaluations;
+        budgetHits = stats.budgetHits;
+        searches = 0;
+
+        // Every pair of pieces, the same order each round
+        start = Seconds();
+        for (n = 0; n < rounds; n++) {
+            for (current = 0; current < PIECE_TYPES; current++) {
+                for (next = 0; next < PIECE_TYPES; next++) {
+                    searches += TetrisAI_FindMove(board, (uint8_t)current, (uint8_t)next, &move);
+                }
+            }
+        }
+        seconds = Seconds() - start;
+
+        TetrisAI_GetStats(&stats);
+        evaluations = stats.totalEvaluations - evaluations;
+        budgetHits = stats.budgetHits - budgetHits;
+        allEvaluations += evaluations;
+        allSeconds += seconds;
+
+        printf("%-8s %6u searches, %4u placements each, %5.1f us each, %.2fM placements/s, %u budget cut\n",
+               boards[b].name, searches, searches ? evaluations / searches : 0,
+               searches ? 1e6 * seconds / searches : 0.0, evaluations / seconds / 1e6, budgetHits);
+    }
+
+    printf("overall  %.2fM placements/s, %.1f ns each\n", allEvaluations / allSeconds / 1e6,
+           1e9 * allSeconds / allEvaluations);
+
+    return 0;
+}
@@ -0,0 +1,9 @@
+// hw_gpio.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host stand-in for the TivaWare header, nothing of it is used.
+
+#ifndef HW_GPIO_H_
+#define HW_GPIO_H_
+
+#endif /* HW_GPIO_H_ */
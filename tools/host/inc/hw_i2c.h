@@ -0,0 +1,11 @@
+// hw_i2c.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host stand-in for the TivaWare header.
+
+#ifndef HW_I2C_H_
+#define HW_I2C_H_
+
+#define I2C_O_MTPR              0x0000000C  // I2C Master Timer Period
+
+#endif /* HW_I2C_H_ */
@@ -0,0 +1,14 @@
+// hw_memmap.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host stand-in for the TivaWare header, the bases the drivers name.
+
+#ifndef HW_MEMMAP_H_
+#define HW_MEMMAP_H_
+
+#define GPIO_PORTA_BASE         0x40004000
+#define GPIO_PORTB_BASE         0x40005000
+#define I2C0_BASE               0x40020000
+#define I2C1_BASE               0x40021000
+
+#endif /* HW_MEMMAP_H_ */
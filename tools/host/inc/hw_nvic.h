@@ -0,0 +1,14 @@
+// hw_nvic.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host stand-in for the TivaWare header.
+
+#ifndef HW_NVIC_H_
+#define HW_NVIC_H_
+
+#define NVIC_INT_CTRL           0xE000ED04  // Interrupt Control and State
+#define NVIC_INT_CTRL_PEND_SV   0x10000000  // PendSV Set Pending
+#define NVIC_INT_CTRL_PENDSTSET 0x04000000  // SysTick Set Pending
+#define NVIC_INT_CTRL_VEC_ACT_M 0x000000FF  // Interrupt Pending Vector Number
+
+#endif /* HW_NVIC_H_ */
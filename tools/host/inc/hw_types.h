@@ -0,0 +1,18 @@
+// hw_types.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host stand-in for the TivaWare header. Register accesses go to the
+// simulation's register file instead of the bus.
+
+#ifndef HW_TYPES_H_
+#define HW_TYPES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Defined by the host program
+volatile uint32_t* SimRegister(uint32_t address);
+
+#define HWREG(x)                (*SimRegister((uint32_t)(x)))
+
+#endif /* HW_TYPES_H_ */
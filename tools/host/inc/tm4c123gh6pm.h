@@ -0,0 +1,13 @@
+// tm4c123gh6pm.h
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host stand-in for the TivaWare header, the interrupt numbers the drivers
+// name.
+
+#ifndef TM4C123GH6PM_H_
+#define TM4C123GH6PM_H_
+
+#define INT_I2C0                24
+#define INT_I2C1                53
+
+#endif /* TM4C123GH6PM_H_ */
@@ -0,0 +1,694 @@
+// i2c_sim.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host test of the I2C transaction state machine. multimod_i2c.c is built
+// unchanged against a simulated TM4C I2C master: the driverlib calls it
+// makes drive a model of the command register (START, RUN, STOP, ACK
+// bits) talking to register-file devices that can be absent or NACK a
+// chosen byte, and the bus is logged as it would look on a logic
+// analyser. Protocol misuse the hardware would not forgive, such as a
+// command before the last one was serviced, a CONT with no transfer open
+// or a read ended without a NACK, is counted. Each scenario checks the
+// wire log, the command count and the data, and prints PASS or FAIL.
+// Host stand-ins for the TivaWare register headers are in tools/host.
+// Build from the repository root:
+//   cc -O2 -fcommon -I. -Itools/host -DPART_TM4C123GH6PM -o i2c_sim tools/i2c_sim.c MultimodDrivers/src/multimod_i2c.c
+// Usage: i2c_sim [-v]
+
+/************************************Includes***************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "MultimodDrivers/multimod_i2c.h"
+#include "G8RTOS/G8RTOS_Scheduler.h"
+#include "G8RTOS/G8RTOS_CriticalSection.h"
+
+#include <inc/hw_types.h>
+#include <inc/hw_i2c.h>
+
+#include <driverlib/gpio.h>
+#include <driverlib/sysctl.h>
+#include <driverlib/interrupt.h>
+#include <driverlib/cpu.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define SIM_CLOCK               80000000    // system clock the board runs at
+#define SIM_REGISTERS           16
+#define SIM_WIRE_LENGTH         1024
+#define SIM_NO_NACK             -1
+#define SIM_MAX_SERVICE         1000        // interrupts before a queue is called stuck
+
+// Bits of the master control register, as written by I2CMasterControl
+#define SIM_CMD_RUN             0x01
+#define SIM_CMD_START           0x02
+#define SIM_CMD_STOP            0x04
+#define SIM_CMD_ACK             0x08
+
+// Devices on the simulated bus
+#define DEV_PLAIN               0x20        // register file, no auto-increment
+#define DEV_INCREMENT           0x21        // auto-increments on flag 0x80
+#define DEV_NACK                0x22        // NACKs its second written byte
+#define DEV_LOW                 0x23
+#define DEV_NORMAL              0x24
+#define DEV_HIGH                0x25
+#define DEV_SLOW                0x26        // profiled at 100 kHz
+#define DEV_ABSENT              0x50
+
+#define INCREMENT_FLAG          0x80
+
+/*************************************Defines***************************************/
+
+/****************************Data Structure Definitions*****************************/
+
+typedef struct {
+    uint8_t addr;
+    bool present;
+    bool incrementOnFlag;       // auto-increments only when the flag is set
+    int16_t nackAt;             // written byte the device NACKs, address is byte 0
+    uint8_t pointer;
+    uint8_t regs[256];
+} simDevice_t;
+
+typedef struct {
+    uint32_t base;
+    bool held;                  // START sent and no STOP yet
+    bool receive;
+    bool increment;             // the current write auto-increments
+    bool lastNacked;            // the last read byte was NACKed
+    uint16_t read;              // bytes read since the last START
+    bool interrupt;
+    uint8_t addr;
+    uint8_t data;
+    uint32_t error;
+    uint16_t written;           // bytes since the last START, address included
+    simDevice_t* device;
+} simMaster_t;
+
+typedef struct {
+    uint32_t address;
+    uint32_t value;
+} simRegister_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/********************************Public Variables***********************************/
+
+uint32_t SystemTime = 0;
+tcb_t* CurrentlyRunningThread = 0;
+
+/********************************Public Variables***********************************/
+
+/*******************************Private Variables***********************************/
+
+static simDevice_t devices[] = {
+    { .addr = DEV_PLAIN,     .present = true, .nackAt = SIM_NO_NACK },
+    { .addr = DEV_INCREMENT, .present = true, .nackAt = SIM_NO_NACK, .incrementOnFlag = true },
+    { .addr = DEV_NACK,      .present = true, .nackAt = 2 },
+    { .addr = DEV_LOW,       .present = true, .nackAt = SIM_NO_NACK },
+    { .addr = DEV_NORMAL,    .present = true, .nackAt = SIM_NO_NACK },
+    { .addr = DEV_HIGH,      .present = true, .nackAt = SIM_NO_NACK },
+    { .addr = DEV_SLOW,      .present = true, .nackAt = SIM_NO_NACK },
+};
+
+static simMaster_t masters[I2C_BUS_COUNT] = {
+    { .base = I2C_A_BASE },
+    { .base = I2C_B_BASE },
+};
+
+static simRegister_t registers[SIM_REGISTERS];
+static uint8_t registerCount = 0;
+
+static uint64_t timeNS = 0;
+static char wire[SIM_WIRE_LENGTH];
+static size_t wireLength = 0;
+static uint32_t commands = 0;
+static uint32_t violations = 0;
+static uint32_t failures = 0;
+static bool verbose = false;
+
+// Completion order of the queued priority scenario
+static uint8_t completed[8];
+static uint8_t completedCount = 0;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// Log
+// Appends to the wire log.
+// Return: void
+static void Log(const char* format, ...) {
+    va_list args;
+
+    va_start(args, format);
+    wireLength += vsnprintf(&wire[wireLength], sizeof(wire) - wireLength, format, args);
+    va_end(args);
+    if (wireLength >= sizeof(wire)) {
+        wireLength = sizeof(wire) - 1;
+    }
+}
+
+// Violation
+// Counts protocol misuse the hardware would not forgive.
+// Return: void
+static void Violation(const char* what) {
+    violations++;
+    printf("  violation: %s\n", what);
+}
+
+// Master
+// Return: simMaster_t*, model of a module
+static simMaster_t* Master(uint32_t base) {
+    return (base == I2C_B_BASE) ? &masters[1] : &masters[0];
+}
+
+// Device
+// Return: simDevice_t*, device answering an address, 0 if none does
+static simDevice_t* Device(uint8_t addr) {
+    uint8_t i = 0;
+
+    for (i = 0; i < sizeof(devices) / sizeof(devices[0]); i++) {
+        if (devices[i].addr == addr && devices[i].present) {
+            return &devices[i];
+        }
+    }
+    return 0;
+}
+
+// Clock
+// Moves time on by bits at the rate programmed into MTPR.
+// Return: void
+static void Clock(simMaster_t* m, uint32_t bits) {
+    uint32_t tpr = HWREG(m->base + I2C_O_MTPR);
+    uint64_t speed = SIM_CLOCK / (20 * (tpr + 1));
+
+    timeNS += (bits * 1000000000ULL) / speed;
+}
+
+// Reset
+// Clears the bus, the devices' registers and the log between scenarios.
+// Return: void
+static void Reset(void) {
+    uint8_t i = 0;
+    int r = 0;
+
+    for (i = 0; i < sizeof(devices) / sizeof(devices[0]); i++) {
+        devices[i].pointer = 0;
+        for (r = 0; r < 256; r++) {
+            devices[i].regs[r] = (uint8_t)(r * 7 + devices[i].addr);
+        }
+    }
+    wireLength = 0;
+    wire[0] = '\0';
+    commands = 0;
+    violations = 0;
+    completedCount = 0;
+    I2C_ResetStats();
+}
+
+// Check
+// Compares a scenario's bus traffic with what was expected.
+// Return: void
+static void Check(const char* name, const char* expected, uint32_t expectedCommands, bool ok) {
+    // The log starts with a space before the first START
+    const char* got = (wire[0] == ' ') ? &wire[1] : wire;
+    bool pass = ok && !strcmp(got, expected) && commands == expectedCommands && violations == 0;
+
+    printf("%s %s\n", pass ? "PASS" : "FAIL", name);
+    if (!pass || verbose) {
+        printf("  expected %s, %u commands\n  got      %s, %u commands\n", expected, expectedCommands, got,
+               commands);
+    }
+    failures += !pass;
+}
+
+// Byte
+// Return: const char*, a register value as the log shows it
+static const char* Byte(uint8_t addr, uint8_t reg, bool nack) {
+    static char text[8][8];
+    static uint8_t next = 0;
+    char* out = text[next++ % 8];
+
+    snprintf(out, sizeof(text[0]), "%02x%s", Device(addr)->regs[reg], nack ? "!" : "");
+    return out;
+}
+
+// Record
+// Completion callback of the queued priority scenario.
+// Return: void
+static void Record(i2cTransaction_t* transaction) {
+    completed[completedCount++] = transaction->writeData[0];
+}
+
+// DeviceStats
+// Return: bool, false if the device has no statistics on module A
+static bool DeviceStats(uint8_t addr, i2cDeviceStats_t* stats) {
+    uint8_t i = 0;
+
+    for (i = 0; i <= I2C_GetDeviceCount(I2C_A_BASE); i++) {
+        if (I2C_GetDeviceStats(I2C_A_BASE, i, stats) && (stats->addr == addr || i == I2C_GetDeviceCount(I2C_A_BASE))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*******************************Private Functions***********************************/
+
+/*****************************Simulated Peripheral**********************************/
+
+// Log format: S and Sr are a start and a repeated start, an address shows
+// its direction as W or R, bytes are hex, ! marks a NACK (the device's on
+// an address or written byte, the master's on a read byte), P a stop.
+
+volatile uint32_t* SimRegister(uint32_t address) {
+    uint8_t i = 0;
+
+    for (i = 0; i < registerCount; i++) {
+        if (registers[i].address == address) {
+            return &registers[i].value;
+        }
+    }
+    if (registerCount == SIM_REGISTERS) {
+        fprintf(stderr, "register file full at 0x%08x\n", address);
+        exit(1);
+    }
+    registers[registerCount].address = address;
+    registers[registerCount].value = 0;
+    return &registers[registerCount++].value;
+}
+
+void I2CMasterSlaveAddrSet(uint32_t ui32Base, uint8_t ui8SlaveAddr, bool bReceive) {
+    simMaster_t* m = Master(ui32Base);
+
+    m->addr = ui8SlaveAddr;
+    m->receive = bReceive;
+}
+
+void I2CMasterDataPut(uint32_t ui32Base, uint8_t ui8Data) {
+    Master(ui32Base)->data = ui8Data;
+}
+
+uint32_t I2CMasterDataGet(uint32_t ui32Base) {
+    return Master(ui32Base)->data;
+}
+
+uint32_t I2CMasterErr(uint32_t ui32Base) {
+    return Master(ui32Base)->error;
+}
+
+void I2CMasterControl(uint32_t ui32Base, uint32_t ui32Cmd) {
+    simMaster_t* m = Master(ui32Base);
+    simDevice_t* d = 0;
+
+    commands++;
+    if (m->interrupt) {
+        Violation("command before the last one was serviced");
+    }
+    m->error = I2C_MASTER_ERR_NONE;
+
+    if (ui32Cmd & SIM_CMD_START) {
+        Log(m->held ? " Sr" : " S");
+        m->held = true;
+        m->device = Device(m->addr);
+        m->written = 1;
+        m->read = 0;
+        m->lastNacked = false;
+        Clock(m, 10);
+        Log(" %02x%c%s", m->addr, m->receive ? 'R' : 'W', m->device ? "" : "!");
+        if (m->device == 0) {
+            m->error = I2C_MASTER_ERR_ADDR_ACK;
+        }
+    } else if ((ui32Cmd & SIM_CMD_RUN) && !m->held) {
+        Violation("CONT with no transfer open");
+    }
+
+    d = m->device;
+    if ((ui32Cmd & SIM_CMD_RUN) && m->held && m->error == I2C_MASTER_ERR_NONE) {
+        if (!m->receive) {
+            if (m->written == 1) {
+                m->increment = !d->incrementOnFlag || (m->data & INCREMENT_FLAG);
+                d->pointer = d->incrementOnFlag ? (m->data & ~INCREMENT_FLAG) : m->data;
+            } else {
+                d->regs[d->pointer] = m->data;
+                d->pointer += m->increment;
+            }
+            Log(" %02x", m->data);
+            if (d->nackAt == m->written) {
+                m->error = I2C_MASTER_ERR_DATA_ACK;
+                Log("!");
+            }
+            m->written++;
+        } else {
+            if (m->lastNacked) {
+                Violation("read after the master NACKed");
+            }
+            m->data = d->regs[d->pointer++];
+            m->read++;
+            m->lastNacked = !(ui32Cmd & SIM_CMD_ACK);
+            Log(" %02x%s", m->data, m->lastNacked ? "!" : "");
+            if ((ui32Cmd & SIM_CMD_STOP) && !m->lastNacked) {
+                Violation("read ended without a NACK");
+            }
+        }
+        Clock(m, 9);
+    }
+
+    if (ui32Cmd & SIM_CMD_STOP) {
+        if (!m->held) {
+            Violation("STOP with no transfer open");
+        }
+        if (m->held && m->receive && m->read > 0 && !m->lastNacked) {
+            Violation("read stopped without a NACK");
+        }
+        Log(" P");
+        m->held = false;
+        Clock(m, 1);
+    }
+
+    m->interrupt = true;
+}
+
+bool I2CMasterIntStatus(uint32_t ui32Base, bool bMasked) {
+    (void)bMasked;
+    return Master(ui32Base)->interrupt;
+}
+
+void I2CMasterIntClear(uint32_t ui32Base) {
+    Master(ui32Base)->interrupt = false;
+}
+
+void I2CMasterIntEnable(uint32_t ui32Base) {
+    (void)ui32Base;
+}
+
+void I2CMasterInitExpClk(uint32_t ui32Base, uint32_t ui32I2CClk, bool bFast) {
+    (void)ui32Base;
+    (void)ui32I2CClk;
+    (void)bFast;
+}
+
+uint32_t SysCtlClockGet(void) {
+    return SIM_CLOCK;
+}
+
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral) {
+    (void)ui32Peripheral;
+}
+
+void GPIOPinConfigure(uint32_t ui32PinConfig) {
+    (void)ui32PinConfig;
+}
+
+void GPIOPinTypeI2C(uint32_t ui32Port, uint8_t ui8Pins) {
+    (void)ui32Port;
+    (void)ui8Pins;
+}
+
+void GPIOPinTypeI2CSCL(uint32_t ui32Port, uint8_t ui8Pins) {
+    (void)ui32Port;
+    (void)ui8Pins;
+}
+
+void IntRegister(uint32_t ui32Interrupt, void (*pfnHandler)(void)) {
+    (void)ui32Interrupt;
+    (void)pfnHandler;
+}
+
+void IntPrioritySet(uint32_t ui32Interrupt, uint8_t ui8Priority) {
+    (void)ui32Interrupt;
+    (void)ui8Priority;
+}
+
+void IntEnable(uint32_t ui32Interrupt) {
+    (void)ui32Interrupt;
+}
+
+uint32_t CPUprimask(void) {
+    return 0;
+}
+
+int32_t StartCriticalSection() {
+    return 0;
+}
+
+void EndCriticalSection(int32_t IBit_State) {
+    (void)IBit_State;
+}
+
+uint32_t G8RTOS_GetTimeUS(void) {
+    return (uint32_t)(timeNS / 1000);
+}
+
+// No thread is running, so transfers never block on these
+void G8RTOS_InitSemaphore(semaphore_t* s, int32_t value) {
+    *s = value;
+}
+
+void G8RTOS_WaitSemaphore(semaphore_t* s) {
+    if (*s <= 0) {
+        Violation("semaphore wait would block");
+    }
+    (*s)--;
+}
+
+void G8RTOS_SignalSemaphore(semaphore_t* s) {
+    (*s)++;
+}
+
+/*****************************Simulated Peripheral**********************************/
+
+/*********************************Scenarios*****************************************/
+
+// Scenario_Single
+// Lone bytes go out as single commands, one each.
+// Return: void
+static void Scenario_Single(void) {
+    char expected[64];
+    uint8_t byte = 0;
+
+    Reset();
+    I2C_WriteSingle(I2C_A_BASE, DEV_PLAIN, 0x5a);
+    Check("single send", "S 20W 5a P", 1, Device(DEV_PLAIN)->pointer == 0x5a);
+
+    Reset();
+    Device(DEV_PLAIN)->pointer = 0x5a;
+    snprintf(expected, sizeof(expected), "S 20R %s P", Byte(DEV_PLAIN, 0x5a, true));
+    byte = I2C_ReadSingle(I2C_A_BASE, DEV_PLAIN);
+    Check("single receive", expected, 1, byte == Device(DEV_PLAIN)->regs[0x5a]);
+}
+
+// Scenario_Burst
+// Several bytes go out as START, CONT and FINISH, one command per byte.
+// Return: void
+static void Scenario_Burst(void) {
+    uint8_t data[] = { 0x10, 0x01, 0x02, 0x03 };
+    uint8_t read[3] = { 0 };
+    char expected[64];
+    simDevice_t* d = Device(DEV_INCREMENT);
+
+    Reset();
+    data[0] |= INCREMENT_FLAG;
+    I2C_WriteMultiple(I2C_A_BASE, DEV_INCREMENT, data, sizeof(data));
+    Check("burst send", "S 21W 90 01 02 03 P", 4, d->regs[0x10] == 1 && d->regs[0x11] == 2 && d->regs[0x12] == 3);
+
+    Reset();
+    d->pointer = 0x40;
+    snprintf(expected, sizeof(expected), "S 21R %s %s %s P", Byte(DEV_INCREMENT, 0x40, false),
+             Byte(DEV_INCREMENT, 0x41, false), Byte(DEV_INCREMENT, 0x42, true));
+    I2C_ReadMultiple(I2C_A_BASE, DEV_INCREMENT, read, sizeof(read));
+    Check("burst receive", expected, 3, !memcmp(read, &d->regs[0x40], sizeof(read)));
+}
+
+// Scenario_WriteRead
+// A register read: the write burst stays open and the read follows a
+// repeated start.
+// Return: void
+static void Scenario_WriteRead(void) {
+    uint8_t reg = 0x30;
+    uint8_t read[4] = { 0 };
+    char expected[64];
+    bool ok = false;
+
+    Reset();
+    snprintf(expected, sizeof(expected), "S 20W 30 Sr 20R %s %s %s %s P", Byte(DEV_PLAIN, 0x30, false),
+             Byte(DEV_PLAIN, 0x31, false), Byte(DEV_PLAIN, 0x32, false), Byte(DEV_PLAIN, 0x33, true));
+    ok = I2C_WriteRead(I2C_A_BASE, DEV_PLAIN, &reg, 1, read, sizeof(read));
+    Check("write then read", expected, 5, ok && !memcmp(read, &Device(DEV_PLAIN)->regs[0x30], sizeof(read)));
+
+    Reset();
+    snprintf(expected, sizeof(expected), "S 20W 30 Sr 20R %s P", Byte(DEV_PLAIN, 0x30, true));
+    ok = I2C_WriteRead(I2C_A_BASE, DEV_PLAIN, &reg, 1, read, 1);
+    Check("write then single read", expected, 2, ok && read[0] == Device(DEV_PLAIN)->regs[0x30]);
+}
+
+// Scenario_Nack
+// A NACK in a burst ends it with an error stop, a single command stops by
+// itself, and the bus is usable afterwards.
+// Return: void
+static void Scenario_Nack(void) {
+    uint8_t data[] = { 0x00, 0x11, 0x22 };
+    uint8_t read[2] = { 0 };
+    i2cDeviceStats_t stats;
+    bool ok = true;
+
+    Reset();
+    ok = I2C_WriteRead(I2C_A_BASE, DEV_ABSENT, data, sizeof(data), 0, 0);
+    Check("address NACK in a send burst", "S 50W! P", 2, !ok && DeviceStats(DEV_ABSENT, &stats) && stats.errors == 1);
+
+    Reset();
+    ok = I2C_WriteRead(I2C_A_BASE, DEV_ABSENT, 0, 0, read, sizeof(read));
+    Check("address NACK in a receive burst", "S 50R! P", 2, !ok);
+
+    Reset();
+    ok = I2C_WriteRead(I2C_A_BASE, DEV_ABSENT, data, 1, 0, 0);
+    Check("address NACK of a single send", "S 50W! P", 1, !ok);
+
+    Reset();
+    ok = I2C_WriteRead(I2C_A_BASE, DEV_NACK, data, sizeof(data), 0, 0);
+    Check("data NACK in a send burst", "S 22W 00 11! P", 3, !ok);
+
+    Reset();
+    ok = I2C_WriteRead(I2C_A_BASE, DEV_NACK, data, sizeof(data), read, sizeof(read));
+    Check("data NACK before a repeated start", "S 22W 00 11! P", 3, !ok);
+
+    Reset();
+    ok = I2C_WriteRead(I2C_A_BASE, DEV_PLAIN, data, 2, 0, 0);
+    Check("bus usable after errors", "S 20W 00 11 P", 2, ok);
+}
+
+// Scenario_Priority
+// Transactions queued behind an active one run by device priority, in
+// submission order within a priority, and the active one is not cut.
+// Return: void
+static void Scenario_Priority(void) {
+    static const uint8_t order[] = { 1, 4, 6, 3, 2, 5 };
+    static const uint8_t addr[] = { DEV_NORMAL, DEV_LOW, DEV_NORMAL, DEV_HIGH, DEV_LOW, DEV_HIGH };
+    uint8_t data[6][2];
+    i2cTransaction_t t[6];
+    uint32_t serviced = 0;
+    bool ok = true;
+    uint8_t i = 0;
+
+    I2C_SetDevicePriority(I2C_A_BASE, DEV_LOW, I2C_PRIORITY_LOW);
+    I2C_SetDevicePriority(I2C_A_BASE, DEV_HIGH, I2C_PRIORITY_HIGH);
+
+    Reset();
+    memset(t, 0, sizeof(t));
+    for (i = 0; i < 6; i++) {
+        data[i][0] = i + 1;
+        data[i][1] = 0xEE;
+        t[i].addr = addr[i];
+        t[i].writeData = data[i];
+        t[i].writeLength = 2;
+        t[i].callback = Record;
+        I2C_Submit(I2C_A_BASE, &t[i]);
+    }
+
+    while (completedCount < 6 && serviced++ < SIM_MAX_SERVICE) {
+        I2C_A_Handler();
+    }
+
+    ok = (completedCount == 6) && !memcmp(completed, order, sizeof(order));
+    Check("queued priority order",
+          "S 24W 01 ee P S 25W 04 ee P S 25W 06 ee P S 24W 03 ee P S 23W 02 ee P S 23W 05 ee P", 12, ok);
+    if (!ok) {
+        printf("  completion order");
+        for (i = 0; i < completedCount; i++) {
+            printf(" %u", completed[i]);
+        }
+        printf("\n");
+    }
+}
+
+// Scenario_Merge
+// Runs of consecutive registers share a burst on an auto-incrementing
+// device, and go out one by one otherwise.
+// Return: void
+static void Scenario_Merge(void) {
+    static const uint8_t regs[] = { 0x10, 0x11, 0x12, 0x20, 0x21, 0x30 };
+    static const uint8_t values[] = { 0xA0, 0xA1, 0xA2, 0xB0, 0xB1, 0xC0 };
+    simDevice_t* d = Device(DEV_INCREMENT);
+    bool ok = true;
+    uint8_t i = 0;
+
+    I2C_SetDeviceIncrement(I2C_A_BASE, DEV_INCREMENT, INCREMENT_FLAG);
+
+    Reset();
+    ok = I2C_WriteRegisters(I2C_A_BASE, DEV_INCREMENT, regs, values, sizeof(regs));
+    for (i = 0; i < sizeof(regs); i++) {
+        ok = ok && d->regs[regs[i]] == values[i];
+    }
+    Check("merged register writes", "S 21W 90 a0 a1 a2 P S 21W a0 b0 b1 P S 21W 30 c0 P", 9, ok);
+
+    d = Device(DEV_PLAIN);
+    Reset();
+    ok = I2C_WriteRegisters(I2C_A_BASE, DEV_PLAIN, regs, values, 3);
+    for (i = 0; i < 3; i++) {
+        ok = ok && d->regs[regs[i]] == values[i];
+    }
+    Check("unmerged register writes", "S 20W 10 a0 P S 20W 11 a1 P S 20W 12 a2 P", 6, ok);
+}
+
+// Scenario_Speed
+// A device profiled slower than the module has its transactions clocked at
+// its own rate, and the module rate comes back after.
+// Return: void
+static void Scenario_Speed(void) {
+    uint8_t data[] = { 0x01, 0x02 };
+    i2cDeviceStats_t slow;
+    i2cDeviceStats_t plain;
+    bool ok = true;
+
+    I2C_SetDeviceProfile(I2C_A_BASE, DEV_SLOW, I2C_SPEED_100K, "slow");
+    I2C_SetDeviceProfile(I2C_A_BASE, DEV_PLAIN, 0, "plain");
+
+    Reset();
+    ok &= I2C_WriteRead(I2C_A_BASE, DEV_SLOW, data, sizeof(data), 0, 0);
+    ok &= I2C_WriteRead(I2C_A_BASE, DEV_PLAIN, data, sizeof(data), 0, 0);
+    ok &= DeviceStats(DEV_SLOW, &slow) && DeviceStats(DEV_PLAIN, &plain);
+
+    // 29 bits each: start, three 9 bit bytes, stop. 72.5 us at 400 kHz
+    // lands on 72 or 73 whole microseconds.
+    ok &= (slow.busyUS == 290) && (plain.busyUS == 72 || plain.busyUS == 73);
+    Check("per-device clock rate", "S 26W 01 02 P S 20W 01 02 P", 4, ok);
+    if (!ok || verbose) {
+        printf("  busy %u us at 100 kHz, %u us at 400 kHz\n", slow.busyUS, plain.busyUS);
+    }
+}
+
+/*********************************Scenarios*****************************************/
+
+int main(int argc, char** argv) {
+    int a = 0;
+
+    for (a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-v")) {
+            verbose = true;
+        } else {
+            fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    I2C_Init(I2C_A_BASE);
+
+    Scenario_Single();
+    Scenario_Burst();
+    Scenario_WriteRead();
+    Scenario_Nack();
+    Scenario_Priority();
+    Scenario_Merge();
+    Scenario_Speed();
+
+    printf("%u failed\n", failures);
+    return failures ? 1 : 0;
+}
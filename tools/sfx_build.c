@@ -0,0 +1,234 @@
+// sfx_build.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host tool rendering the sound effect clips with the game's synth and
+// writing them as flash data for the mixer. Each clip is a short note
+// script, rendered at SFX_CLIP_RATE, trimmed, normalized and encoded to
+// IMA-ADPCM.
+// Build from the repository root:
+//   cc -O2 -I. -o sfx_build tools/sfx_build.c Game/src/tetris_synth.c Game/src/tetris_adpcm.c -lm
+// Usage: sfx_build Game/src/tetris_sfx_clips.c
+
+/************************************Includes***************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "Game/tetris_synth.h"
+#include "Game/tetris_sfx.h"
+#include "Game/tetris_adpcm.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define CLIP_MAX_SAMPLES        (2 * SFX_CLIP_RATE)
+#define CLIP_MAX_NOTES          8
+
+// Clips peak here, leaving the encoder room to overshoot
+#define CLIP_PEAK               30000
+
+// Samples this quiet or quieter count as silence at the end
+#define CLIP_TRIM_LEVEL         256
+
+/*************************************Defines***************************************/
+
+/****************************Data Structure Definitions*****************************/
+
+typedef struct {
+    uint8_t note;                   // MIDI note
+    uint16_t ms;                    // held for, then released
+} clipNote_t;
+
+typedef struct {
+    const char* name;
+    synthInstrument_t instrument;
+    clipNote_t notes[CLIP_MAX_NOTES];
+} clipScript_t;
+
+/****************************Data Structure Definitions*****************************/
+
+/*******************************Private Variables***********************************/
+
+// Indexed by sfxId_t
+static const clipScript_t scripts[SFX_CLIPS] = {
+    {"rotate", {SYNTH_WAVE_SQUARE, 1, 24, 0, 8, 32767},
+     {{84, 16}}},
+    {"lock", {SYNTH_WAVE_TRIANGLE, 1, 60, 0, 20, 32767},
+     {{43, 16}, {36, 40}}},
+    {"line", {SYNTH_WAVE_SQUARE, 2, 80, 8192, 40, 32767},
+     {{79, 48}, {84, 48}, {88, 48}, {91, 96}}},
+    {"level", {SYNTH_WAVE_TRIANGLE, 2, 80, 16384, 60, 32767},
+     {{84, 64}, {91, 64}, {96, 160}}},
+    {"tetris", {SYNTH_WAVE_SAW, 2, 60, 16384, 60, 32767},
+     {{72, 40}, {76, 40}, {79, 40}, {84, 40}, {88, 40}, {91, 40}, {96, 200}}},
+    {"gameOver", {SYNTH_WAVE_SQUARE, 4, 200, 12000, 120, 32767},
+     {{76, 160}, {72, 160}, {67, 160}, {64, 160}, {60, 400}}}
+};
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// RenderFor
+// Renders whole control periods covering a duration into a clip.
+// Return: uint32_t, samples rendered
+static uint32_t RenderFor(int16_t* samples, uint32_t done, uint32_t ms) {
+    uint32_t count = (ms * SFX_CLIP_RATE) / 1000;
+
+    count = ((count + SYNTH_CONTROL_SAMPLES - 1) / SYNTH_CONTROL_SAMPLES) * SYNTH_CONTROL_SAMPLES;
+    if (done + count > CLIP_MAX_SAMPLES) {
+        count = CLIP_MAX_SAMPLES - done;
+    }
+
+    TetrisSynth_Render(samples + done, (uint16_t)count);
+    return count;
+}
+
+// RenderClip
+// Plays a note script on voice 0 and lets the last note ring out.
+// Return: uint32_t, samples rendered
+static uint32_t RenderClip(const clipScript_t* script, int16_t* samples) {
+    uint32_t done = 0;
+    uint8_t i = 0;
+
+    memset(samples, 0, CLIP_MAX_SAMPLES * sizeof(int16_t));
+    TetrisSynth_Silence();
+
+    for (i = 0; i < CLIP_MAX_NOTES && script->notes[i].ms; i++) {
+        TetrisSynth_NoteOn(0, script->notes[i].note, &script->instrument);
+        done += RenderFor(samples, done, script->notes[i].ms);
+        TetrisSynth_NoteOff(0);
+    }
+
+    while (TetrisSynth_IsActive(0) && done < CLIP_MAX_SAMPLES) {
+        done += RenderFor(samples, done, 1);
+    }
+
+    return done;
+}
+
+// Normalize
+// Scales a clip to CLIP_PEAK and drops the silent tail.
+// Return: uint32_t, samples kept
+static uint32_t Normalize(int16_t* samples, uint32_t count) {
+    int32_t peak = 1;
+    int32_t value = 0;
+    uint32_t length = 0;
+    uint32_t i = 0;
+
+    for (i = 0; i < count; i++) {
+        value = abs(samples[i]);
+        if (value > peak) {
+            peak = value;
+        }
+    }
+
+    for (i = 0; i < count; i++) {
+        value = (samples[i] * CLIP_PEAK) / peak;
+        samples[i] = (int16_t)value;
+        if (abs(value) > CLIP_TRIM_LEVEL) {
+            length = i + 1;
+        }
+    }
+
+    return length;
+}
+
+// SignalToNoise
+// Decodes an encoded clip and compares it with the original.
+// Return: double, SNR in dB
+static double SignalToNoise(const int16_t* samples, const uint8_t* data, uint32_t count) {
+    adpcmDecoder_t decoder;
+    int16_t decoded[ADPCM_BLOCK_SAMPLES];
+    double signal = 0.0;
+    double noise = 0.0;
+    uint32_t done = 0;
+    uint16_t n = 0;
+    uint16_t i = 0;
+
+    TetrisADPCM_Start(&decoder, data, count);
+    while ((n = TetrisADPCM_Decode(&decoder, decoded, ADPCM_BLOCK_SAMPLES)) > 0) {
+        for (i = 0; i < n; i++) {
+            signal += (double)samples[done + i] * samples[done + i];
+            noise += (double)(samples[done + i] - decoded[i]) * (samples[done + i] - decoded[i]);
+        }
+        done += n;
+    }
+
+    return (noise > 0.0) ? 10.0 * log10(signal / noise) : 99.0;
+}
+
+/*******************************Private Functions***********************************/
+
+int main(int argc, char** argv) {
+    static int16_t samples[CLIP_MAX_SAMPLES];
+    static uint8_t data[ADPCM_BYTES(CLIP_MAX_SAMPLES)];
+    uint32_t lengths[SFX_CLIPS];
+    uint32_t total = 0;
+    uint32_t bytes = 0;
+    uint32_t count = 0;
+    uint32_t i = 0;
+    uint8_t id = 0;
+    FILE* file = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s tetris_sfx_clips.c\n", argv[0]);
+        return 1;
+    }
+
+    file = fopen(argv[1], "w");
+    if (file == 0) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(file,
+            "// tetris_sfx_clips.c\n"
+            "// Date Created: 2026-10-18\n"
+            "// Date Updated: 2026-10-18\n"
+            "// Sound effect clips, IMA-ADPCM at %u Hz. Generated by\n"
+            "// tools/sfx_build.c, edit the scripts there and rebuild this file.\n\n"
+            "/************************************Includes***************************************/\n\n"
+            "#include \"../tetris_sfx.h\"\n\n"
+            "/************************************Includes***************************************/\n\n"
+            "/*******************************Private Variables***********************************/\n",
+            SFX_CLIP_RATE);
+
+    TetrisSynth_Init(SFX_CLIP_RATE);
+
+    for (id = 0; id < SFX_CLIPS; id++) {
+        count = RenderClip(&scripts[id], samples);
+        lengths[id] = Normalize(samples, count);
+        bytes = TetrisADPCM_Encode(samples, lengths[id], data);
+        total += bytes;
+
+        fprintf(file, "\nstatic const uint8_t %sData[%u] = {", scripts[id].name, bytes);
+        for (i = 0; i < bytes; i++) {
+            fprintf(file, "%s0x%02X%s", (i % 16) ? " " : "\n    ", data[i], (i + 1 < bytes) ? "," : "");
+        }
+        fprintf(file, "\n};\n");
+
+        printf("%-10s %5u samples, %4u ms, %5u bytes, SNR %.1f dB\n", scripts[id].name, lengths[id],
+               (lengths[id] * 1000) / SFX_CLIP_RATE, bytes, SignalToNoise(samples, data, lengths[id]));
+    }
+
+    fprintf(file,
+            "\n/*******************************Private Variables***********************************/\n\n"
+            "/********************************Public Variables***********************************/\n\n"
+            "const sfxClip_t sfxClips[SFX_CLIPS] = {\n");
+    for (id = 0; id < SFX_CLIPS; id++) {
+        fprintf(file, "    {%sData, %u, SFX_CLIP_RATE, SFX_FORMAT_ADPCM}%s\n", scripts[id].name, lengths[id],
+                (id + 1 < SFX_CLIPS) ? "," : "");
+    }
+    fprintf(file,
+            "};\n\n"
+            "/********************************Public Variables***********************************/\n");
+
+    fclose(file);
+    printf("%s: %u bytes of clips\n", argv[1], total);
+    return 0;
+}
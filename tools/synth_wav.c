@@ -0,0 +1,109 @@
+// synth_wav.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host tool rendering the game music to a WAV file with the same synth and
+// sequencer code the board runs, for listening and comparing changes.
+// Build from the repository root:
+//   cc -O2 -I. -o synth_wav tools/synth_wav.c Game/src/tetris_synth.c Game/src/tetris_music.c -lm
+// Usage: synth_wav out.wav [seconds] [level] [rate]
+
+/************************************Includes***************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "Game/tetris_music.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define WAV_DEFAULT_SECONDS     30
+#define WAV_DEFAULT_RATE        24000
+#define WAV_BLOCK_SAMPLES       192
+
+/*************************************Defines***************************************/
+
+/*******************************Private Functions***********************************/
+
+// PutLE
+// Writes a little-endian value of 2 or 4 bytes.
+static void PutLE(FILE* file, uint32_t value, uint8_t bytes) {
+    uint8_t i = 0;
+
+    for (i = 0; i < bytes; i++) {
+        fputc((value >> (8 * i)) & 0xFF, file);
+    }
+}
+
+// WriteHeader
+// Writes a 16 bit mono PCM WAV header for a number of samples.
+static void WriteHeader(FILE* file, uint32_t rate, uint32_t samples) {
+    fwrite("RIFF", 1, 4, file);
+    PutLE(file, 36 + samples * 2, 4);
+    fwrite("WAVEfmt ", 1, 8, file);
+    PutLE(file, 16, 4);             // fmt chunk size
+    PutLE(file, 1, 2);              // PCM
+    PutLE(file, 1, 2);              // mono
+    PutLE(file, rate, 4);
+    PutLE(file, rate * 2, 4);       // bytes per second
+    PutLE(file, 2, 2);              // bytes per frame
+    PutLE(file, 16, 2);             // bits per sample
+    fwrite("data", 1, 4, file);
+    PutLE(file, samples * 2, 4);
+}
+
+/*******************************Private Functions***********************************/
+
+int main(int argc, char** argv) {
+    uint32_t block[WAV_BLOCK_SAMPLES / 2];
+    int16_t* samples = (int16_t*)block;
+    uint32_t seconds = WAV_DEFAULT_SECONDS;
+    uint32_t rate = WAV_DEFAULT_RATE;
+    uint8_t level = 1;
+    uint32_t total = 0;
+    uint32_t written = 0;
+    uint16_t i = 0;
+    FILE* file = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s out.wav [seconds] [level] [rate]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 2) {
+        seconds = (uint32_t)atoi(argv[2]);
+    }
+    if (argc > 3) {
+        level = (uint8_t)atoi(argv[3]);
+    }
+    if (argc > 4) {
+        rate = (uint32_t)atoi(argv[4]);
+    }
+
+    file = fopen(argv[1], "wb");
+    if (file == 0) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    TetrisMusic_Init(rate);
+    TetrisMusic_SetLevel(level);
+    TetrisMusic_Play();
+
+    total = ((seconds * rate) / WAV_BLOCK_SAMPLES) * WAV_BLOCK_SAMPLES;
+    WriteHeader(file, rate, total);
+
+    for (written = 0; written < total; written += WAV_BLOCK_SAMPLES) {
+        memset(block, 0, sizeof(block));
+        TetrisMusic_Render(samples, WAV_BLOCK_SAMPLES);
+        for (i = 0; i < WAV_BLOCK_SAMPLES; i++) {
+            PutLE(file, (uint16_t)samples[i], 2);
+        }
+    }
+
+    fclose(file);
+    printf("%s: %u samples at %u Hz, level %u\n", argv[1], total, rate, level);
+    return 0;
+}
@@ -0,0 +1,470 @@
+// telemetry_decode.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host tool reading the console of the board, printing telemetry frames
+// as text and passing the console's own text through. Damaged frames and
+// gaps in the sequence are counted. -t runs the encoder and decoder on
+// the host instead and reports their speed and the event rate a baud
+// rate can carry. Lines typed on stdin go to the board's command console
+// when reading a device, with the board's echo turned off since the
+// terminal already shows them.
+// Build from the repository root:
+//   cc -O2 -I. -o telemetry_decode tools/telemetry_decode.c Game/src/tetris_telemetry.c Game/src/tetris_frame.c driverlib/sw_crc.c
+// Usage: telemetry_decode [-b baud] [-B] [device | -]
+//        telemetry_decode -t [-b baud]
+
+/************************************Includes***************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <poll.h>
+
+#include "Game/tetris_telemetry.h"
+#include "Game/tetris_input.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DEFAULT_BAUD            115200
+
+// Frames encoded and decoded by the self-test
+#define TEST_FRAMES             200000
+#define TEST_RING               256     // frames kept encoded at once
+
+// Console text waits for the delimiter of the next frame, or this long
+#define TEXT_IDLE_MS            100
+
+// Sent to the console before the first typed line
+#define CONSOLE_SETUP           "echo off\r"
+
+/*************************************Defines***************************************/
+
+/*******************************Private Variables***********************************/
+
+static const char* sourceNames[INPUT_SOURCES] = {"stick", "button", "motion", "mic"};
+static const char* kindNames[] = {"press", "repeat", "release", "?"};
+static const char* codeNames[] = {"left", "right", "down", "up"};
+static const char cellNames[] = ".IOTSZJL+X";
+
+static uint8_t board[TELEMETRY_BOARD_ROWS][TELEMETRY_BOARD_COLUMNS];
+static bool showBoard = false;
+
+static uint32_t goodFrames = 0;
+static uint32_t badFrames = 0;
+static uint32_t lostFrames = 0;
+static int lastSequence = -1;
+
+// Thread counters of the last report, for the load over the interval
+static telemetryThread_t lastThreads[TELEMETRY_MAX_THREADS];
+static uint16_t lastThreadsTime = 0;
+static uint32_t lastThreadCount = 0;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// OpenSerial
+// Opens a serial device raw at a baud rate, for reading and for commands.
+// Return: int, file descriptor, -1 on error
+static int OpenSerial(const char* path, uint32_t baud) {
+    struct termios tty;
+    speed_t speed = B115200;
+    int fd = open(path, O_RDWR | O_NOCTTY);
+
+    if (fd < 0) {
+        perror(path);
+        return -1;
+    }
+
+    switch (baud) {
+    case 9600:    speed = B9600;    break;
+    case 57600:   speed = B57600;   break;
+    case 115200:  speed = B115200;  break;
+    case 230400:  speed = B230400;  break;
+    case 460800:  speed = B460800;  break;
+    case 921600:  speed = B921600;  break;
+    case 1000000: speed = B1000000; break;
+    case 2000000: speed = B2000000; break;
+    case 3000000: speed = B3000000; break;
+    case 4000000: speed = B4000000; break;
+    default:
+        fprintf(stderr, "%u baud not supported\n", baud);
+        close(fd);
+        return -1;
+    }
+
+    // Pipes and files are read as they are
+    if (tcgetattr(fd, &tty) == 0) {
+        cfmakeraw(&tty);
+        cfsetispeed(&tty, speed);
+        cfsetospeed(&tty, speed);
+        tty.c_cc[VMIN] = 1;
+        tty.c_cc[VTIME] = 0;
+        tcsetattr(fd, TCSANOW, &tty);
+    }
+
+    return fd;
+}
+
+// PrintBoard
+// Draws the board as text, one character per cell.
+// Return: void
+static void PrintBoard(void) {
+    uint8_t i = 0;
+    uint8_t j = 0;
+
+    for (i = 0; i < TELEMETRY_BOARD_ROWS; i++) {
+        putchar('|');
+        for (j = 0; j < TELEMETRY_BOARD_COLUMNS; j++) {
+            putchar((board[i][j] < sizeof(cellNames) - 1) ? cellNames[board[i][j]] : '?');
+        }
+        puts("|");
+    }
+}
+
+// PrintFrame
+// Prints a decoded frame.
+// Param const uint8_t* "raw": header and payload
+// Param int16_t "length": bytes
+// Return: void
+static void PrintFrame(const uint8_t* raw, int16_t length) {
+    const uint8_t* payload = raw + TELEMETRY_HEADER_BYTES;
+    uint16_t size = (uint16_t)(length - TELEMETRY_HEADER_BYTES);
+    uint16_t time = (uint16_t)(raw[2] | (raw[3] << 8));
+    telemetryScore_t score;
+    telemetryThread_t threads[TELEMETRY_MAX_THREADS];
+    uint32_t event = 0;
+    uint32_t count = 0;
+    uint32_t runUS = 0;
+    uint16_t elapsed = 0;
+    uint16_t rows = 0;
+    uint16_t n = 2;
+    uint32_t i = 0;
+    uint8_t j = 0;
+
+    if (lastSequence >= 0) {
+        lostFrames += (uint8_t)(raw[1] - lastSequence - 1);
+    }
+    lastSequence = raw[1];
+    goodFrames++;
+
+    switch (raw[0]) {
+    case TELEMETRY_SCORE:
+        if (size < sizeof(score)) {
+            break;
+        }
+        memcpy(&score, payload, sizeof(score));
+        printf("%5u score %u, lines %u, level %u, pieces %u%s%s%s\n", time, score.score, score.lines,
+               score.level, score.pieces, (score.flags & TELEMETRY_FLAG_GAME_OVER) ? ", game over" : "",
+               (score.flags & TELEMETRY_FLAG_PAUSED) ? ", paused" : "",
+               (score.flags & TELEMETRY_FLAG_AUTOPLAY) ? ", autoplay" : "");
+        break;
+
+    case TELEMETRY_BOARD:
+        if (size < 2) {
+            break;
+        }
+        rows = (uint16_t)(payload[0] | (payload[1] << 8));
+        for (i = 0; i < TELEMETRY_BOARD_ROWS; i++) {
+            if (!(rows & (1 << i)) || n + TELEMETRY_ROW_BYTES > size) {
+                continue;
+            }
+            for (j = 0; j < TELEMETRY_ROW_BYTES; j++) {
+                board[i][2 * j] = payload[n + j] & 0x0F;
+                board[i][2 * j + 1] = payload[n + j] >> 4;
+            }
+            n += TELEMETRY_ROW_BYTES;
+            count++;
+        }
+        if (showBoard) {
+            printf("%5u board, %u rows\n", time, count);
+            PrintBoard();
+        }
+        break;
+
+    case TELEMETRY_THREADS:
+        count = size / sizeof(telemetryThread_t);
+        if (count > TELEMETRY_MAX_THREADS) {
+            count = TELEMETRY_MAX_THREADS;
+        }
+        memcpy(threads, payload, count * sizeof(telemetryThread_t));
+        elapsed = (uint16_t)(time - lastThreadsTime);
+        printf("%5u threads\n", time);
+        for (i = 0; i < count; i++) {
+            runUS = 0;
+            for (j = 0; j < lastThreadCount; j++) {
+                if (lastThreads[j].id == threads[i].id) {
+                    runUS = threads[i].runTimeUS - lastThreads[j].runTimeUS;
+                }
+            }
+            printf("      %-8.8s id %3u pri %3u %-7s %10u us %8u switches",
+                   threads[i].name, threads[i].id, threads[i].priority,
+                   (threads[i].state == 2) ? "blocked" : ((threads[i].state == 1) ? "asleep" : "ready"),
+                   threads[i].runTimeUS, threads[i].switches);
+            if (lastThreadCount && elapsed) {
+                printf(", %5.1f%%", runUS / (elapsed * 10.0));
+            }
+            putchar('\n');
+        }
+        memcpy(lastThreads, threads, sizeof(threads));
+        lastThreadCount = count;
+        lastThreadsTime = time;
+        break;
+
+    case TELEMETRY_INPUT:
+        for (i = 0; i + sizeof(uint32_t) <= size; i += sizeof(uint32_t)) {
+            memcpy(&event, payload + i, sizeof(event));
+            printf("%5u input %s %s %s x%u\n", INPUT_EVENT_TIME(event),
+                   (INPUT_EVENT_SOURCE(event) < INPUT_SOURCES) ? sourceNames[INPUT_EVENT_SOURCE(event)] : "?",
+                   kindNames[(INPUT_EVENT_KIND(event) < 3) ? INPUT_EVENT_KIND(event) : 3],
+                   (INPUT_EVENT_SOURCE(event) == INPUT_SOURCE_BUTTON) ?
+                       ((const char*[]){"SW1", "SW2", "SW3", "SW4"})[INPUT_EVENT_CODE(event) & 3] :
+                       codeNames[INPUT_EVENT_CODE(event) & 3],
+                   INPUT_EVENT_COUNT(event));
+        }
+        break;
+
+    default:
+        printf("%5u type %u, %u bytes\n", time, raw[0], size);
+        break;
+    }
+}
+
+// IsText
+// Return: bool, true if every byte is printable or white space
+static bool IsText(const uint8_t* data, uint16_t length) {
+    uint16_t i = 0;
+
+    for (i = 0; i < length; i++) {
+        if (!isprint(data[i]) && data[i] != '\r' && data[i] != '\n' && data[i] != '\t') {
+            return false;
+        }
+    }
+    return true;
+}
+
+// PrintText
+// Return: void
+static void PrintText(const uint8_t* data, uint16_t length) {
+    uint16_t i = 0;
+
+    for (i = 0; i < length; i++) {
+        if (data[i] != '\r') {
+            putchar(data[i]);
+        }
+    }
+}
+
+// HandleChunk
+// Decodes the bytes between two delimiters, or passes them through as
+// console text if they aren't a frame.
+// Return: void
+static void HandleChunk(const uint8_t* data, uint16_t length) {
+    uint8_t raw[TELEMETRY_MAX_RAW];
+    int16_t n = 0;
+
+    if (length == 0) {
+        return;
+    }
+
+    n = TetrisTelemetry_Decode(data, length, raw);
+    if (n >= TELEMETRY_HEADER_BYTES) {
+        PrintFrame(raw, n);
+    } else if (IsText(data, length)) {
+        PrintText(data, length);
+    } else {
+        badFrames++;
+    }
+}
+
+// SelfTest
+// Round trips frames through the encoder and decoder and times them.
+// Return: int, 0 if every frame came back intact
+static int SelfTest(uint32_t baud) {
+    static uint8_t frames[TEST_RING][TELEMETRY_MAX_FRAME];
+    uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+    uint8_t raw[TELEMETRY_MAX_RAW];
+    uint16_t lengths[TEST_RING];
+    uint32_t events[TELEMETRY_INPUT_BATCH];
+    uint16_t length = 0;
+    uint16_t size = 0;
+    uint32_t failures = 0;
+    uint32_t i = 0;
+    uint32_t k = 0;
+    int16_t n = 0;
+    clock_t start = 0;
+    double encodeNS = 0.0;
+    double decodeNS = 0.0;
+    double perEvent = 0.0;
+
+    srand(1);
+
+    // Payloads of every size with runs of zeros and of 254+ non-zero bytes
+    for (size = 0; size <= TELEMETRY_MAX_PAYLOAD; size++) {
+        for (k = 0; k < 3; k++) {
+            for (i = 0; i < size; i++) {
+                payload[i] = (k == 0) ? 0 : ((k == 1) ? 0xA5 : (uint8_t)rand());
+            }
+            length = TetrisTelemetry_Encode(TELEMETRY_BOARD, (uint8_t)size, (uint16_t)k, payload, size, frames[0]);
+            for (i = 1; i + 1 < length; i++) {
+                failures += (frames[0][i] == 0);
+            }
+            n = TetrisTelemetry_Decode(&frames[0][1], (uint16_t)(length - 2), raw);
+            if (n != TELEMETRY_HEADER_BYTES + size || memcmp(raw + TELEMETRY_HEADER_BYTES, payload, size)) {
+                failures++;
+            }
+
+            // A flipped bit must be caught
+            if (length > 3) {
+                frames[0][1 + rand() % (length - 2)] ^= (uint8_t)(1 << (rand() % 8));
+                if (TetrisTelemetry_Decode(&frames[0][1], (uint16_t)(length - 2), raw) >= 0 &&
+                    memcmp(raw + TELEMETRY_HEADER_BYTES, payload, size) == 0) {
+                    failures++;
+                }
+            }
+        }
+    }
+
+    // Full input batches, the common frame at high event rates
+    for (i = 0; i < TELEMETRY_INPUT_BATCH; i++) {
+        events[i] = INPUT_EVENT(INPUT_SOURCE_JOYSTICK, INPUT_PRESS, INPUT_LEFT, 1, i * 3);
+    }
+    start = clock();
+    for (i = 0; i < TEST_FRAMES; i++) {
+        k = i % (TEST_RING);
+        events[0] = i;
+        lengths[k] = TetrisTelemetry_Encode(TELEMETRY_INPUT, (uint8_t)i, (uint16_t)i, events, sizeof(events), frames[k]);
+    }
+    encodeNS = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / TEST_FRAMES;
+
+    start = clock();
+    for (i = 0; i < TEST_FRAMES; i++) {
+        k = i % (TEST_RING);
+        n = TetrisTelemetry_Decode(&frames[k][1], (uint16_t)(lengths[k] - 2), raw);
+        if (n != TELEMETRY_HEADER_BYTES + (int16_t)sizeof(events)) {
+            failures++;
+        }
+    }
+    decodeNS = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / TEST_FRAMES;
+
+    perEvent = (double)lengths[0] / TELEMETRY_INPUT_BATCH;
+    printf("round trip: %u failures\n", failures);
+    printf("input batch of %u: %u bytes, %.1f bytes/event\n", TELEMETRY_INPUT_BATCH, lengths[0], perEvent);
+    printf("host encode %.0f ns/frame, decode %.0f ns/frame\n", encodeNS, decodeNS);
+    printf("%u baud carries %.0f events/s\n", baud, (baud / 10.0) / perEvent);
+
+    return failures ? 1 : 0;
+}
+
+/*******************************Private Functions***********************************/
+
+int main(int argc, char** argv) {
+    static uint8_t chunk[4096];
+    uint8_t buffer[256];
+    struct pollfd waiting[2];
+    uint32_t baud = DEFAULT_BAUD;
+    uint16_t length = 0;
+    uint16_t lines = 0;
+    bool test = false;
+    const char* path = "-";
+    ssize_t n = 0;
+    ssize_t i = 0;
+    int fd = 0;
+    int a = 0;
+
+    for (a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-b") && a + 1 < argc) {
+            baud = (uint32_t)strtoul(argv[++a], 0, 10);
+        } else if (!strcmp(argv[a], "-B")) {
+            showBoard = true;
+        } else if (!strcmp(argv[a], "-t")) {
+            test = true;
+        } else if (argv[a][0] == '-' && argv[a][1]) {
+            fprintf(stderr, "usage: %s [-b baud] [-B] [device | -]\n       %s -t [-b baud]\n", argv[0], argv[0]);
+            return 1;
+        } else {
+            path = argv[a];
+        }
+    }
+
+    if (test) {
+        return SelfTest(baud);
+    }
+
+    fd = strcmp(path, "-") ? OpenSerial(path, baud) : STDIN_FILENO;
+    if (fd < 0) {
+        return 1;
+    }
+
+    // Commands only go to a device, a pipe has nowhere to send them
+    waiting[0].fd = fd;
+    waiting[0].events = POLLIN;
+    waiting[1].fd = (fd != STDIN_FILENO) ? STDIN_FILENO : -1;
+    waiting[1].events = POLLIN;
+    if (waiting[1].fd >= 0 && write(fd, CONSOLE_SETUP, strlen(CONSOLE_SETUP)) < 0) {
+        perror("write");
+    }
+
+    while (1) {
+        // Lines of text with no frame after them are shown once the line
+        // goes quiet
+        if (poll(waiting, 2, TEXT_IDLE_MS) == 0) {
+            // A console prompt after the last line waits for the next text
+            for (lines = length; lines > 0 && chunk[lines - 1] != '\n'; lines--);
+            if (lines && IsText(chunk, lines)) {
+                PrintText(chunk, lines);
+                memmove(chunk, &chunk[lines], length - lines);
+                length -= lines;
+                fflush(stdout);
+            }
+            continue;
+        }
+
+        // Typed lines end in CR as a terminal's would
+        if (waiting[1].revents) {
+            n = read(STDIN_FILENO, buffer, sizeof(buffer));
+            if (n <= 0) {
+                waiting[1].fd = -1;
+            } else {
+                for (i = 0; i < n; i++) {
+                    buffer[i] = (buffer[i] == '\n') ? '\r' : buffer[i];
+                }
+                if (write(fd, buffer, n) != n) {
+                    perror("write");
+                }
+            }
+        }
+        if (!waiting[0].revents) {
+            continue;
+        }
+
+        n = read(fd, buffer, sizeof(buffer));
+        if (n <= 0) {
+            break;
+        }
+        for (i = 0; i < n; i++) {
+            if (buffer[i] == 0) {
+                HandleChunk(chunk, length);
+                length = 0;
+            } else if (length < sizeof(chunk)) {
+                chunk[length++] = buffer[i];
+            }
+        }
+        fflush(stdout);
+    }
+
+    if (IsText(chunk, length)) {
+        PrintText(chunk, length);
+    }
+
+    fprintf(stderr, "%u frames, %u damaged, %u lost\n", goodFrames, badFrames, lostFrames);
+    return 0;
+}
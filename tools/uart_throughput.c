@@ -0,0 +1,277 @@
+// uart_throughput.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-18
+// Host side of the UART throughput self-test. Waits for the board's test
+// header, checks the pattern that follows byte for byte and reports the
+// rate it arrived at. -g plays the board instead, writing the same header
+// and pattern paced to the baud rate, so the checker can be run against a
+// pipe or one end of a pseudo-terminal pair without hardware:
+//   socat pty,raw,echo=0,link=/tmp/board pty,raw,echo=0,link=/tmp/host &
+//   uart_throughput -b 921600 /tmp/host & uart_throughput -g -b 921600 /tmp/board
+// Build from the repository root:
+//   cc -O2 -I. -o uart_throughput tools/uart_throughput.c
+// Usage: uart_throughput [-b baud] [device | -]
+//        uart_throughput -g [-b baud] [-n bytes] [device | -]
+
+/************************************Includes***************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+
+#include "MultimodDrivers/multimod_uart.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DEFAULT_BAUD            UART_BAUD
+#define DEFAULT_BYTES           65536
+
+// Bytes written per pacing step of the generator
+#define GENERATE_CHUNK          256
+
+#define HEADER_FORMAT           "UART test %u bytes at %u baud"
+
+/*************************************Defines***************************************/
+
+/*******************************Private Functions***********************************/
+
+// Seconds
+// Return: double, monotonic time in seconds
+static double Seconds(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// OpenPort
+// Opens a serial device raw at a baud rate, or stdin / stdout for "-".
+// Return: int, file descriptor, -1 on error
+static int OpenPort(const char* path, uint32_t baud, bool output) {
+    struct termios tty;
+    speed_t speed = 0;
+    int fd = 0;
+
+    if (!strcmp(path, "-")) {
+        return output ? STDOUT_FILENO : STDIN_FILENO;
+    }
+
+    fd = open(path, (output ? O_WRONLY : O_RDONLY) | O_NOCTTY);
+    if (fd < 0) {
+        perror(path);
+        return -1;
+    }
+
+    switch (baud) {
+    case 115200:  speed = B115200;  break;
+    case 230400:  speed = B230400;  break;
+    case 460800:  speed = B460800;  break;
+    case 921600:  speed = B921600;  break;
+    case 1000000: speed = B1000000; break;
+    case 2000000: speed = B2000000; break;
+    case 3000000: speed = B3000000; break;
+    case 4000000: speed = B4000000; break;
+    default:
+        fprintf(stderr, "%u baud not supported\n", baud);
+        close(fd);
+        return -1;
+    }
+
+    // Pseudo-terminals take the settings and ignore the rate
+    if (tcgetattr(fd, &tty) == 0) {
+        cfmakeraw(&tty);
+        cfsetispeed(&tty, speed);
+        cfsetospeed(&tty, speed);
+        tty.c_cc[VMIN] = 1;
+        tty.c_cc[VTIME] = 0;
+        tcsetattr(fd, TCSANOW, &tty);
+    }
+
+    return fd;
+}
+
+// ReadByte
+// Return: int, the next byte, -1 at the end of input
+static int ReadByte(int fd) {
+    static uint8_t buffer[4096];
+    static ssize_t length = 0;
+    static ssize_t next = 0;
+
+    if (next == length) {
+        length = read(fd, buffer, sizeof(buffer));
+        next = 0;
+        if (length <= 0) {
+            length = 0;
+            return -1;
+        }
+    }
+    return buffer[next++];
+}
+
+// ReadLine
+// Reads up to a newline, dropping carriage returns.
+// Return: bool, false at the end of input
+static bool ReadLine(int fd, char* line, size_t size) {
+    size_t n = 0;
+    int c = 0;
+
+    while ((c = ReadByte(fd)) >= 0) {
+        if (c == '\n') {
+            line[n] = '\0';
+            return true;
+        }
+        if (c != '\r' && n + 1 < size) {
+            line[n++] = (char)c;
+        }
+    }
+    line[n] = '\0';
+    return n > 0;
+}
+
+// Check
+// Finds a test header, checks the pattern after it and prints the rate.
+// Return: int, 0 if the pattern arrived intact
+static int Check(int fd, uint32_t baud) {
+    char line[256];
+    unsigned bytes = 0;
+    unsigned boardBaud = 0;
+    uint32_t errors = 0;
+    uint32_t i = 0;
+    double first = 0.0;
+    double last = 0.0;
+    double rate = 0.0;
+    int c = 0;
+
+    while (ReadLine(fd, line, sizeof(line))) {
+        if (sscanf(line, HEADER_FORMAT, &bytes, &boardBaud) == 2) {
+            break;
+        }
+        puts(line);
+    }
+    if (bytes == 0) {
+        fprintf(stderr, "no test header\n");
+        return 1;
+    }
+    if (boardBaud != baud) {
+        fprintf(stderr, "board sends at %u baud, reading at %u\n", boardBaud, baud);
+    }
+
+    for (i = 0; i < bytes; i++) {
+        c = ReadByte(fd);
+        if (c < 0) {
+            break;
+        }
+        if (i == 0) {
+            first = Seconds();
+        }
+        errors += ((uint8_t)c != UART_TEST_BYTE(i));
+    }
+    last = Seconds();
+
+    // The first byte's own time is not measured
+    rate = (i > 1 && last > first) ? (i - 1) / (last - first) : 0.0;
+    printf("received %u of %u bytes, %u wrong, %.0f B/s, %.1f%% of %u baud\n", i, bytes, errors, rate,
+           100.0 * rate / (baud / 10.0), baud);
+
+    // The board reports its own timing on the next line
+    while (ReadLine(fd, line, sizeof(line))) {
+        if (line[0]) {
+            puts(line);
+            break;
+        }
+    }
+
+    return (i == bytes && errors == 0) ? 0 : 1;
+}
+
+// Generate
+// Writes a header and pattern as the board does, paced to the baud rate.
+// Return: int, 0 on success
+static int Generate(int fd, uint32_t baud, uint32_t bytes) {
+    char line[128];
+    uint8_t chunk[GENERATE_CHUNK];
+    uint32_t sent = 0;
+    uint32_t n = 0;
+    uint32_t i = 0;
+    double start = 0.0;
+    double due = 0.0;
+    double now = 0.0;
+
+    n = (uint32_t)snprintf(line, sizeof(line), HEADER_FORMAT "\r\n", bytes, baud);
+    if (write(fd, line, n) != (ssize_t)n) {
+        perror("write");
+        return 1;
+    }
+
+    start = Seconds();
+    while (sent < bytes) {
+        n = (bytes - sent < GENERATE_CHUNK) ? (bytes - sent) : GENERATE_CHUNK;
+        for (i = 0; i < n; i++) {
+            chunk[i] = UART_TEST_BYTE(sent + i);
+        }
+        if (write(fd, chunk, n) != (ssize_t)n) {
+            perror("write");
+            return 1;
+        }
+        sent += n;
+
+        // 10 bits per byte on the line
+        due = start + sent * 10.0 / baud;
+        now = Seconds();
+        if (due > now) {
+            usleep((useconds_t)((due - now) * 1e6));
+        }
+    }
+
+    now = Seconds() - start;
+    n = (uint32_t)snprintf(line, sizeof(line), "\r\nUART test: %u bytes in %u us, %u B/s of %u, 0 interrupts\r\n",
+                           bytes, (uint32_t)(now * 1e6), (uint32_t)(bytes / now), baud / 10);
+    return (write(fd, line, n) == (ssize_t)n) ? 0 : 1;
+}
+
+/*******************************Private Functions***********************************/
+
+int main(int argc, char** argv) {
+    uint32_t baud = DEFAULT_BAUD;
+    uint32_t bytes = DEFAULT_BYTES;
+    bool generate = false;
+    const char* path = "-";
+    int fd = 0;
+    int a = 0;
+
+    for (a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-b") && a + 1 < argc) {
+            baud = (uint32_t)strtoul(argv[++a], 0, 10);
+        } else if (!strcmp(argv[a], "-n") && a + 1 < argc) {
+            bytes = (uint32_t)strtoul(argv[++a], 0, 10);
+        } else if (!strcmp(argv[a], "-g")) {
+            generate = true;
+        } else if (argv[a][0] == '-' && argv[a][1]) {
+            fprintf(stderr, "usage: %s [-b baud] [device | -]\n       %s -g [-b baud] [-n bytes] [device | -]\n",
+                    argv[0], argv[0]);
+            return 1;
+        } else {
+            path = argv[a];
+        }
+    }
+
+    if (baud == 0) {
+        fprintf(stderr, "baud must be above 0\n");
+        return 1;
+    }
+
+    fd = OpenPort(path, baud, generate);
+    if (fd < 0) {
+        return 1;
+    }
+
+    return generate ? Generate(fd, baud, bytes) : Check(fd, baud);
+}
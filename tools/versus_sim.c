@@ -0,0 +1,454 @@
+// versus_sim.c
+// Date Created: 2026-10-18
+// Date Updated: 2026-10-19
+// Host simulation of one board in a versus game, running the board's link
+// and versus code against a serial device. The autoplayer plays: each
+// piece is turned, then shifted toward the autoplayer's column at the
+// stick repeat rate while it falls at a fixed row time, so the peer's
+// prediction has real moves to follow. Two simulations play each other
+// over a pseudo-terminal pair:
+//   socat pty,raw,echo=0,link=/tmp/board1 pty,raw,echo=0,link=/tmp/board2 &
+//   versus_sim /tmp/board1 & versus_sim -l 5 /tmp/board2
+// -l damages or drops that percentage of the frames written, so resends
+// are exercised. -e drops that percentage of pieces where they spawn, as
+// the autoplayer alone almost never tops out. Each finished game and the
+// link counts are printed.
+// Build from the repository root, -fcommon for the RTOS headers' globals:
+//   cc -O2 -fcommon -I. -o versus_sim tools/versus_sim.c Game/src/tetris_versus.c Game/src/tetris_link.c Game/src/tetris_frame.c Game/src/tetris_ai.c driverlib/sw_crc.c
+// Usage: versus_sim [-g games] [-l percent] [-e percent] [-r row ms] [-a repeat ms] [device]
+
+/************************************Includes***************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <poll.h>
+
+// The RTOS declares a sleep() of its own
+#define sleep HostSleep
+#include <unistd.h>
+#undef sleep
+
+#include "threads.h"
+#include "Game/tetris_ai.h"
+#include "Game/tetris_versus.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DEFAULT_GAMES           3
+#define DEFAULT_ERROR_PERCENT   10
+#define DEFAULT_ROW_MS          60
+#define DEFAULT_REPEAT_MS       20
+
+#define POLL_MS                 LINK_POLL_PERIOD
+#define CONNECT_TIMEOUT_MS      10000
+#define RESTART_MS              500     // between games, as the autoplayer waits
+#define LINGER_MS               (2 * LINK_TIMEOUT_MS)   // lets the peer's last messages through
+
+/*************************************Defines***************************************/
+
+/*******************************Private Variables***********************************/
+
+static int port = -1;
+static uint32_t damagePercent = 0;
+static uint32_t framesDamaged = 0;
+static uint32_t errorPercent = DEFAULT_ERROR_PERCENT;
+
+static uint8_t board[BOARD_HEIGHT][BOARD_WIDTH];
+static uint8_t piece[PIECE_SIZE][PIECE_SIZE];
+static int pieceType = 0;
+static int pieceX = 0;
+static int pieceY = 0;
+static int nextType = 0;
+static int targetX = 0;
+static int8_t shift = 0;
+static uint32_t nextShift = 0;
+static uint32_t nextRow = 0;
+static uint32_t rowMS = DEFAULT_ROW_MS;
+static uint32_t repeatMS = DEFAULT_REPEAT_MS;
+
+static bool playing = false;
+static uint32_t pieces = 0;
+static uint32_t lines = 0;
+static uint32_t finished = 0;
+static uint32_t ended = 0;
+
+/*******************************Private Variables***********************************/
+
+/*******************************Private Functions***********************************/
+
+// Milliseconds
+// Return: uint32_t, monotonic time in ms
+static uint32_t Milliseconds(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+// G8RTOS_GetTimeUS
+// Stands in for the RTOS clock read by the autoplayer's time budget.
+// Return: uint32_t, monotonic time in us
+uint32_t G8RTOS_GetTimeUS(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000 + now.tv_nsec / 1000);
+}
+
+// OpenPort
+// Opens a serial device raw, both ways.
+// Return: int, file descriptor, -1 on error
+static int OpenPort(const char* path) {
+    struct termios tty;
+    int fd = open(path, O_RDWR | O_NOCTTY);
+
+    if (fd < 0) {
+        perror(path);
+        return -1;
+    }
+
+    // Pseudo-terminals take the settings and ignore the rate
+    if (tcgetattr(fd, &tty) == 0) {
+        cfmakeraw(&tty);
+        cfsetispeed(&tty, B115200);
+        cfsetospeed(&tty, B115200);
+        tty.c_cc[VMIN] = 0;
+        tty.c_cc[VTIME] = 0;
+        tcsetattr(fd, TCSANOW, &tty);
+    }
+    return fd;
+}
+
+// SimWrite
+// The link's transport. Damages or drops frames on request, as a noisy
+// line would.
+// Return: bool, false if the device took less than the frame
+static bool SimWrite(const uint8_t* frame, uint16_t length) {
+    uint8_t copy[LINK_MAX_FRAME];
+
+    if (damagePercent && (uint32_t)(rand() % 100) < damagePercent) {
+        framesDamaged++;
+        if (rand() & 1) {
+            return true;
+        }
+        memcpy(copy, frame, length);
+        copy[1 + rand() % (length - 2)] ^= (uint8_t)(1 + rand() % 255);
+        frame = copy;
+    }
+    return write(port, frame, length) == (ssize_t)length;
+}
+
+// Fits
+// Return: bool, true if the piece fits at a position, as CanMovePiece
+static bool Fits(int x, int y) {
+    int i = 0;
+    int j = 0;
+
+    for (i = 0; i < PIECE_SIZE; i++) {
+        for (j = 0; j < PIECE_SIZE; j++) {
+            if (!piece[i][j]) {
+                continue;
+            }
+            if (y + i < 0 || y + i >= BOARD_HEIGHT || x + j < 0 || x + j >= BOARD_WIDTH ||
+                board[y + i][x + j] != CELL_EMPTY) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Rotate
+// Turns the piece clockwise as RotatePiece does, which the autoplayer's
+// rotation counts assume.
+// Return: void
+static void Rotate(void) {
+    uint8_t rotated[PIECE_SIZE][PIECE_SIZE];
+    int i = 0;
+    int j = 0;
+
+    for (i = 0; i < PIECE_SIZE; i++) {
+        for (j = 0; j < PIECE_SIZE; j++) {
+            rotated[j][PIECE_SIZE - 1 - i] = piece[i][j];
+        }
+    }
+    memcpy(piece, rotated, sizeof(piece));
+}
+
+// Deal
+// Return: int, the next piece type, dealt as the board deals from its 15
+// bit rand()
+static int Deal(void) {
+    return ((rand() & 0x7FFF) * 5) % 7;
+}
+
+// EndGame
+// Return: void
+static void EndGame(uint32_t now) {
+    versusStats_t versus;
+
+    playing = false;
+    finished++;
+    ended = now;
+    TetrisVersus_Lost(now);
+    TetrisVersus_GetStats(&versus);
+    printf("game %u %s: %u pieces, %u lines, garbage %u sent, %u received, %u cancelled\n", finished,
+           (TetrisVersus_GetPhase() == VERSUS_WON) ? "won" : "lost", pieces, lines, versus.linesSent,
+           versus.linesReceived, versus.linesCancelled);
+    fflush(stdout);
+}
+
+// Spawn
+// Puts the next piece at the top, turns it as the autoplayer chose and
+// starts holding the stick toward its column.
+// Return: void
+static void Spawn(uint32_t now) {
+    tetrisMove_t move;
+    int i = 0;
+
+    pieceType = nextType;
+    nextType = Deal();
+    pieceX = BOARD_WIDTH / 2 - PIECE_SIZE / 2;
+    pieceY = 0;
+    memcpy(piece, PIECES[pieceType], sizeof(piece));
+    pieces++;
+    shift = 0;
+
+    if (!Fits(pieceX, pieceY)) {
+        EndGame(now);
+        return;
+    }
+
+    if ((uint32_t)(rand() % 100) >= errorPercent && TetrisAI_FindMove(board, (uint8_t)pieceType, (uint8_t)nextType, &move)) {
+        for (i = 0; i < move.rotations; i++) {
+            Rotate();
+        }
+        if (!Fits(pieceX, pieceY)) {
+            memcpy(piece, PIECES[pieceType], sizeof(piece));
+        }
+        targetX = move.x;
+        shift = (targetX < pieceX) ? -1 : ((targetX > pieceX) ? 1 : 0);
+    }
+    nextShift = now + repeatMS;
+    nextRow = now + rowMS;
+}
+
+// Lock
+// Places the piece, clears lines and trades garbage as LockPiece does.
+// Return: void
+static void Lock(uint32_t now) {
+    uint8_t cleared = 0;
+    uint8_t garbage = 0;
+    uint8_t hole = 0;
+    bool full = false;
+    int i = 0;
+    int j = 0;
+    int k = 0;
+
+    for (i = 0; i < PIECE_SIZE; i++) {
+        for (j = 0; j < PIECE_SIZE; j++) {
+            if (piece[i][j]) {
+                board[pieceY + i][pieceX + j] = (uint8_t)(pieceType + 1);
+            }
+        }
+    }
+
+    for (i = BOARD_HEIGHT - 1; i >= 0; i--) {
+        full = true;
+        for (j = 0; j < BOARD_WIDTH; j++) {
+            full = full && board[i][j] != CELL_EMPTY;
+        }
+        if (full) {
+            for (k = i; k > 0; k--) {
+                memcpy(board[k], board[k - 1], BOARD_WIDTH);
+            }
+            memset(board[0], CELL_EMPTY, BOARD_WIDTH);
+            cleared++;
+            i++;
+        }
+    }
+    lines += cleared;
+
+    if (cleared > 0) {
+        TetrisVersus_LinesCleared(cleared, now);
+    } else if ((garbage = TetrisVersus_TakeGarbage(&hole)) > 0) {
+        for (i = 0; i < garbage; i++) {
+            for (j = 0; j < BOARD_WIDTH; j++) {
+                if (board[i][j] != CELL_EMPTY) {
+                    EndGame(now);
+                    return;
+                }
+            }
+        }
+        memmove(board[0], board[garbage], (BOARD_HEIGHT - garbage) * BOARD_WIDTH);
+        for (i = BOARD_HEIGHT - garbage; i < BOARD_HEIGHT; i++) {
+            for (j = 0; j < BOARD_WIDTH; j++) {
+                board[i][j] = (j == hole) ? CELL_EMPTY : CELL_GARBAGE;
+            }
+        }
+    }
+
+    Spawn(now);
+}
+
+// StartGame
+// Clears the board and deals from a seed, as InitializeBoard does.
+// Return: void
+static void StartGame(uint32_t seed, uint32_t now) {
+    memset(board, CELL_EMPTY, sizeof(board));
+    srand(seed);
+    TetrisVersus_NewGame(seed, now);
+    nextType = Deal();
+    pieces = 0;
+    lines = 0;
+    playing = true;
+    Spawn(now);
+}
+
+// Step
+// Moves the piece on to the current time.
+// Return: void
+static void Step(uint32_t now) {
+    while (playing && (int32_t)(now - nextShift) >= 0 && shift != 0) {
+        nextShift += repeatMS;
+        if (Fits(pieceX + shift, pieceY)) {
+            pieceX += shift;
+        }
+        if (pieceX == targetX || !Fits(pieceX + shift, pieceY)) {
+            shift = 0;
+        }
+    }
+
+    while (playing && (int32_t)(now - nextRow) >= 0) {
+        nextRow += rowMS;
+        if (Fits(pieceX, pieceY + 1)) {
+            pieceY++;
+        } else {
+            Lock(now);
+        }
+    }
+}
+
+// FillState
+// Return: void
+static void FillState(versusState_t* state) {
+    TetrisVersus_PackBoard(board, state);
+    state->flags = playing ? VERSUS_FLAG_PLAYING : 0;
+    state->pieceType = playing ? (uint8_t)pieceType : VERSUS_NO_PIECE;
+    state->pieceX = (int8_t)pieceX;
+    state->pieceY = (int8_t)pieceY;
+    state->pieceMask = TetrisVersus_PieceMask(piece);
+    state->shift = shift;
+    state->repeatMS = (uint16_t)repeatMS;
+    state->rowTimeUS = rowMS * 1000;
+}
+
+/*******************************Private Functions***********************************/
+
+int main(int argc, char** argv) {
+    uint8_t bytes[LINK_READ_CHUNK];
+    versusState_t state;
+    versusStats_t versus;
+    linkStats_t link;
+    struct pollfd wait;
+    const char* path = 0;
+    uint32_t games = DEFAULT_GAMES;
+    uint32_t start = 0;
+    uint32_t now = 0;
+    uint32_t seed = 0;
+    ssize_t n = 0;
+    bool done = false;
+    int a = 0;
+
+    for (a = 1; a < argc; a++) {
+        if (!strcmp(argv[a], "-g") && a + 1 < argc) {
+            games = (uint32_t)strtoul(argv[++a], 0, 10);
+        } else if (!strcmp(argv[a], "-l") && a + 1 < argc) {
+            damagePercent = (uint32_t)strtoul(argv[++a], 0, 10);
+        } else if (!strcmp(argv[a], "-e") && a + 1 < argc) {
+            errorPercent = (uint32_t)strtoul(argv[++a], 0, 10);
+        } else if (!strcmp(argv[a], "-r") && a + 1 < argc) {
+            rowMS = (uint32_t)strtoul(argv[++a], 0, 10);
+        } else if (!strcmp(argv[a], "-a") && a + 1 < argc) {
+            repeatMS = (uint32_t)strtoul(argv[++a], 0, 10);
+        } else if (argv[a][0] == '-') {
+            fprintf(stderr, "usage: %s [-g games] [-l percent] [-e percent] [-r row ms] [-a repeat ms] [device]\n",
+                    argv[0]);
+            return 1;
+        } else {
+            path = argv[a];
+        }
+    }
+
+    if (path == 0 || rowMS == 0 || repeatMS == 0) {
+        fprintf(stderr, "need a device, and row and repeat times above 0\n");
+        return 1;
+    }
+
+    port = OpenPort(path);
+    if (port < 0) {
+        return 1;
+    }
+
+    // Sessions and holes only need to differ between runs
+    start = Milliseconds();
+    srand((unsigned)(time(0) ^ getpid()));
+    TetrisVersus_Init(SimWrite, (uint8_t)rand());
+    TetrisAI_Init();
+    memset(&state, 0, sizeof(state));
+    ended = start - RESTART_MS;
+
+    while (!done) {
+        wait.fd = port;
+        wait.events = POLLIN;
+        poll(&wait, 1, POLL_MS);
+
+        now = Milliseconds();
+        while ((n = read(port, bytes, sizeof(bytes))) > 0) {
+            TetrisVersus_Receive(bytes, (uint32_t)n, now);
+        }
+
+        // The peer topped out first
+        if (playing && TetrisVersus_GetPhase() == VERSUS_WON) {
+            EndGame(now);
+        }
+        if (TetrisVersus_TakeStart(&seed) && finished < games) {
+            StartGame(seed, now);
+        }
+        Step(now);
+
+        // Games start once the peer is heard, both at once is settled by seed
+        if (!playing && finished < games && (int32_t)(now - ended) >= RESTART_MS &&
+            TetrisVersus_IsConnected(now)) {
+            StartGame((uint32_t)rand(), now);
+        }
+
+        FillState(&state);
+        TetrisVersus_Update(&state, now);
+
+        if (finished == 0 && !TetrisVersus_IsConnected(now) && (int32_t)(now - start) >= CONNECT_TIMEOUT_MS) {
+            fprintf(stderr, "no peer on %s\n", path);
+            return 1;
+        }
+        done = finished >= games && (int32_t)(now - ended) >= LINGER_MS;
+    }
+
+    TetrisLink_GetStats(&link);
+    TetrisVersus_GetStats(&versus);
+    printf("won %u of %u games\n", versus.wins, versus.wins + versus.losses);
+    printf("link: %u frames sent, %u received, %u bad, %u resent, %u duplicate, %u refused, rtt %u ms, "
+           "%u damaged here\n", link.framesSent, link.framesReceived, link.badFrames, link.retransmits,
+           link.duplicates, link.windowFull, link.rttMS, framesDamaged);
+    printf("states: %u, %u stale, piece predicted %u times, %u missed\n", versus.states, versus.staleStates,
+           versus.predictions, versus.mispredictions);
+
+    return 0;
+}